@@ -0,0 +1,141 @@
+// 집계기 수집 처리량 벤치마크
+// 합성 에이전트 여러 개가 루프백으로 샘플 프레임을 보내고, 집계기가 모두 적재할 때까지의 처리량을 잰다.
+//
+// 사용법: bench_aggregator [--agents N] [--gpus N] [--ticks N] [--address tcp://127.0.0.1:0]
+
+#include "../nvml_aggregator.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+struct BenchOptions {
+    unsigned int agents = 16;
+    unsigned int gpus = 8;
+    unsigned int ticks = 20000;
+    std::string address = "tcp://127.0.0.1:0";
+};
+
+// 합성 에이전트: 틱마다 GPU 수만큼 샘플을 보낸다 (여러 틱을 모아서 send)
+// 연결은 측정이 끝날 때까지 유지한다 (롤업에서 빠지지 않도록)
+void runAgent(const SocketAddress& address, unsigned int agentId, const BenchOptions& options, int* fdOut) {
+    int fd = connectSocket(address);
+    *fdOut = fd;
+    if (fd < 0) {
+        std::cerr << "agent " << agentId << ": connect failed" << std::endl;
+        return;
+    }
+
+    std::vector<uint8_t> buffer;
+    WireEncoder encoder(buffer);
+    encoder.hello("node-" + std::to_string(agentId));
+
+    std::vector<WireDeviceDecl> decls;
+    for (unsigned int g = 0; g < options.gpus; g++) {
+        decls.push_back({g, "GPU-" + std::to_string(agentId) + "-" + std::to_string(g),
+                         g % 2 ? "NVIDIA A100-SXM4-80GB" : "NVIDIA H100 80GB HBM3"});
+    }
+    encoder.devices(decls);
+
+    std::vector<WireSample> samples(options.gpus);
+    uint64_t seed = agentId * 7919 + 1;
+    for (unsigned int t = 0; t < options.ticks; t++) {
+        for (unsigned int g = 0; g < options.gpus; g++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            WireSample& sample = samples[g];
+            std::memset(&sample, 0, sizeof(sample));
+            sample.slot = g;
+            sample.values[WIRE_FIELD_GPU_UTIL] = (seed >> 33) % 101;
+            sample.values[WIRE_FIELD_MEM_UTIL] = (seed >> 40) % 101;
+            sample.values[WIRE_FIELD_MEM_USED] = ((seed >> 20) % 80) << 30;
+            sample.values[WIRE_FIELD_MEM_TOTAL] = 80ULL << 30;
+            sample.values[WIRE_FIELD_TEMPERATURE] = 40 + (seed >> 50) % 40;
+            sample.values[WIRE_FIELD_POWER_USAGE] = 100000 + (seed >> 30) % 300000;
+            sample.values[WIRE_FIELD_SM_CLOCK] = 1410;
+        }
+        encoder.samples(1700000000000ULL + t * 1000ULL, samples.data(), samples.size());
+
+        if (buffer.size() > 256 * 1024 || t + 1 == options.ticks) {
+            if (!sendAll(fd, buffer.data(), buffer.size())) {
+                std::cerr << "agent " << agentId << ": send failed" << std::endl;
+                break;
+            }
+            buffer.clear();
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string key = argv[i];
+        if (key == "--agents") options.agents = std::stoul(argv[i + 1]);
+        else if (key == "--gpus") options.gpus = std::stoul(argv[i + 1]);
+        else if (key == "--ticks") options.ticks = std::stoul(argv[i + 1]);
+        else if (key == "--address") options.address = argv[i + 1];
+    }
+
+    FleetAggregator aggregator;
+    AggregatorServer server(aggregator);
+    if (!server.start(options.address)) {
+        return 1;
+    }
+
+    SocketAddress address;
+    parseSocketAddress(options.address, address);
+    if (!address.isUnix) {
+        address.port = server.port();
+    }
+
+    const uint64_t expected = static_cast<uint64_t>(options.agents) * options.gpus * options.ticks;
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> agents;
+    std::vector<int> agentFds(options.agents, -1);
+    for (unsigned int a = 0; a < options.agents; a++) {
+        agents.emplace_back(runAgent, address, a, options, &agentFds[a]);
+    }
+    for (auto& agent : agents) {
+        agent.join();
+    }
+
+    // 서버가 남은 바이트를 모두 적재할 때까지 대기
+    while (aggregator.totalSamples() < expected) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(120)) break;
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "agents=" << options.agents << " gpus/agent=" << options.gpus
+              << " ticks=" << options.ticks << std::endl;
+    std::cout << "ingested " << aggregator.totalSamples() << "/" << expected << " samples in "
+              << elapsed << " s (" << static_cast<uint64_t>(aggregator.totalSamples() / elapsed)
+              << " samples/s)" << std::endl;
+    std::cout << "series=" << aggregator.seriesCount() << std::endl;
+
+    for (const auto& histogram : aggregator.utilizationHistograms()) {
+        std::cout << histogram.model << ": " << histogram.gpuCount << " GPUs [";
+        for (size_t b = 0; b < FLEET_HISTOGRAM_BUCKETS; b++) {
+            std::cout << (b ? " " : "") << histogram.buckets[b];
+        }
+        std::cout << "]" << std::endl;
+    }
+
+    auto hottest = aggregator.topHotGPUs(3);
+    for (const auto& gpu : hottest) {
+        std::cout << "hot: " << gpu.node << " " << gpu.uuid << " "
+                  << gpu.latest.values[WIRE_FIELD_GPU_UTIL] << "%" << std::endl;
+    }
+
+    for (int fd : agentFds) {
+        if (fd >= 0) close(fd);
+    }
+    server.stop();
+    return 0;
+}
@@ -0,0 +1,198 @@
+// InfluxDB 라인 프로토콜 포맷/전송 벤치마크
+// 1) LineProtocolWriter와 std::to_string 문자열 이어붙이기 포맷터의 처리량 비교
+// 2) 로컬 HttpServer를 InfluxDB 대신 세워 InfluxSink로 배치 POST (gzip 유무)
+//
+// 사용법: bench_influx [--gpus N] [--processes N] [--snapshots N]
+
+#include "../nvml_influx.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+namespace {
+
+struct BenchOptions {
+    unsigned int gpus = 8;
+    unsigned int processes = 16;
+    unsigned int snapshots = 20000;
+};
+
+std::vector<GPUInfo> makeGpus(unsigned int count) {
+    std::vector<GPUInfo> gpus(count);
+    for (unsigned int i = 0; i < count; i++) {
+        gpus[i].index = i;
+        gpus[i].name = "NVIDIA A100-SXM4-80GB";
+        gpus[i].uuid = "GPU-3f9a1c2e-7b4d-4e8f-9a0b-" + std::to_string(100000000000ULL + i);
+    }
+    return gpus;
+}
+
+std::vector<MetricsSnapshot> makeSnapshots(const BenchOptions& options) {
+    // 변화가 있는 값으로 만든 스냅샷 몇 개를 돌려 쓴다
+    std::vector<MetricsSnapshot> snapshots(64);
+    auto base = std::chrono::system_clock::now();
+    for (size_t s = 0; s < snapshots.size(); s++) {
+        MetricsSnapshot& snapshot = snapshots[s];
+        snapshot.timestamp = base + std::chrono::seconds(s);
+        for (unsigned int g = 0; g < options.gpus; g++) {
+            GPUMetrics m = {};
+            m.deviceIndex = g;
+            m.gpuUtilization = (s * 7 + g * 13) % 101;
+            m.memoryUtilization = (s * 3 + g) % 101;
+            m.memoryUsed = 40ULL * 1024 * 1024 * 1024 + s * 1048576 + g * 4096;
+            m.memoryTotal = 80ULL * 1024 * 1024 * 1024;
+            m.temperature = 55 + (s + g) % 20;
+            m.fanSpeed = 40 + s % 30;
+            m.powerUsage = 250000 + s * 137 + g * 11;
+            m.powerLimit = 400000;
+            m.smClock = 1410;
+            m.memoryClock = 1593;
+            m.graphicsClock = 1410;
+            snapshot.devices.push_back(m);
+        }
+        for (unsigned int p = 0; p < options.processes; p++) {
+            ProcessInfo info = {};
+            info.deviceIndex = p % options.gpus;
+            info.pid = 20000 + p;
+            info.nameId = internString("python3 train.py --rank " + std::to_string(p));
+            info.usedGpuMemory = 1024ULL * 1024 * (512 + p * 64 + s);
+            info.type = NVML_PROCESS_TYPE_COMPUTE;
+            snapshot.processes.push_back(info);
+        }
+    }
+    return snapshots;
+}
+
+// 비교 기준: 필드마다 std::to_string 임시 문자열을 만드는 포맷터
+void appendNaive(const MetricsSnapshot& snapshot, const std::vector<GPUInfo>& gpus, std::string& out) {
+    std::string ts = std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        snapshot.timestamp.time_since_epoch()).count());
+    for (const auto& m : snapshot.devices) {
+        out += "nvml_gpu,gpu=" + std::to_string(m.deviceIndex) + ",uuid=" + gpus[m.deviceIndex].uuid;
+        out += " gpu_utilization=" + std::to_string(m.gpuUtilization) + "i";
+        out += ",memory_utilization=" + std::to_string(m.memoryUtilization) + "i";
+        out += ",encoder_utilization=" + std::to_string(m.encoderUtilization) + "i";
+        out += ",decoder_utilization=" + std::to_string(m.decoderUtilization) + "i";
+        out += ",memory_used=" + std::to_string(m.memoryUsed) + "i";
+        out += ",memory_total=" + std::to_string(m.memoryTotal) + "i";
+        out += ",temperature=" + std::to_string(m.temperature) + "i";
+        out += ",fan_speed=" + std::to_string(m.fanSpeed) + "i";
+        out += ",power_usage=" + std::to_string(m.powerUsage) + "i";
+        out += ",power_limit=" + std::to_string(m.powerLimit) + "i";
+        out += ",sm_clock=" + std::to_string(m.smClock) + "i";
+        out += ",memory_clock=" + std::to_string(m.memoryClock) + "i";
+        out += ",graphics_clock=" + std::to_string(m.graphicsClock) + "i";
+        out += ",ecc_single_bit=" + std::to_string(m.eccSingleBit) + "i";
+        out += ",ecc_double_bit=" + std::to_string(m.eccDoubleBit) + "i";
+        out += " " + ts + "\n";
+    }
+    for (const auto& p : snapshot.processes) {
+        out += "nvml_process,gpu=" + std::to_string(p.deviceIndex) + ",pid=" + std::to_string(p.pid) +
+               ",type=compute used_memory=" + std::to_string(p.usedGpuMemory) + "i,name=\"" + internedString(p.nameId) + "\" " +
+               ts + "\n";
+    }
+}
+
+void benchFormat(const BenchOptions& options, const std::vector<GPUInfo>& gpus,
+                 const std::vector<MetricsSnapshot>& snapshots) {
+    // 1MB 배치마다 비우는 실제 사용 패턴
+    const size_t batchBytes = 1024 * 1024;
+
+    LineProtocolWriter writer(gpus);
+    uint64_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < options.snapshots; i++) {
+        writer.append(snapshots[i % snapshots.size()]);
+        if (writer.size() >= batchBytes) {
+            bytes += writer.size();
+            writer.clear();
+        }
+    }
+    bytes += writer.size();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("writer   : %8.1f MB/s %10.0f snapshots/s\n", bytes / 1e6 / seconds, options.snapshots / seconds);
+
+    std::string naive;
+    naive.reserve(batchBytes * 2);
+    uint64_t naiveBytes = 0;
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < options.snapshots; i++) {
+        appendNaive(snapshots[i % snapshots.size()], gpus, naive);
+        if (naive.size() >= batchBytes) {
+            naiveBytes += naive.size();
+            naive.clear();
+        }
+    }
+    naiveBytes += naive.size();
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("to_string: %8.1f MB/s %10.0f snapshots/s\n", naiveBytes / 1e6 / seconds,
+                options.snapshots / seconds);
+}
+
+void benchSink(const BenchOptions& options, const std::vector<GPUInfo>& gpus,
+               const std::vector<MetricsSnapshot>& snapshots, bool gzip) {
+    HttpServer server;
+    std::atomic<uint64_t> received(0), requests(0);
+    server.route("/api/v2/write", [&](const HttpRequest& request, HttpResponse& response) {
+        received += request.body.size();
+        requests++;
+        response.status = 204;
+    });
+    if (!server.start("tcp://127.0.0.1:0")) return;
+
+    InfluxConfig config;
+    config.url = "http://127.0.0.1:" + std::to_string(server.port()) + "/api/v2/write?org=bench&bucket=nvml";
+    config.token = "bench";
+    config.gzip = gzip;
+    config.flushIntervalMs = 1000000;
+    InfluxSink sink(config, gpus);
+    sink.open();
+
+    auto base = std::chrono::system_clock::now();
+    std::vector<SnapshotPtr> batch(1);
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < options.snapshots; i++) {
+        auto snapshot = std::make_shared<MetricsSnapshot>(snapshots[i % snapshots.size()]);
+        snapshot->timestamp = base + std::chrono::milliseconds(i);
+        batch[0] = snapshot;
+        sink.exportBatch(batch);
+    }
+    sink.close();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    server.stop();
+
+    InfluxStats stats = sink.getStats();
+    std::printf("sink gzip=%d: %10.0f snapshots/s, %llu requests, formatted %.1f MB, sent %.1f MB (ratio %.2f), "
+                "server received %.1f MB, failures %llu\n",
+                gzip ? 1 : 0, options.snapshots / seconds, static_cast<unsigned long long>(requests.load()),
+                stats.bytesFormatted / 1e6, stats.bytesSent / 1e6,
+                stats.bytesSent ? static_cast<double>(stats.bytesFormatted) / stats.bytesSent : 0.0,
+                received.load() / 1e6, static_cast<unsigned long long>(stats.failures));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string key = argv[i];
+        if (key == "--gpus") options.gpus = std::stoul(argv[i + 1]);
+        else if (key == "--processes") options.processes = std::stoul(argv[i + 1]);
+        else if (key == "--snapshots") options.snapshots = std::stoul(argv[i + 1]);
+    }
+
+    std::cout << "gpus=" << options.gpus << " processes=" << options.processes
+              << " snapshots=" << options.snapshots << std::endl;
+
+    auto gpus = makeGpus(options.gpus);
+    auto snapshots = makeSnapshots(options);
+
+    benchFormat(options, gpus, snapshots);
+    benchSink(options, gpus, snapshots, false);
+#ifdef NVML_HAVE_ZLIB
+    benchSink(options, gpus, snapshots, true);
+#endif
+    return 0;
+}
@@ -0,0 +1,157 @@
+// 세그먼트 병렬 스캔 확장성 벤치마크
+// 합성 디바이스 히스토리를 세그먼트 파일로 쓴 다음, 같은 질의를 스레드 수를 늘려 가며 스캔한다.
+// 첫 실행으로 페이지 캐시를 데운 뒤 측정하므로 디스크가 아니라 스캔/집계 속도를 본다.
+// 속도 향상 = 1스레드 시간 / N스레드 시간 (코어 수까지 거의 선형이어야 한다)
+//
+// 사용법: bench_scan [--dir /tmp/nvml_scan_bench] [--segments N] [--gpus N] [--ticks-per-segment N]
+//                    [--max-threads N] [--repeat N]
+
+#include "../nvml_segment.h"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+struct BenchOptions {
+    std::string directory = "/tmp/nvml_scan_bench";
+    unsigned int segments = 64;
+    unsigned int gpus = 8;
+    unsigned int ticksPerSegment = 4096; // 1초 틱 (세그먼트당 약 68분)
+    unsigned int maxThreads = 0;         // 0이면 코어 수
+    unsigned int repeat = 3;
+};
+
+std::vector<std::string> writeSegments(const BenchOptions& options) {
+    mkdir(options.directory.c_str(), 0755);
+
+    std::vector<std::string> uuids;
+    for (unsigned int g = 0; g < options.gpus; g++) {
+        uuids.push_back("GPU-bench-" + std::to_string(g));
+    }
+
+    std::vector<std::string> paths;
+    const size_t blockRows = 4096;
+    int64_t ts = 1700000000000LL;
+    uint64_t seed = 88172645463325252ULL;
+    for (unsigned int s = 0; s < options.segments; s++) {
+        std::vector<HistoryBlockPtr> blocks;
+        auto block = std::make_shared<HistoryBlock>(HistoryTable::Device);
+        for (unsigned int t = 0; t < options.ticksPerSegment; t++, ts += 1000) {
+            for (unsigned int g = 0; g < options.gpus; g++) {
+                seed ^= seed << 13;
+                seed ^= seed >> 7;
+                seed ^= seed << 17;
+                block->timestamps.push_back(ts);
+                block->devices.push_back(g);
+                for (int m = 0; m < HM_DEVICE_METRIC_COUNT; m++) {
+                    block->values[m].push_back(static_cast<double>((seed >> (m * 4)) % 100));
+                }
+                block->minTimestamp = std::min(block->minTimestamp, ts);
+                block->maxTimestamp = std::max(block->maxTimestamp, ts);
+                block->deviceMask |= historyDeviceBit(g);
+                if (block->rows() == blockRows) {
+                    blocks.push_back(block);
+                    block = std::make_shared<HistoryBlock>(HistoryTable::Device);
+                }
+            }
+        }
+        if (block->rows() > 0) blocks.push_back(block);
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "/device-%06u.seg", s);
+        std::string path = options.directory + name;
+        std::string error;
+        if (!writeHistorySegment(path, HistoryTable::Device, blocks, uuids, {}, error)) {
+            std::cerr << error << std::endl;
+            return {};
+        }
+        paths.push_back(path);
+    }
+    return paths;
+}
+
+double runScan(const std::vector<std::string>& paths, const HistoryQuery& query, unsigned int threads,
+               unsigned int repeat, SegmentScanResult& result) {
+    SegmentScanner scanner(threads);
+    std::string error;
+    double best = 1e30;
+    for (unsigned int r = 0; r < repeat; r++) {
+        if (!scanner.scan(paths, query, result, error)) {
+            std::cerr << error << std::endl;
+            return 0;
+        }
+        best = std::min(best, result.stats.elapsedMs);
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string key = argv[i];
+        if (key == "--dir") options.directory = argv[i + 1];
+        else if (key == "--segments") options.segments = std::stoul(argv[i + 1]);
+        else if (key == "--gpus") options.gpus = std::stoul(argv[i + 1]);
+        else if (key == "--ticks-per-segment") options.ticksPerSegment = std::stoul(argv[i + 1]);
+        else if (key == "--max-threads") options.maxThreads = std::stoul(argv[i + 1]);
+        else if (key == "--repeat") options.repeat = std::stoul(argv[i + 1]);
+    }
+    unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+    if (options.maxThreads == 0) options.maxThreads = cores;
+
+    std::vector<std::string> paths = writeSegments(options);
+    if (paths.empty()) return 1;
+
+    uint64_t rows = static_cast<uint64_t>(options.segments) * options.ticksPerSegment * options.gpus;
+    std::cout << "segments=" << options.segments << " rows=" << rows << " cores=" << cores
+              << " dir=" << options.directory << std::endl;
+
+    struct Case {
+        const char* name;
+        HistoryQuery query;
+    };
+    std::vector<Case> cases;
+    HistoryQuery query;
+    query.metric = HM_GPU_UTILIZATION;
+    query.start = 0;
+    query.end = INT64_MAX;
+    query.aggregate = HistoryAggregate::Avg;
+    query.groupBy = HistoryGroupBy::Device;
+    cases.push_back({"avg by device", query});
+    query.step = 3600 * 1000;
+    query.start = 1700000000000LL;
+    query.end = query.start + static_cast<int64_t>(options.segments) * options.ticksPerSegment * 1000;
+    query.aggregate = HistoryAggregate::Max;
+    cases.push_back({"hourly max by device", query});
+    query.aggregate = HistoryAggregate::Quantile;
+    query.quantile = 0.95;
+    query.groupBy = HistoryGroupBy::None;
+    cases.push_back({"hourly p95", query});
+
+    for (const auto& benchCase : cases) {
+        SegmentScanResult result;
+        runScan(paths, benchCase.query, 1, 1, result); // 페이지 캐시 데우기
+
+        double single = 0;
+        std::printf("%s\n", benchCase.name);
+        for (unsigned int threads = 1; threads <= options.maxThreads; threads *= 2) {
+            double ms = runScan(paths, benchCase.query, threads, options.repeat, result);
+            if (threads == 1) single = ms;
+            std::printf("  threads %3u: %9.2f ms  %8.1f Mrows/s  speedup %5.2fx  efficiency %5.1f%%\n", threads, ms,
+                        result.stats.rowsScanned / ms / 1e3, single / ms, 100.0 * single / ms / threads);
+            if (threads < options.maxThreads && threads * 2 > options.maxThreads) threads = options.maxThreads / 2;
+        }
+    }
+
+    for (const auto& path : paths) {
+        unlink(path.c_str());
+    }
+    rmdir(options.directory.c_str());
+    return 0;
+}
@@ -0,0 +1,211 @@
+// 시계열 레지스트리 동시 갱신/스크레이프 벤치마크
+// 틱마다 모든 시계열을 갱신하는 스레드 여러 개와 계속 스크레이프하는 스레드를 함께 돌리고
+// 초당 갱신 수와 스크레이프 시간을 잰다. 일부 갱신은 프로세스가 바뀐 것처럼 시계열을 지우고 새로 만든다.
+// 비교용으로 뮤텍스 하나로 보호하는 맵 레지스트리를 같은 부하로 돌린다
+//
+// 사용법: bench_series [--series N] [--updaters N] [--scrapers N] [--seconds N] [--churn N]
+
+#include "../nvml_series.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct BenchOptions {
+    unsigned int series = 50000;
+    unsigned int updaters = 4;
+    unsigned int scrapers = 1;
+    double seconds = 3;
+    unsigned int churn = 1000;    // 이만큼 갱신마다 시계열 하나를 새 pid로 바꾼다 (0이면 없음)
+};
+
+struct BenchResult {
+    uint64_t updates = 0;
+    uint64_t scrapes = 0;
+    double scrapeMs = 0;          // 스크레이프 평균
+    size_t pageBytes = 0;
+};
+
+int64_t nowMillis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// 비교 기준: 뮤텍스 하나 + 맵 (갱신과 스크레이프가 모두 같은 잠금을 잡는다)
+class MutexRegistry {
+private:
+    struct Entry {
+        std::string text;
+        double value;
+        int64_t updatedMs;
+    };
+
+    std::mutex mutex;
+    std::unordered_map<uint64_t, Entry> series;
+    uint64_t nextId = 1;
+
+public:
+    uint64_t create(const std::string& text, int64_t nowMs) {
+        std::lock_guard<std::mutex> lock(mutex);
+        uint64_t id = nextId++;
+        series.emplace(id, Entry{text, 0, nowMs});
+        return id;
+    }
+
+    bool set(uint64_t id, double value, int64_t nowMs) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = series.find(id);
+        if (it == series.end()) return false;
+        it->second.value = value;
+        it->second.updatedMs = nowMs;
+        return true;
+    }
+
+    void remove(uint64_t id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        series.erase(id);
+    }
+
+    void appendPrometheus(std::string& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        char text[32];
+        for (const auto& entry : series) {
+            out += entry.second.text;
+            std::snprintf(text, sizeof(text), " %.10g\n", entry.second.value);
+            out += text;
+        }
+    }
+};
+
+std::string seriesText(unsigned int gpu, unsigned long long pid) {
+    return "nvml_process_memory_bytes{gpu=\"" + std::to_string(gpu) + "\",pid=\"" + std::to_string(pid) + "\"}";
+}
+
+// 공통 부하: updater마다 자기 몫의 시계열을 돌며 갱신, scraper는 계속 페이지를 만든다
+template <typename CreateFn, typename SetFn, typename RemoveFn, typename ScrapeFn>
+BenchResult runLoad(const BenchOptions& options, CreateFn create, SetFn set, RemoveFn remove, ScrapeFn scrape) {
+    unsigned int perThread = options.series / options.updaters;
+    std::vector<std::vector<uint64_t>> ids(options.updaters);
+    std::vector<unsigned long long> nextPid(options.updaters);
+    for (unsigned int t = 0; t < options.updaters; t++) {
+        for (unsigned int i = 0; i < perThread; i++) {
+            ids[t].push_back(create(t % 8, 100000ULL * (t + 1) + i));
+        }
+        nextPid[t] = 100000ULL * (t + 1) + perThread;
+    }
+
+    std::atomic<bool> stop(false);
+    std::atomic<uint64_t> updates(0);
+    std::atomic<uint64_t> scrapes(0);
+    std::atomic<uint64_t> scrapeNs(0);
+    std::atomic<size_t> pageBytes(0);
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < options.updaters; t++) {
+        threads.emplace_back([&, t] {
+            uint64_t count = 0;
+            std::vector<uint64_t>& mine = ids[t];
+            while (!stop.load(std::memory_order_relaxed)) {
+                int64_t now = nowMillis();
+                for (size_t i = 0; i < mine.size(); i++) {
+                    set(mine[i], static_cast<double>(count), now);
+                    count++;
+                    if (options.churn && count % options.churn == 0) {
+                        remove(mine[i]);
+                        mine[i] = create(t % 8, nextPid[t]++);
+                    }
+                }
+            }
+            updates += count;
+        });
+    }
+    for (unsigned int s = 0; s < options.scrapers; s++) {
+        threads.emplace_back([&] {
+            std::string page;
+            while (!stop.load(std::memory_order_relaxed)) {
+                page.clear();
+                auto start = std::chrono::steady_clock::now();
+                scrape(page);
+                scrapeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - start).count();
+                scrapes++;
+                pageBytes = page.size();
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.seconds));
+    stop = true;
+    for (auto& thread : threads) thread.join();
+
+    BenchResult result;
+    result.updates = updates;
+    result.scrapes = scrapes;
+    result.scrapeMs = scrapes ? scrapeNs / 1e6 / scrapes : 0;
+    result.pageBytes = pageBytes;
+    return result;
+}
+
+void printResult(const char* name, const BenchOptions& options, const BenchResult& result) {
+    std::printf("%-10s %8.1f M updates/s, %6.1f scrapes/s, %7.2f ms/scrape, page %zu bytes\n", name,
+                result.updates / options.seconds / 1e6, result.scrapes / options.seconds, result.scrapeMs,
+                result.pageBytes);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string key = argv[i];
+        if (key == "--series") options.series = std::stoul(argv[i + 1]);
+        else if (key == "--updaters") options.updaters = std::max(1ul, std::stoul(argv[i + 1]));
+        else if (key == "--scrapers") options.scrapers = std::stoul(argv[i + 1]);
+        else if (key == "--seconds") options.seconds = std::stod(argv[i + 1]);
+        else if (key == "--churn") options.churn = std::stoul(argv[i + 1]);
+    }
+    std::cout << "series=" << options.series << " updaters=" << options.updaters << " scrapers=" << options.scrapers
+              << " churn=1/" << options.churn << " seconds=" << options.seconds << std::endl;
+
+    {
+        SeriesRegistryConfig config;
+        config.sweepIntervalMs = 100;   // 갱신되지 않는 시계열은 없지만 해제 경로를 같이 돌린다
+        SeriesRegistry registry(config);
+        registry.start();
+        BenchResult result = runLoad(
+            options,
+            [&](unsigned int gpu, unsigned long long pid) {
+                SeriesKey key("nvml_process_memory_bytes");
+                key.label("gpu", gpu).label("pid", pid);
+                return registry.getOrCreate(key, nowMillis());
+            },
+            [&](uint64_t id, double value, int64_t now) { return registry.set(id, value, now); },
+            [&](uint64_t id) { registry.remove(id); },
+            [&](std::string& page) { registry.appendPrometheus(page); });
+        registry.stop();
+        printResult("sharded", options, result);
+        SeriesRegistryStats stats = registry.getStats();
+        std::printf("           live %llu, created %llu, removed %llu, pending reclaim %llu\n",
+                    static_cast<unsigned long long>(stats.live), static_cast<unsigned long long>(stats.created),
+                    static_cast<unsigned long long>(stats.removed),
+                    static_cast<unsigned long long>(stats.pendingReclaim));
+    }
+    {
+        MutexRegistry registry;
+        BenchResult result = runLoad(
+            options,
+            [&](unsigned int gpu, unsigned long long pid) { return registry.create(seriesText(gpu, pid), nowMillis()); },
+            [&](uint64_t id, double value, int64_t now) { return registry.set(id, value, now); },
+            [&](uint64_t id) { registry.remove(id); },
+            [&](std::string& page) { registry.appendPrometheus(page); });
+        printResult("mutex map", options, result);
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+// 디스크 스풀 쓰기 증폭/처리량 벤치마크
+// fsync 배치 크기별로 레코드를 append한 뒤 mmap으로 재생한다.
+// 논리 쓰기 증폭 = 레코드 헤더 포함 write 바이트 / payload 바이트
+// 장치 쓰기 증폭 = /proc/self/io write_bytes 증가량 / payload 바이트 (fsync로 인한 페이지 재기록 포함)
+//
+// 사용법: bench_spool [--dir /tmp/nvml_spool_bench] [--records N] [--record-size N]
+
+#include "../nvml_spool.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+namespace {
+
+struct BenchOptions {
+    std::string directory = "/tmp/nvml_spool_bench";
+    unsigned int records = 200000;
+    unsigned int recordSize = 600; // 8 GPU, 60틱 키프레임 BATCH 프레임 정도
+};
+
+// 블록 장치로 내려간 바이트 (지원하지 않으면 0)
+uint64_t deviceWriteBytes() {
+    std::ifstream io("/proc/self/io");
+    std::string key;
+    uint64_t value;
+    while (io >> key >> value) {
+        if (key == "write_bytes:") return value;
+    }
+    return 0;
+}
+
+void removeSegments(const std::string& directory) {
+    SpoolConfig config;
+    config.directory = directory;
+    DiskSpool spool(config);
+    if (!spool.open()) return;
+    while (spool.beginReplay()) {
+        spool.finishReplay();
+    }
+}
+
+void runCase(const BenchOptions& options, size_t fsyncBytes) {
+    removeSegments(options.directory);
+
+    SpoolConfig config;
+    config.directory = options.directory;
+    config.fsyncBytes = fsyncBytes;
+    config.fsyncIntervalMs = 1000;
+    config.maxDiskBytes = 0;
+
+    std::vector<uint8_t> record(options.recordSize);
+    for (size_t i = 0; i < record.size(); i++) {
+        record[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    DiskSpool spool(config);
+    if (!spool.open()) return;
+
+    uint64_t deviceBefore = deviceWriteBytes();
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int r = 0; r < options.records; r++) {
+        record[0] = static_cast<uint8_t>(r);
+        spool.append(record.data(), record.size());
+    }
+    spool.sync();
+    double appendSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    uint64_t deviceBytes = deviceWriteBytes() - deviceBefore;
+
+    // mmap 재생
+    start = std::chrono::steady_clock::now();
+    uint64_t replayed = 0, checksum = 0;
+    while (spool.beginReplay()) {
+        const uint8_t* data;
+        uint32_t size;
+        while (spool.nextRecord(data, size)) {
+            checksum += data[0];
+            replayed++;
+        }
+        spool.finishReplay();
+    }
+    double replaySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    SpoolStats stats = spool.getStats();
+    double payloadMB = stats.payloadBytes / 1e6;
+    std::printf("fsync every %8zu B: append %8.1f MB/s %9.0f rec/s, fsyncs %6llu, "
+                "logical WA %.3f, device WA %s, replay %8.1f MB/s (%llu records)\n",
+                fsyncBytes, payloadMB / appendSeconds, options.records / appendSeconds,
+                static_cast<unsigned long long>(stats.fsyncs),
+                static_cast<double>(stats.bytesWritten) / stats.payloadBytes,
+                deviceBytes ? std::to_string(static_cast<double>(deviceBytes) / stats.payloadBytes).c_str() : "n/a",
+                payloadMB / replaySeconds, static_cast<unsigned long long>(replayed));
+    (void)checksum;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string key = argv[i];
+        if (key == "--dir") options.directory = argv[i + 1];
+        else if (key == "--records") options.records = std::stoul(argv[i + 1]);
+        else if (key == "--record-size") options.recordSize = std::stoul(argv[i + 1]);
+    }
+
+    std::cout << "records=" << options.records << " record-size=" << options.recordSize
+              << " dir=" << options.directory << std::endl;
+
+    for (size_t fsyncBytes : {size_t(4096), size_t(64 * 1024), size_t(1024 * 1024), size_t(16 * 1024 * 1024)}) {
+        runCase(options, fsyncBytes);
+    }
+
+    removeSegments(options.directory);
+    rmdir(options.directory.c_str());
+    return 0;
+}
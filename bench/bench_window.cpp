@@ -0,0 +1,89 @@
+// 슬라이딩 창 집계 벤치마크
+// 1ms 간격 샘플을 넣고 샘플마다 합/개수/최소/최대를 읽는다 (틱마다 규칙을 평가하는 경우).
+// 창 길이(샘플 수)를 늘려도 두 스택 집계의 샘플당 비용은 일정해야 하고,
+// 비교용 재스캔(창 전체를 매번 다시 훑기)은 창 길이에 비례한다
+//
+// 사용법: bench_window [--samples N] [--max-window N] [--rescan-max N]
+
+#include "../nvml_window.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace {
+
+struct BenchOptions {
+    uint64_t samples = 5000000;
+    int64_t maxWindow = 1000000;  // 샘플 수 (1ms 간격이므로 ms)
+    int64_t rescanMax = 10000;    // 재스캔은 이 창 길이까지만 (그 이상은 너무 느리다)
+};
+
+std::vector<double> makeValues(uint64_t count) {
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(0, 100);
+    std::vector<double> values(count);
+    for (auto& value : values) {
+        value = dist(rng);
+    }
+    return values;
+}
+
+double runSlidingWindow(const std::vector<double>& values, int64_t windowMs, double& checksum) {
+    SlidingWindow window(windowMs);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < values.size(); i++) {
+        window.add(static_cast<int64_t>(i), values[i]);
+        WindowAggregate aggregate = window.aggregate();
+        checksum += aggregate.sum + aggregate.min + aggregate.max + aggregate.count;
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / values.size();
+}
+
+double runRescan(const std::vector<double>& values, int64_t windowMs, double& checksum) {
+    std::deque<std::pair<int64_t, double>> samples;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < values.size(); i++) {
+        int64_t ts = static_cast<int64_t>(i);
+        samples.emplace_back(ts, values[i]);
+        while (samples.front().first <= ts - windowMs) samples.pop_front();
+        WindowAggregate aggregate;
+        for (const auto& sample : samples) {
+            aggregate.add(sample.second);
+        }
+        checksum += aggregate.sum + aggregate.min + aggregate.max + aggregate.count;
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / values.size();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string key = argv[i];
+        if (key == "--samples") options.samples = std::stoull(argv[i + 1]);
+        else if (key == "--max-window") options.maxWindow = std::stoll(argv[i + 1]);
+        else if (key == "--rescan-max") options.rescanMax = std::stoll(argv[i + 1]);
+    }
+
+    std::cout << "samples=" << options.samples << " (1 ms apart)" << std::endl;
+    std::vector<double> values = makeValues(options.samples);
+
+    double checksum = 0;
+    for (int64_t windowMs = 10; windowMs <= options.maxWindow; windowMs *= 10) {
+        double windowNs = runSlidingWindow(values, windowMs, checksum);
+        std::printf("window %8lld samples: two-stack %7.1f ns/sample", static_cast<long long>(windowMs), windowNs);
+        if (windowMs <= options.rescanMax) {
+            // 재스캔은 샘플 수를 줄여 돌린다 (창 x 샘플 연산)
+            std::vector<double> subset(values.begin(), values.begin() + std::min<size_t>(values.size(), 200000));
+            std::printf(", rescan %10.1f ns/sample", runRescan(subset, windowMs, checksum));
+        }
+        std::printf("\n");
+    }
+    std::printf("checksum %.0f\n", checksum);
+    return 0;
+}
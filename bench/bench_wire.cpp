@@ -0,0 +1,189 @@
+// wire 프로토콜 인코딩/디코딩 벤치마크
+// 같은 합성 시계열을 JSON(GPUMetrics당 객체 하나), v1 SAMPLES, v2 BATCH(델타)로 인코딩해
+// 틱당 바이트 수와 인코딩/디코딩 처리량을 비교한다.
+//
+// 사용법: bench_wire [--gpus N] [--ticks N] [--batch N] [--keyframe N]
+
+#include "../nvml_wire.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace {
+
+struct BenchOptions {
+    unsigned int gpus = 8;
+    unsigned int ticks = 20000;
+    unsigned int batch = 10;
+    unsigned int keyframe = 60;
+};
+
+// 실제 노드처럼 대부분의 필드가 천천히 변하는 시계열
+std::vector<WireTick> makeTicks(const BenchOptions& options) {
+    std::vector<WireTick> ticks(options.ticks);
+    uint64_t seed = 12345;
+    for (unsigned int t = 0; t < options.ticks; t++) {
+        WireTick& tick = ticks[t];
+        tick.sequence = t + 1;
+        tick.timestampMs = 1700000000000ULL + t * 1000ULL + (seed >> 60);
+        tick.samples.resize(options.gpus);
+        for (unsigned int g = 0; g < options.gpus; g++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            WireSample& sample = tick.samples[g];
+            std::memset(&sample, 0, sizeof(sample));
+            sample.slot = g;
+            unsigned int phase = (t / 30 + g) % 4;
+            sample.values[WIRE_FIELD_GPU_UTIL] = phase ? 90 + (seed >> 61) : 0;
+            sample.values[WIRE_FIELD_MEM_UTIL] = phase ? 40 + (seed >> 62) : 0;
+            sample.values[WIRE_FIELD_MEM_USED] = (phase ? 60ULL : 1ULL) << 30;
+            sample.values[WIRE_FIELD_MEM_TOTAL] = 80ULL << 30;
+            sample.values[WIRE_FIELD_TEMPERATURE] = 45 + phase * 8;
+            sample.values[WIRE_FIELD_FAN_SPEED] = 30 + phase * 10;
+            sample.values[WIRE_FIELD_POWER_USAGE] = phase ? 350000 + (seed >> 50) % 2000 : 60000;
+            sample.values[WIRE_FIELD_POWER_LIMIT] = 400000;
+            sample.values[WIRE_FIELD_SM_CLOCK] = phase ? 1410 : 210;
+            sample.values[WIRE_FIELD_MEM_CLOCK] = 1593;
+            sample.values[WIRE_FIELD_GRAPHICS_CLOCK] = phase ? 1410 : 210;
+        }
+    }
+    return ticks;
+}
+
+const char* kJsonFields[WIRE_FIELD_COUNT] = {
+    "gpuUtilization", "memoryUtilization", "encoderUtilization", "decoderUtilization",
+    "memoryUsed", "memoryTotal", "temperature", "fanSpeed", "powerUsage", "powerLimit",
+    "smClock", "memoryClock", "graphicsClock", "eccSingleBit", "eccDoubleBit"
+};
+
+void encodeJson(const WireTick& tick, std::string& out) {
+    char buffer[64];
+    for (const auto& sample : tick.samples) {
+        out += "{\"device\":";
+        out += std::to_string(sample.slot);
+        out += ",\"timestamp\":";
+        out += std::to_string(tick.timestampMs);
+        for (int f = 0; f < WIRE_FIELD_COUNT; f++) {
+            int n = std::snprintf(buffer, sizeof(buffer), ",\"%s\":%llu", kJsonFields[f],
+                                  static_cast<unsigned long long>(sample.values[f]));
+            out.append(buffer, n);
+        }
+        out += "}\n";
+    }
+}
+
+// 인코딩된 스트림을 프레임 단위로 디코딩 (검증용 체크섬 반환)
+uint64_t decodeStream(const std::vector<uint8_t>& stream) {
+    WireDeltaState state;
+    std::vector<WireTick> ticks;
+    std::vector<WireSample> samples;
+    uint64_t checksum = 0;
+
+    size_t pos = 0;
+    while (pos < stream.size()) {
+        WireFrameType type;
+        const uint8_t* payload;
+        uint32_t payloadSize;
+        size_t frameSize;
+        if (parseWireFrame(stream.data() + pos, stream.size() - pos, type, payload, payloadSize,
+                           frameSize) != WireParseResult::Ok) {
+            std::cerr << "parse error at " << pos << std::endl;
+            return 0;
+        }
+
+        if (type == WIRE_FRAME_SAMPLES) {
+            uint64_t timestampMs;
+            decodeWireSamples(payload, payloadSize, timestampMs, samples);
+            for (const auto& sample : samples) checksum += sample.values[WIRE_FIELD_POWER_USAGE];
+        } else if (type == WIRE_FRAME_BATCH) {
+            decodeWireBatch(payload, payloadSize, state, ticks);
+            for (const auto& tick : ticks) {
+                for (const auto& sample : tick.samples) checksum += sample.values[WIRE_FIELD_POWER_USAGE];
+            }
+        }
+        pos += frameSize;
+    }
+    return checksum;
+}
+
+double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void report(const std::string& name, size_t bytes, double encodeSeconds, double decodeSeconds,
+            const BenchOptions& options, size_t baselineBytes) {
+    double samples = static_cast<double>(options.ticks) * options.gpus;
+    std::printf("%-16s %10.1f B/tick %8.1fx  encode %7.1f M samples/s", name.c_str(),
+                static_cast<double>(bytes) / options.ticks,
+                static_cast<double>(baselineBytes) / bytes, samples / encodeSeconds / 1e6);
+    if (decodeSeconds > 0) {
+        std::printf("  decode %7.1f M samples/s", samples / decodeSeconds / 1e6);
+    }
+    std::printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string key = argv[i];
+        if (key == "--gpus") options.gpus = std::stoul(argv[i + 1]);
+        else if (key == "--ticks") options.ticks = std::stoul(argv[i + 1]);
+        else if (key == "--batch") options.batch = std::max(1ul, std::stoul(argv[i + 1]));
+        else if (key == "--keyframe") options.keyframe = std::max(1ul, std::stoul(argv[i + 1]));
+    }
+
+    std::vector<WireTick> ticks = makeTicks(options);
+    std::cout << "gpus=" << options.gpus << " ticks=" << options.ticks << std::endl;
+
+    // JSON (기준선)
+    std::string json;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& tick : ticks) {
+        encodeJson(tick, json);
+    }
+    double jsonEncode = seconds(start);
+    report("json", json.size(), jsonEncode, 0, options, json.size());
+
+    // v1: 틱당 SAMPLES 프레임 하나
+    std::vector<uint8_t> v1;
+    start = std::chrono::steady_clock::now();
+    {
+        WireEncoder encoder(v1);
+        for (const auto& tick : ticks) {
+            encoder.samples(tick.timestampMs, tick.samples.data(), tick.samples.size());
+        }
+    }
+    double v1Encode = seconds(start);
+    start = std::chrono::steady_clock::now();
+    uint64_t expected = decodeStream(v1);
+    report("v1 samples", v1.size(), v1Encode, seconds(start), options, json.size());
+
+    // v2: 델타 인코딩, 배치 크기 1과 지정값
+    for (unsigned int batch : {1u, options.batch}) {
+        std::vector<uint8_t> v2;
+        WireDeltaState state;
+        start = std::chrono::steady_clock::now();
+        {
+            WireEncoder encoder(v2);
+            unsigned int frames = 0;
+            for (size_t t = 0; t < ticks.size(); t += batch) {
+                size_t count = std::min<size_t>(batch, ticks.size() - t);
+                encoder.batch(ticks.data() + t, count, state, frames++ % options.keyframe == 0);
+            }
+        }
+        double v2Encode = seconds(start);
+        start = std::chrono::steady_clock::now();
+        uint64_t checksum = decodeStream(v2);
+        double v2Decode = seconds(start);
+
+        report("v2 batch=" + std::to_string(batch), v2.size(), v2Encode, v2Decode, options, json.size());
+        if (checksum != expected) {
+            std::cerr << "checksum mismatch: " << checksum << " != " << expected << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
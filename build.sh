@@ -72,10 +72,21 @@ if command -v cmake &> /dev/null; then
     make -j$(nproc)
 else
     echo "Using manual compilation..."
+    ZLIB_FLAGS=""
+    if [ -f /usr/include/zlib.h ]; then
+        ZLIB_FLAGS="-DNVML_HAVE_ZLIB -lz"
+    fi
     g++ -Wall -Wextra -O2 -std=c++17 \
         -I"$NVML_INCLUDE_DIR" \
-        ../main.cpp ../nvml_manager.cpp \
-        -L"$NVML_LIB_DIR" -lnvidia-ml -lpthread \
+        ../main.cpp ../nvml_manager.cpp ../nvml_vgpu.cpp ../nvml_media.cpp ../nvml_host.cpp ../nvml_intern.cpp ../nvml_util.cpp ../nvml_series.cpp \
+        ../nvml_socket.cpp ../nvml_wire.cpp ../nvml_aggregator.cpp ../nvml_stream.cpp \
+        ../nvml_spool.cpp ../nvml_http.cpp ../nvml_exporter.cpp ../nvml_cardinality.cpp ../nvml_sinks.cpp \
+        ../nvml_influx.cpp ../nvml_statsd.cpp ../nvml_live.cpp \
+        ../nvml_history.cpp ../nvml_arrow.cpp ../nvml_segment.cpp \
+        ../nvml_compaction.cpp ../nvml_checkpoint.cpp ../nvml_sketch.cpp ../nvml_topk.cpp \
+        ../nvml_window.cpp ../nvml_leak.cpp ../nvml_admission.cpp \
+        ../nvml_thermal.cpp \
+        -L"$NVML_LIB_DIR" -lnvidia-ml -lpthread $ZLIB_FLAGS \
         -o nvml_monitoring
 fi
 
@@ -1,32 +0,0 @@
-set(CMAKE_CUDA_COMPILER "/usr/local/cuda-12.6/bin/nvcc")
-set(CMAKE_CUDA_HOST_COMPILER "")
-set(CMAKE_CUDA_HOST_LINK_LAUNCHER "/usr/bin/g++")
-set(CMAKE_CUDA_COMPILER_ID "NVIDIA")
-set(CMAKE_CUDA_COMPILER_VERSION "12.6.85")
-set(CMAKE_CUDA_STANDARD_COMPUTED_DEFAULT "14")
-set(CMAKE_CUDA_SIMULATE_ID "")
-set(CMAKE_CUDA_SIMULATE_VERSION "")
-
-
-set(CMAKE_CUDA_COMPILER_ENV_VAR "CUDACXX")
-set(CMAKE_CUDA_HOST_COMPILER_ENV_VAR "CUDAHOSTCXX")
-
-set(CMAKE_CUDA_COMPILER_LOADED 1)
-set(CMAKE_CUDA_COMPILER_ID_RUN 1)
-set(CMAKE_CUDA_SOURCE_FILE_EXTENSIONS cu)
-set(CMAKE_CUDA_LINKER_PREFERENCE 15)
-set(CMAKE_CUDA_LINKER_PREFERENCE_PROPAGATES 1)
-
-set(CMAKE_CUDA_TOOLKIT_INCLUDE_DIRECTORIES "/usr/local/cuda-12.6/targets/x86_64-linux/include")
-
-set(CMAKE_CUDA_HOST_IMPLICIT_LINK_LIBRARIES "cudadevrt;cudart_static;rt;pthread;dl")
-set(CMAKE_CUDA_HOST_IMPLICIT_LINK_DIRECTORIES "/usr/local/cuda-12.6/targets/x86_64-linux/lib/stubs;/usr/local/cuda-12.6/targets/x86_64-linux/lib")
-set(CMAKE_CUDA_HOST_IMPLICIT_LINK_FRAMEWORK_DIRECTORIES "")
-
-set(CMAKE_CUDA_IMPLICIT_INCLUDE_DIRECTORIES "/usr/local/cuda-12.6/targets/x86_64-linux/include;/usr/include/c++/9;/usr/include/x86_64-linux-gnu/c++/9;/usr/include/c++/9/backward;/usr/lib/gcc/x86_64-linux-gnu/9/include;/usr/local/include;/usr/include/x86_64-linux-gnu;/usr/include")
-set(CMAKE_CUDA_IMPLICIT_LINK_LIBRARIES "cudadevrt;cudart_static;rt;pthread;dl;stdc++;m;gcc_s;gcc;c;gcc_s;gcc")
-set(CMAKE_CUDA_IMPLICIT_LINK_DIRECTORIES "/usr/local/cuda-12.6/targets/x86_64-linux/lib/stubs;/usr/local/cuda-12.6/targets/x86_64-linux/lib;/usr/lib/gcc/x86_64-linux-gnu/9;/usr/lib/x86_64-linux-gnu;/usr/lib;/lib/x86_64-linux-gnu;/lib")
-set(CMAKE_CUDA_IMPLICIT_LINK_FRAMEWORK_DIRECTORIES "")
-
-set(CMAKE_LINKER "/usr/bin/ld")
-set(CMAKE_MT "")
@@ -1 +0,0 @@
-#define NUM_PRELINKED_OBJECTS 0
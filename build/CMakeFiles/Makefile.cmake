@@ -1,56 +0,0 @@
-# CMAKE generated file: DO NOT EDIT!
-# Generated by "Unix Makefiles" Generator, CMake Version 3.16
-
-# The generator used is:
-set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
-
-# The top level Makefile was generated from the following files:
-set(CMAKE_MAKEFILE_DEPENDS
-  "CMakeCache.txt"
-  "../CMakeLists.txt"
-  "CMakeFiles/3.16.3/CMakeCUDACompiler.cmake"
-  "CMakeFiles/3.16.3/CMakeCXXCompiler.cmake"
-  "CMakeFiles/3.16.3/CMakeSystem.cmake"
-  "/usr/share/cmake-3.16/Modules/CMakeCUDAInformation.cmake"
-  "/usr/share/cmake-3.16/Modules/CMakeCXXInformation.cmake"
-  "/usr/share/cmake-3.16/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
-  "/usr/share/cmake-3.16/Modules/CMakeCommonLanguageInclude.cmake"
-  "/usr/share/cmake-3.16/Modules/CMakeGenericSystem.cmake"
-  "/usr/share/cmake-3.16/Modules/CMakeInitializeConfigs.cmake"
-  "/usr/share/cmake-3.16/Modules/CMakeLanguageInformation.cmake"
-  "/usr/share/cmake-3.16/Modules/CMakeSystemSpecificInformation.cmake"
-  "/usr/share/cmake-3.16/Modules/CMakeSystemSpecificInitialize.cmake"
-  "/usr/share/cmake-3.16/Modules/CheckCXXSourceCompiles.cmake"
-  "/usr/share/cmake-3.16/Modules/CheckIncludeFileCXX.cmake"
-  "/usr/share/cmake-3.16/Modules/CheckLibraryExists.cmake"
-  "/usr/share/cmake-3.16/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
-  "/usr/share/cmake-3.16/Modules/Compiler/GNU-CXX.cmake"
-  "/usr/share/cmake-3.16/Modules/Compiler/GNU.cmake"
-  "/usr/share/cmake-3.16/Modules/Compiler/NVIDIA-CUDA.cmake"
-  "/usr/share/cmake-3.16/Modules/FindCUDA.cmake"
-  "/usr/share/cmake-3.16/Modules/FindCUDA/select_compute_arch.cmake"
-  "/usr/share/cmake-3.16/Modules/FindPackageHandleStandardArgs.cmake"
-  "/usr/share/cmake-3.16/Modules/FindPackageMessage.cmake"
-  "/usr/share/cmake-3.16/Modules/FindThreads.cmake"
-  "/usr/share/cmake-3.16/Modules/Internal/CMakeCheckCompilerFlag.cmake"
-  "/usr/share/cmake-3.16/Modules/Platform/Linux-GNU-CXX.cmake"
-  "/usr/share/cmake-3.16/Modules/Platform/Linux-GNU.cmake"
-  "/usr/share/cmake-3.16/Modules/Platform/Linux.cmake"
-  "/usr/share/cmake-3.16/Modules/Platform/UnixPaths.cmake"
-  )
-
-# The corresponding makefile is:
-set(CMAKE_MAKEFILE_OUTPUTS
-  "Makefile"
-  "CMakeFiles/cmake.check_cache"
-  )
-
-# Byproducts of CMake generate step:
-set(CMAKE_MAKEFILE_PRODUCTS
-  "CMakeFiles/CMakeDirectoryInformation.cmake"
-  )
-
-# Dependency information for all targets:
-set(CMAKE_DEPEND_INFO_FILES
-  "CMakeFiles/nvml_monitoring.dir/DependInfo.cmake"
-  )
@@ -1,29 +0,0 @@
-# The set of languages for which implicit dependencies are needed:
-set(CMAKE_DEPENDS_LANGUAGES
-  "CXX"
-  )
-# The set of files for implicit dependencies of each language:
-set(CMAKE_DEPENDS_CHECK_CXX
-  "/home/pgw/NVML_test/main.cpp" "/home/pgw/NVML_test/build/CMakeFiles/nvml_monitoring.dir/main.cpp.o"
-  "/home/pgw/NVML_test/nvml_accounting.cpp" "/home/pgw/NVML_test/build/CMakeFiles/nvml_monitoring.dir/nvml_accounting.cpp.o"
-  "/home/pgw/NVML_test/nvml_field_queries.cpp" "/home/pgw/NVML_test/build/CMakeFiles/nvml_monitoring.dir/nvml_field_queries.cpp.o"
-  "/home/pgw/NVML_test/nvml_manager.cpp" "/home/pgw/NVML_test/build/CMakeFiles/nvml_monitoring.dir/nvml_manager.cpp.o"
-  "/home/pgw/NVML_test/nvml_mig.cpp" "/home/pgw/NVML_test/build/CMakeFiles/nvml_monitoring.dir/nvml_mig.cpp.o"
-  )
-set(CMAKE_CXX_COMPILER_ID "GNU")
-
-# The include file search paths:
-set(CMAKE_CXX_TARGET_INCLUDE_PATH
-  "/usr/local/cuda-12.6/include"
-  "/usr/local/cuda/include"
-  "/usr/local/cuda-12.6/targets/x86_64-linux/include"
-  "/include"
-  "../C:/Program Files/NVIDIA Corporation/NVSMI"
-  )
-
-# Targets to which this target links.
-set(CMAKE_TARGET_LINKED_INFO_FILES
-  )
-
-# Fortran module output directory.
-set(CMAKE_Fortran_TARGET_MODULE_DIR "")
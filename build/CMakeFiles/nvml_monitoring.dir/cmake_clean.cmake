@@ -1,14 +0,0 @@
-file(REMOVE_RECURSE
-  "CMakeFiles/nvml_monitoring.dir/main.cpp.o"
-  "CMakeFiles/nvml_monitoring.dir/nvml_accounting.cpp.o"
-  "CMakeFiles/nvml_monitoring.dir/nvml_field_queries.cpp.o"
-  "CMakeFiles/nvml_monitoring.dir/nvml_manager.cpp.o"
-  "CMakeFiles/nvml_monitoring.dir/nvml_mig.cpp.o"
-  "nvml_monitoring"
-  "nvml_monitoring.pdb"
-)
-
-# Per-language clean rules from dependency scanning.
-foreach(lang CXX)
-  include(CMakeFiles/nvml_monitoring.dir/cmake_clean_${lang}.cmake OPTIONAL)
-endforeach()
@@ -2,10 +2,36 @@
 #include "nvml_field_queries.cpp"
 #include "nvml_accounting.cpp"
 #include "nvml_mig.cpp"
+#include "nvml_aggregator.h"
+#include "nvml_stream.h"
+#include "nvml_sinks.h"
+#include "nvml_influx.h"
+#include "nvml_statsd.h"
+#include "nvml_live.h"
+#include "nvml_history.h"
+#include "nvml_arrow.h"
+#include "nvml_segment.h"
+#include "nvml_compaction.h"
+#include "nvml_checkpoint.h"
+#include "nvml_sketch.h"
+#include "nvml_topk.h"
+#include "nvml_leak.h"
+#include "nvml_admission.h"
+#include "nvml_thermal.h"
+#include "nvml_series.h"
+#include "nvml_cardinality.h"
+#include "nvml_util.h"
 #include <iostream>
 #include <iomanip>
 #include <thread>
 #include <chrono>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <cstdlib>
+#include <array>
+#include <unordered_map>
+#include <unistd.h>
 
 void printGPUInfo(const std::vector<GPUInfo>& gpus) {
     std::cout << "\n=== GPU Information ===" << std::endl;
@@ -43,7 +69,7 @@ void printProcessInfo(const std::vector<ProcessInfo>& processes) {
     
     std::cout << "Running Processes:" << std::endl;
     for (const auto& proc : processes) {
-        std::cout << "  PID " << proc.pid << " (" << proc.name << "): " 
+        std::cout << "  PID " << proc.pid << " (" << internedString(proc.nameId) << "): " 
                   << (proc.usedGpuMemory / 1024 / 1024) << " MB, Type: " 
                   << (proc.type == NVML_PROCESS_TYPE_COMPUTE ? "Compute" : "Graphics") << std::endl;
     }
@@ -66,6 +92,68 @@ void onEventReceived(const EventInfo& event) {
     std::cout << std::endl;
 }
 
+void onLeakWarning(const LeakReport& report) {
+    std::cout << "\n!!! GPU MEMORY LEAK SUSPECTED !!!" << std::endl;
+    std::cout << "GPU " << report.deviceIndex << " PID " << report.pid << " (" << report.name << "): "
+              << report.usedGpuMemory / (1024 * 1024) << " MiB, growing "
+              << static_cast<long long>(report.growthBytesPerHour / (1024 * 1024)) << " MiB/h" << std::endl;
+    std::cout << "Device memory exhausted in ~" << report.exhaustionMs / 60000 << " min" << std::endl;
+    std::cout << std::endl;
+}
+
+void onThermalWarning(const ThermalForecast& forecast) {
+    std::cout << "\n!!! GPU THERMAL SLOWDOWN RISK !!!" << std::endl;
+    std::cout << "GPU " << forecast.deviceIndex << ": " << forecast.temperature << "°C (slowdown at "
+              << forecast.slowdownTemperature << "°C), " << forecast.powerUsage / 1000 << " W" << std::endl;
+    if (forecast.throttling) {
+        std::cout << "Clocks are already thermally throttled" << std::endl;
+    } else {
+        std::cout << "Slowdown expected in ~" << forecast.timeToSlowdownMs / 1000 << " s (steady state "
+                  << static_cast<int>(forecast.steadyStateC) << "°C)" << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+// vGPU 인스턴스별 사용률을 시계열 레지스트리로 (스크레이프 때 /metrics에 붙는다)
+// (gpu, vgpu)마다 지표 4개의 id를 들고 있다가 set만 부른다. 쓸려서 set이 false면 키를 다시 만든다
+// 콜백은 수집 스레드에서만 불리므로 캐시는 잠그지 않는다
+struct VGPUSeriesCache {
+    static const int kMetricCount = 4;
+    std::unordered_map<uint64_t, std::array<SeriesId, kMetricCount>> ids;
+};
+
+void updateVGPUSeries(SeriesRegistry& series, VGPUSeriesCache& cache, const VGPUUpdate& update) {
+    static const char* const kMetrics[VGPUSeriesCache::kMetricCount] = {
+        "nvml_vgpu_sm_utilization_percent", "nvml_vgpu_memory_utilization_percent",
+        "nvml_vgpu_encoder_utilization_percent", "nvml_vgpu_decoder_utilization_percent"};
+    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      std::chrono::system_clock::now().time_since_epoch()).count();
+    for (const auto& sample : update.utilization) {
+        const unsigned int values[] = {sample.smUtil, sample.memUtil, sample.encUtil, sample.decUtil};
+        uint64_t instanceKey = (static_cast<uint64_t>(update.deviceIndex) << 32) | sample.vgpuInstance;
+        auto it = cache.ids.find(instanceKey);
+        if (it == cache.ids.end()) {
+            it = cache.ids.emplace(instanceKey, std::array<SeriesId, VGPUSeriesCache::kMetricCount>{}).first;
+        }
+        for (int i = 0; i < VGPUSeriesCache::kMetricCount; i++) {
+            SeriesId& id = it->second[i];
+            if (id != kInvalidSeriesId && series.set(id, values[i], now)) continue;
+            SeriesKey key(kMetrics[i]);
+            key.label("gpu", update.deviceIndex).label("vgpu", sample.vgpuInstance);
+            id = series.update(key, values[i], now);
+        }
+    }
+    // 없어진 인스턴스는 쓸기를 기다리지 않고 바로 뺀다
+    for (unsigned int instance : update.destroyed) {
+        auto it = cache.ids.find((static_cast<uint64_t>(update.deviceIndex) << 32) | instance);
+        if (it == cache.ids.end()) continue;
+        for (SeriesId id : it->second) {
+            if (id != kInvalidSeriesId) series.remove(id);
+        }
+        cache.ids.erase(it);
+    }
+}
+
 void onProcessUpdate(const std::vector<ProcessInfo>& processes) {
     static auto lastUpdate = std::chrono::steady_clock::now();
     auto now = std::chrono::steady_clock::now();
@@ -77,7 +165,217 @@ void onProcessUpdate(const std::vector<ProcessInfo>& processes) {
     }
 }
 
-int main() {
+void onUnitUpdate(const UnitInfo& unit) {
+    std::cout << "\n[Unit Update] " << unit.name << " (" << unit.serial << ")" << std::endl;
+    std::cout << "  Temperature: intake=" << unit.temperatures[UNIT_TEMPERATURE_INTAKE]
+              << "°C, exhaust=" << unit.temperatures[UNIT_TEMPERATURE_EXHAUST]
+              << "°C, board=" << unit.temperatures[UNIT_TEMPERATURE_BOARD] << "°C" << std::endl;
+    for (size_t i = 0; i < unit.fans.size(); i++) {
+        std::cout << "  Fan " << i << ": " << unit.fans[i].speed << " RPM"
+                  << (unit.fans[i].state == NVML_FAN_FAILED ? " (FAILED)" : "") << std::endl;
+    }
+    std::cout << "  PSU: " << unit.psuInfo.state << ", " << unit.psuInfo.voltage << "mV, "
+              << unit.psuInfo.current << "mA, " << unit.psuInfo.power << "mW" << std::endl;
+    std::cout << "  LED: " << (unit.ledState.color == NVML_LED_COLOR_AMBER ? "Amber" : "Green")
+              << " " << unit.ledState.cause << std::endl;
+}
+
+void printFleetRollups(FleetAggregator& aggregator) {
+    std::cout << "\n=== Fleet Rollups ===" << std::endl;
+    std::cout << "Series: " << aggregator.seriesCount()
+              << ", Samples: " << aggregator.totalSamples() << std::endl;
+    
+    for (const auto& histogram : aggregator.utilizationHistograms()) {
+        std::cout << "  " << histogram.model << " (" << histogram.gpuCount << " GPUs): ";
+        for (size_t b = 0; b < FLEET_HISTOGRAM_BUCKETS; b++) {
+            std::cout << (b * 10) << "%:" << histogram.buckets[b] << " ";
+        }
+        std::cout << std::endl;
+    }
+    
+    std::cout << "Top Hot GPUs:" << std::endl;
+    for (const auto& gpu : aggregator.topHotGPUs(10)) {
+        std::cout << "  " << gpu.node << " " << gpu.uuid << " (" << gpu.model << "): "
+                  << gpu.latest.values[WIRE_FIELD_GPU_UTIL] << "%, "
+                  << gpu.latest.values[WIRE_FIELD_TEMPERATURE] << "°C" << std::endl;
+    }
+}
+
+// 집계기 모드: 여러 에이전트의 바이너리 스트림을 받아 플릿 롤업을 유지
+int runAggregator(const std::string& address) {
+    std::cout << "NVML Fleet Aggregator" << std::endl;
+    std::cout << "=====================" << std::endl;
+    
+    FleetAggregator aggregator;
+    AggregatorServer server(aggregator);
+    if (!server.start(address)) {
+        std::cerr << "Failed to start aggregator on " << address << std::endl;
+        return -1;
+    }
+    std::cout << "Listening on " << address << std::endl;
+    std::cout << "Press Enter to stop..." << std::endl;
+    
+    std::atomic<bool> stopRequested(false);
+    std::thread inputThread([&stopRequested]() {
+        std::cin.get();
+        stopRequested = true;
+    });
+    
+    auto lastReport = std::chrono::steady_clock::now();
+    while (!stopRequested) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        if (std::chrono::steady_clock::now() - lastReport >= std::chrono::seconds(10)) {
+            printFleetRollups(aggregator);
+            lastReport = std::chrono::steady_clock::now();
+        }
+    }
+    
+    inputThread.join();
+    server.stop();
+    return 0;
+}
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n"
+              << "       " << program << " --aggregator <address>\n"
+              << "Options:\n"
+              << "  --stream <address>            stream ticks to an aggregator\n"
+              << "  --batch <ticks>               ticks per stream frame\n"
+              << "  --spool <directory>           spool unsent stream ticks to disk\n"
+              << "  --prometheus <address>        serve /metrics\n"
+              << "  --export-file <path>          write snapshots as JSON Lines\n"
+              << "  --log-interval <seconds>      log a snapshot summary\n"
+              << "  --influx <url>                write to InfluxDB\n"
+              << "  --influx-token <token>        InfluxDB API token\n"
+              << "  --statsd <address>            send DogStatsD metrics\n"
+              << "  --live <address>              serve the WebSocket live stream\n"
+              << "  --history <address>           serve history queries and analytics APIs\n"
+              << "  --history-dir <dir>           keep sealed history blocks in segment files\n"
+              << "  --history-io-rate <bytes/s>   limit segment compaction I/O\n"
+              << "  --export-arrow <path>         export history as an Arrow file and exit\n"
+              << "  --export-table device|process table to export (default device)\n"
+              << "  --export-range <duration>     export only the last <duration> (e.g. 24h)\n"
+              << "  --checkpoint <path>           checkpoint state and restore it on start\n"
+              << "  --checkpoint-interval <seconds>\n"
+              << "  --host on|off                 collect host CPU/memory/PSI\n"
+              << "  --max-process-series <n>      cap exported process series (0 = no limit)\n"
+              << "  --process-idle <seconds>      evict idle process series after this long\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc >= 3 && std::strcmp(argv[1], "--aggregator") == 0) {
+        return runAggregator(argv[2]);
+    }
+    
+    // 내보내기 옵션
+    //   --stream <address> [--batch <ticks>] [--spool <directory>]  집계기 바이너리 스트림
+    //   --prometheus <address>                                     /metrics HTTP 엔드포인트
+    //   --export-file <path>                                       JSON Lines 파일
+    //   --log-interval <seconds>                                   스냅샷 요약 로그
+    //   --influx <url> [--influx-token <token>]                    InfluxDB 라인 프로토콜 쓰기
+    //   --statsd <address>                                         DogStatsD (UDP 또는 unix 데이터그램)
+    //   --live <address>                                           WebSocket 실시간 스트림 (/live)
+    //   --history <address>                                        로컬 히스토리 질의 API (/api/query)
+    //                                                              + Arrow 내보내기 (/api/export)
+    //                                                              + 분위수 스케치 (/api/quantiles)
+    //                                                              + 프로세스 top-K (/api/top)
+    //                                                              + 메모리 누수 감지 (/api/leaks)
+    //                                                              + OOM 입장 판정 (/api/admission)
+    //                                                              + 열 감속 예측 (/api/thermal)
+    //   --history-dir <dir>                                        봉인된 히스토리 블록을 세그먼트 파일로 보관
+    //                                                              + 세그먼트 병렬 스캔 (/api/scan)
+    //   --export-arrow <path> [--export-table device|process]      세그먼트와 체크포인트의 히스토리를 Arrow 파일로
+    //                         [--export-range <duration>]          내보내고 끝낸다 (모니터링하지 않는다)
+    //   [--history-io-rate <bytes/s>]                              세그먼트 압축/다운샘플 I/O 속도 상한
+    //   --checkpoint <path> [--checkpoint-interval <seconds>]      메모리 상태 체크포인트, 시작 시 복원
+    //   --host on                                                  호스트 CPU/메모리/PSI를 스냅샷에 함께 수집
+    //   --max-process-series <n> [--process-idle <seconds>]        Prometheus/Influx/StatsD로 내보내는 프로세스 시계열 상한
+    //                                                              (넘치면 "other"로 합침, 0이면 제한 없음)
+    StreamClientConfig streamConfig;
+    std::string prometheusAddress;
+    std::string exportFile;
+    int logInterval = 0;
+    InfluxConfig influxConfig;
+    std::string statsdAddress;
+    std::string liveAddress;
+    std::string historyAddress;
+    std::string historyDirectory;
+    CompactionConfig compactionConfig;
+    CheckpointConfig checkpointConfig;
+    std::string arrowExportPath;
+    ArrowExportRequest arrowExport;
+    bool hostMonitoring = false;
+    CardinalityConfig cardinalityConfig;
+    // 옵션은 모두 값을 하나 받는다. 모르는 옵션이나 값이 빠진 옵션은 조용히 넘기지 않는다
+    for (int i = 1; i < argc; i += 2) {
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << argv[i] << std::endl;
+            printUsage(argv[0]);
+            return -1;
+        }
+        if (std::strcmp(argv[i], "--stream") == 0) {
+            streamConfig.address = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--batch") == 0) {
+            streamConfig.ticksPerFrame = std::strtoul(argv[i + 1], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--spool") == 0) {
+            streamConfig.spool.directory = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--prometheus") == 0) {
+            prometheusAddress = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--export-file") == 0) {
+            exportFile = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--log-interval") == 0) {
+            logInterval = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--influx") == 0) {
+            influxConfig.url = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--influx-token") == 0) {
+            influxConfig.token = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--statsd") == 0) {
+            statsdAddress = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--live") == 0) {
+            liveAddress = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--history") == 0) {
+            historyAddress = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--history-dir") == 0) {
+            historyDirectory = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--export-arrow") == 0) {
+            arrowExportPath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--export-table") == 0) {
+            if (std::strcmp(argv[i + 1], "device") == 0) {
+                arrowExport.table = HistoryTable::Device;
+            } else if (std::strcmp(argv[i + 1], "process") == 0) {
+                arrowExport.table = HistoryTable::Process;
+            } else {
+                std::cerr << "Unknown table " << argv[i + 1] << std::endl;
+                return -1;
+            }
+        } else if (std::strcmp(argv[i], "--export-range") == 0) {
+            int64_t range = 0;
+            if (!parseHistoryDuration(argv[i + 1], range)) {
+                std::cerr << "Invalid duration " << argv[i + 1] << std::endl;
+                return -1;
+            }
+            arrowExport.start = nowMillis() - range;
+        } else if (std::strcmp(argv[i], "--history-io-rate") == 0) {
+            compactionConfig.ioBytesPerSecond = std::strtoull(argv[i + 1], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--checkpoint") == 0) {
+            checkpointConfig.path = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--checkpoint-interval") == 0) {
+            checkpointConfig.intervalMs = std::atoll(argv[i + 1]) * 1000;
+        } else if (std::strcmp(argv[i], "--host") == 0) {
+            hostMonitoring = std::strcmp(argv[i + 1], "on") == 0;
+        } else if (std::strcmp(argv[i], "--max-process-series") == 0) {
+            for (auto& limit : cardinalityConfig.limits) {
+                limit.maxSeries = std::strtoul(argv[i + 1], nullptr, 10);
+            }
+        } else if (std::strcmp(argv[i], "--process-idle") == 0) {
+            cardinalityConfig.idleMs = std::atoll(argv[i + 1]) * 1000;
+        } else {
+            std::cerr << "Unknown option " << argv[i] << std::endl;
+            printUsage(argv[0]);
+            return -1;
+        }
+    }
+    
     std::cout << "NVML GPU Monitoring System" << std::endl;
     std::cout << "=========================" << std::endl;
     
@@ -181,6 +479,235 @@ int main() {
     manager.setMetricsCallback(onMetricsUpdate);
     manager.setEventCallback(onEventReceived);
     manager.setProcessCallback(onProcessUpdate);
+    manager.setUnitCallback(onUnitUpdate);
+    
+    // 내보내기 파이프라인: 수집 스레드는 틱마다 스냅샷을 한 번 넘기기만 하고
+    // 각 싱크는 자기 큐/스레드에서 배치, 재시도한다
+    CardinalityLimiter cardinality(cardinalityConfig);
+    ExporterPipeline pipeline;
+    pipeline.setCardinalityLimiter(&cardinality);
+    HttpServer httpServer;
+    HttpServer liveServer;
+    LiveStreamHub liveHub;
+    HttpServer historyServer;
+    MetricHistory history;
+    MetricSketches sketches;
+    HeavyHitterTracker topk;
+    LeakDetector leaks;
+    AdmissionController admission(AdmissionConfig(), &leaks);
+    ThermalForecaster thermal;
+    SeriesRegistry metricSeries;   // /metrics의 GPU, 프로세스, vGPU 시계열
+    VGPUSeriesCache vgpuSeriesIds;
+    std::unique_ptr<SegmentStore> segmentStore;
+    std::unique_ptr<SegmentCompactor> compactor;
+    std::unique_ptr<CheckpointManager> checkpoint;
+    std::unique_ptr<WireStreamClient> streamClient;
+    
+    if (!streamConfig.address.empty()) {
+        char hostname[256] = {};
+        gethostname(hostname, sizeof(hostname) - 1);
+        streamConfig.nodeName = hostname;
+        
+        streamClient = std::make_unique<WireStreamClient>(streamConfig);
+        streamClient->setDevices(makeWireDevices(gpus));
+        if (streamClient->start()) {
+            std::cout << "Streaming to " << streamConfig.address << std::endl;
+            pipeline.addSink(std::make_unique<StreamSink>(*streamClient));
+        } else {
+            streamClient.reset();
+        }
+    }
+    if (!prometheusAddress.empty()) {
+        if (httpServer.start(prometheusAddress)) {
+            std::cout << "Serving metrics on " << prometheusAddress << "/metrics" << std::endl;
+            SinkConfig config;
+            config.queueCapacity = 10; // 최신 값만 의미가 있다
+            config.limitCardinality = true;
+            pipeline.addSink(std::make_unique<PrometheusSink>(httpServer, gpus, &pipeline, &metricSeries), config);
+            metricSeries.describe("nvml_vgpu_sm_utilization_percent", "gauge", "vGPU SM utilization.");
+            metricSeries.describe("nvml_vgpu_memory_utilization_percent", "gauge", "vGPU memory utilization.");
+            metricSeries.describe("nvml_vgpu_encoder_utilization_percent", "gauge", "vGPU encoder utilization.");
+            metricSeries.describe("nvml_vgpu_decoder_utilization_percent", "gauge", "vGPU decoder utilization.");
+            metricSeries.start();
+            manager.setVGPUCallback([&metricSeries, &vgpuSeriesIds](const VGPUUpdate& update) {
+                updateVGPUSeries(metricSeries, vgpuSeriesIds, update);
+            });
+        }
+    }
+    if (!exportFile.empty()) {
+        SinkConfig config;
+        config.maxBatchDelayMs = 5000;
+        pipeline.addSink(std::make_unique<FileSink>(exportFile), config);
+    }
+    if (logInterval > 0) {
+        pipeline.addSink(std::make_unique<LogSink>(std::cout, logInterval));
+    }
+    if (!influxConfig.url.empty()) {
+        std::cout << "Writing to InfluxDB at " << influxConfig.url << std::endl;
+        SinkConfig config;
+        config.maxRetries = 10; // 실패 중에도 싱크 버퍼에 쌓아 둔다
+        config.limitCardinality = true;
+        pipeline.addSink(std::make_unique<InfluxSink>(influxConfig, gpus), config);
+    }
+    if (!statsdAddress.empty()) {
+        std::cout << "Sending StatsD metrics to " << statsdAddress << std::endl;
+        StatsdConfig config;
+        config.address = statsdAddress;
+        SinkConfig sinkConfig;
+        sinkConfig.queueCapacity = 10; // 밀린 틱을 몰아 보내도 의미가 적다
+        sinkConfig.limitCardinality = true;
+        pipeline.addSink(std::make_unique<StatsdSink>(config, gpus), sinkConfig);
+    }
+    if (!liveAddress.empty() && liveHub.start()) {
+        liveServer.upgrade("/live", [&liveHub](const HttpRequest& request, int fd, const std::string& input) {
+            return liveHub.accept(request, fd, input);
+        });
+        if (liveServer.start(liveAddress)) {
+            std::cout << "Live stream on " << liveAddress << " (WebSocket /live)" << std::endl;
+            SinkConfig config;
+            config.queueCapacity = 2; // 느린 구독자는 허브에서 프레임을 건너뛴다
+            pipeline.addSink(std::make_unique<LiveSink>(liveHub), config);
+        }
+    }
+    // 누수/열 경고는 콘솔로 나가므로 히스토리 서버 없이도 돈다 (/api/leaks, /api/thermal만 서버에 붙는다)
+    leaks.setWarningCallback(onLeakWarning);
+    pipeline.addSink(std::make_unique<LeakSink>(leaks));
+    thermal.setDevices(gpus);
+    thermal.setWarningCallback(onThermalWarning);
+    pipeline.addSink(std::make_unique<ThermalSink>(thermal));
+    // 분위수 스케치는 체크포인트로 이어지므로 서버 없이도 쌓는다. 샘플 하나를 빠뜨려도 분위수가 틀어지므로
+    // 큐를 넉넉히 잡고, 그래도 넘치면 nvml_exporter_dropped_total{sink="sketch"}로 센다
+    sketches.setDevices(gpus);
+    {
+        SinkConfig config;
+        config.queueCapacity = 3600;
+        config.maxBatch = 60;
+        pipeline.addSink(std::make_unique<SketchSink>(sketches), config);
+    }
+    // --export-arrow는 히스토리와 세그먼트 저장소만 열어 체크포인트를 복원한 뒤 내보내고 끝낸다
+    bool exportOnly = !arrowExportPath.empty();
+    bool historyEnabled = !historyAddress.empty() || exportOnly;
+    if (historyEnabled) {
+        history.setDevices(gpus);
+        registerHistoryApi(historyServer, history);
+        registerSketchApi(historyServer, sketches);
+        registerTopKApi(historyServer, topk);
+        registerLeakApi(historyServer, leaks);
+        admission.setDevices(gpus);
+        registerAdmissionApi(historyServer, admission);
+        registerThermalApi(historyServer, thermal);
+        if (!historyDirectory.empty()) {
+            SegmentStoreConfig segmentConfig;
+            segmentConfig.directory = historyDirectory;
+            segmentStore = std::make_unique<SegmentStore>(history, segmentConfig);
+            if (segmentStore->open()) {
+                SegmentStore* store = segmentStore.get();
+                history.setSealCallback([store](const HistoryBlockPtr& block) { store->add(block); });
+                registerSegmentScanApi(historyServer, history, *segmentStore);
+                if (!exportOnly) {
+                    compactor = std::make_unique<SegmentCompactor>(*segmentStore, compactionConfig);
+                    compactor->start();
+                }
+                std::cout << "History segments in " << historyDirectory << ", scans on /api/scan" << std::endl;
+            }
+        }
+        registerArrowExportApi(historyServer, history, segmentStore.get());
+        if (!exportOnly && historyServer.start(historyAddress)) {
+            std::cout << "History queries on " << historyAddress << "/api/query, Arrow export on /api/export, "
+                      << "quantiles on /api/quantiles, top processes on /api/top, "
+                      << "leaks on /api/leaks, admission checks on /api/admission, "
+                      << "thermal forecasts on /api/thermal" << std::endl;
+            pipeline.addSink(std::make_unique<HistorySink>(history));
+            pipeline.addSink(std::make_unique<TopKSink>(topk));
+            pipeline.addSink(std::make_unique<AdmissionSink>(admission));
+        }
+    }
+    
+    // 체크포인트: 재시작 전의 히스토리와 수집 커서를 되살린 뒤 수집을 시작한다
+    if (!checkpointConfig.path.empty()) {
+        checkpoint = std::make_unique<CheckpointManager>(checkpointConfig);
+        std::vector<std::string> uuids;
+        for (const auto& gpu : gpus) {
+            uuids.push_back(gpu.uuid);
+        }
+        checkpoint->setFingerprint(uuids);
+        manager.registerCheckpoint(*checkpoint);
+        if (historyEnabled) {
+            // 세그먼트 저장소가 있으면 파일에 아직 없는 블록만 (활성 블록과 쓰기 대기 블록) 저장한다
+            SegmentStore* store = segmentStore.get();
+            auto persistedUntil = [store](int64_t* until) {
+                until[0] = store->persistedUntil(HistoryTable::Device);
+                until[1] = store->persistedUntil(HistoryTable::Process);
+                return until;
+            };
+            CheckpointSection section;
+            section.name = "history";
+            section.version = 2;
+            section.save = [&history, store, persistedUntil](CheckpointWriter& writer) {
+                int64_t until[2];
+                history.saveCheckpoint(writer, store ? persistedUntil(until) : nullptr);
+            };
+            section.restore = [&history, store, persistedUntil](CheckpointReader& reader) {
+                int64_t until[2];
+                return history.restoreCheckpoint(reader, store ? persistedUntil(until) : nullptr);
+            };
+            checkpoint->addSection(section);
+            
+            section.version = 1;
+            section.name = "topk";
+            section.save = [&topk](CheckpointWriter& writer) { topk.saveCheckpoint(writer); };
+            section.restore = [&topk](CheckpointReader& reader) { return topk.restoreCheckpoint(reader); };
+            checkpoint->addSection(section);
+            
+            section.name = "admission";
+            section.version = 2; // 2: MIG 슬라이스 대상
+            section.save = [&admission](CheckpointWriter& writer) { admission.saveCheckpoint(writer); };
+            section.restore = [&admission](CheckpointReader& reader) { return admission.restoreCheckpoint(reader); };
+            checkpoint->addSection(section);
+        }
+        CheckpointSection section;
+        section.name = "sketches";
+        section.save = [&sketches](CheckpointWriter& writer) { sketches.saveCheckpoint(writer); };
+        section.restore = [&sketches](CheckpointReader& reader) { return sketches.restoreCheckpoint(reader); };
+        checkpoint->addSection(section);
+        
+        section.name = "leaks";
+        section.bootScoped = true;
+        section.save = [&leaks](CheckpointWriter& writer) { leaks.saveCheckpoint(writer); };
+        section.restore = [&leaks](CheckpointReader& reader) { return leaks.restoreCheckpoint(reader); };
+        checkpoint->addSection(section);
+        
+        section.name = "thermal";
+        section.bootScoped = false;
+        section.save = [&thermal](CheckpointWriter& writer) { thermal.saveCheckpoint(writer); };
+        section.restore = [&thermal](CheckpointReader& reader) { return thermal.restoreCheckpoint(reader); };
+        checkpoint->addSection(section);
+        
+        std::string error;
+        if (checkpoint->restore(error)) {
+            auto stats = checkpoint->getStats();
+            std::cout << "Checkpoint restored: " << stats.sectionsRestored << " sections ("
+                      << stats.sectionsSkipped << " skipped) in " << stats.restoreMs << " ms" << std::endl;
+        } else {
+            std::cout << "Checkpoint not restored: " << error << std::endl;
+        }
+        if (!exportOnly) checkpoint->start();
+    }
+    
+    if (exportOnly) {
+        std::string error;
+        if (!exportHistoryArrow(history, arrowExport, arrowExportPath, error, segmentStore.get())) {
+            std::cerr << "Arrow export failed: " << error << std::endl;
+            return -1;
+        }
+        std::cout << "History exported to " << arrowExportPath << std::endl;
+        return 0;
+    }
+    
+    pipeline.start();
+    manager.setSnapshotCallback([&pipeline](const MetricsSnapshot& snapshot) {
+        pipeline.publish(snapshot);
+    });
     
     // 이벤트 등록
     for (size_t i = 0; i < gpus.size(); i++) {
@@ -196,6 +723,9 @@ int main() {
     std::cout << "\n=== Starting Real-time Monitoring ===" << std::endl;
     std::cout << "Press Enter to stop monitoring..." << std::endl;
     
+    if (hostMonitoring && !manager.setHostMonitoring(true)) {
+        std::cerr << "Warning: Host metrics disabled" << std::endl;
+    }
     manager.setMonitoringInterval(1000); // 1초 간격
     manager.startMonitoring();
     
@@ -213,6 +743,26 @@ int main() {
                       << "MB, Used: " << (bar1Info.bar1Used / 1024 / 1024) 
                       << "MB, Free: " << (bar1Info.bar1Free / 1024 / 1024) << "MB" << std::endl;
         }
+        
+        auto media = manager.getMediaStats(i);
+        std::cout << "Encoder: " << media.encoderUtilization << "% (" << media.encoderSessionCount
+                  << " sessions, " << media.encoderAverageFps << " fps, H.264 capacity "
+                  << media.encoderCapacity[MEDIA_CODEC_H264] << "%), Decoder: "
+                  << media.decoderUtilization << "%" << std::endl;
+        for (const auto& session : media.encoderSessions) {
+            std::cout << "  Encoder Session " << session.sessionId << " (PID " << session.pid << "): "
+                      << session.hResolution << "x" << session.vResolution << ", "
+                      << session.averageFps << " fps, " << session.averageLatency << " us" << std::endl;
+        }
+        
+        auto vgpus = manager.getVGPUInfo(i);
+        for (const auto& vgpu : vgpus) {
+            std::cout << "vGPU " << vgpu.vgpuInstance << " (" << internedString(vgpu.typeNameId) << ", VM "
+                      << internedString(vgpu.vmId) << "): "
+                      << "FB " << (vgpu.framebufferUsed / 1024 / 1024) << "MB / "
+                      << (vgpu.framebufferSize / 1024 / 1024) << "MB, Encoder Sessions: "
+                      << vgpu.encoderSessionCount << std::endl;
+        }
     }
     
     // 사용자 입력 대기
@@ -222,6 +772,45 @@ int main() {
     std::cout << "\nStopping monitoring..." << std::endl;
     manager.stopMonitoring();
     
+    pipeline.stop();
+    httpServer.stop();
+    metricSeries.stop();
+    liveServer.stop();
+    liveHub.stop();
+    historyServer.stop();
+    if (compactor) {
+        compactor->stop();
+        auto stats = compactor->getStats();
+        std::cout << "Compaction: " << stats.merges << " merges, " << stats.downsamples << " downsamples, "
+                  << stats.segmentsExpired << " expired, " << stats.bytesWritten << " bytes written, "
+                  << stats.failures << " failures" << std::endl;
+    }
+    if (segmentStore) {
+        history.flush();
+        segmentStore->flush();
+    }
+    if (checkpoint) {
+        checkpoint->stop();
+        std::string error;
+        if (!checkpoint->save(error)) {
+            std::cerr << "Final checkpoint failed: " << error << std::endl;
+        }
+    }
+    for (const auto& sink : pipeline.getMetrics()) {
+        std::cout << "Sink " << sink.name << ": " << sink.exported << "/" << sink.enqueued << " exported, "
+                  << sink.dropped << " dropped, " << sink.failed << " failed, " << sink.retries << " retries"
+                  << std::endl;
+    }
+    
+    if (streamClient) {
+        streamClient->stop();
+        auto stats = streamClient->getStats();
+        std::cout << "Stream: " << stats.ticksAcked << "/" << stats.ticksSubmitted << " ticks acked, "
+                  << stats.framesSent << " frames, " << stats.bytesSent << " bytes, "
+                  << stats.reconnects << " reconnects, " << stats.ticksDropped << " dropped, "
+                  << stats.ticksSpooled << " spooled, " << stats.ticksReplayed << " replayed" << std::endl;
+    }
+    
     std::cout << "Monitoring stopped. Goodbye!" << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,260 @@
+#include "nvml_admission.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+const double kBytesPerMiB = 1024.0 * 1024.0;
+const double kMsPerHour = 3600.0 * 1000.0;
+const double kMinStddevBytes = kBytesPerMiB; // 변동이 없으면 사실상 계단 함수
+
+// "20GiB", "20G", "512MiB", "1.5e9" (단위 없으면 bytes, G/M/K는 2의 거듭제곱)
+bool parseBytes(const std::string& text, double& bytes) {
+    char* end = nullptr;
+    double value = std::strtod(text.c_str(), &end);
+    if (end == text.c_str() || value < 0) return false;
+    std::string unit(end);
+    if (unit.empty() || unit == "B") bytes = value;
+    else if (unit == "K" || unit == "KiB" || unit == "KB") bytes = value * 1024;
+    else if (unit == "M" || unit == "MiB" || unit == "MB") bytes = value * kBytesPerMiB;
+    else if (unit == "G" || unit == "GiB" || unit == "GB") bytes = value * kBytesPerMiB * 1024;
+    else return false;
+    return true;
+}
+
+AdmissionResult evaluate(const AdmissionModel& model, double reserveBytes, double requestBytes, int64_t horizonMs,
+                         int64_t nowMs) {
+    AdmissionResult result;
+    result.target = model.name;
+    result.found = true;
+    result.modelAgeMs = nowMs - model.updatedMs;
+    result.totalBytes = model.totalBytes;
+
+    double base = std::max(model.usedBytes, model.meanBytes);
+    double spikes = std::max(0.0, model.peakBytes - model.meanBytes);
+    double growth = model.growthBytesPerHour * horizonMs / kMsPerHour;
+    result.predictedPeakBytes = std::min(model.totalBytes, base + growth + spikes);
+    result.headroomBytes = model.totalBytes - reserveBytes - result.predictedPeakBytes;
+
+    // P(요청 + 예상 최고치 <= total - reserve), 예상 최고치 ~ N(predictedPeak, stddev)
+    double sigma = std::max(model.stddevBytes, kMinStddevBytes);
+    double margin = result.headroomBytes - requestBytes;
+    result.fitProbability = 0.5 * std::erfc(-margin / (sigma * std::sqrt(2.0)));
+    return result;
+}
+
+void appendResult(const AdmissionResult& result, bool withProbability, std::string& out) {
+    out += "{\"target\":";
+    appendJsonString(result.target, out);
+    out += ",\"total\":";
+    appendNumber(result.totalBytes, out);
+    out += ",\"predictedPeak\":";
+    appendNumber(std::round(result.predictedPeakBytes), out);
+    out += ",\"headroom\":";
+    appendNumber(std::round(result.headroomBytes), out);
+    if (withProbability) {
+        out += ",\"fitProbability\":";
+        appendNumber(result.fitProbability, out, 6);
+    }
+    out += ",\"modelAgeMs\":";
+    appendNumber(static_cast<double>(result.modelAgeMs), out);
+    out.push_back('}');
+}
+
+} // namespace
+
+AdmissionController::AdmissionController(const AdmissionConfig& config, const LeakDetector* leaks)
+    : config(config), leaks(leaks), models(std::make_shared<const std::vector<AdmissionModel>>()) {}
+
+AdmissionController::Target& AdmissionController::targetFor(const std::string& name, bool slice) {
+    auto it = targetIndex.find(name);
+    if (it != targetIndex.end()) return targets[it->second];
+    targetIndex[name] = targets.size();
+    targets.push_back({name, slice ? name : "", slice, 0, SlidingWindow(config.peakWindowMs), 0, 0, 0});
+    return targets.back();
+}
+
+void AdmissionController::setDevices(const std::vector<GPUInfo>& gpus) {
+    std::lock_guard<std::mutex> lock(updateMutex);
+    for (const auto& gpu : gpus) {
+        Target& target = targetFor(std::to_string(gpu.index), false);
+        target.uuid = gpu.uuid;
+        target.deviceIndex = gpu.index;
+        target.totalBytes = static_cast<double>(gpu.totalMemory);
+    }
+}
+
+void AdmissionController::add(const MetricsSnapshot& snapshot) {
+    int64_t ts = std::chrono::duration_cast<std::chrono::milliseconds>(snapshot.timestamp.time_since_epoch()).count();
+
+    std::lock_guard<std::mutex> lock(updateMutex);
+    if (leaks) deviceGrowth = leaks->deviceGrowthRates();
+    for (const auto& m : snapshot.devices) {
+        if (m.memoryTotal == 0) continue;
+        Target& target = targetFor(std::to_string(m.deviceIndex), false);
+        target.deviceIndex = m.deviceIndex;
+        target.usedMiB.add(ts, m.memoryUsed / kBytesPerMiB);
+        target.updatedMs = ts;
+        target.totalBytes = static_cast<double>(m.memoryTotal);
+        target.usedBytes = static_cast<double>(m.memoryUsed);
+    }
+    for (const auto& slice : snapshot.migSlices) {
+        if (slice.totalBytes == 0) continue;
+        addSlice(internedString(slice.uuidId), slice.deviceIndex, ts, slice.usedBytes, slice.totalBytes);
+    }
+    publish();
+}
+
+void AdmissionController::updateSlice(const std::string& uuid, unsigned int deviceIndex, int64_t timestampMs,
+                                      unsigned long long usedBytes, unsigned long long totalBytes) {
+    std::lock_guard<std::mutex> lock(updateMutex);
+    addSlice(uuid, deviceIndex, timestampMs, usedBytes, totalBytes);
+    publish();
+}
+
+void AdmissionController::addSlice(const std::string& uuid, unsigned int deviceIndex, int64_t timestampMs,
+                                   unsigned long long usedBytes, unsigned long long totalBytes) {
+    Target& target = targetFor(uuid, true);
+    target.deviceIndex = deviceIndex;
+    target.usedMiB.add(timestampMs, usedBytes / kBytesPerMiB);
+    target.updatedMs = timestampMs;
+    target.totalBytes = static_cast<double>(totalBytes);
+    target.usedBytes = static_cast<double>(usedBytes);
+}
+
+void AdmissionController::publish() {
+    auto built = std::make_shared<std::vector<AdmissionModel>>();
+    built->reserve(targets.size());
+    for (const auto& target : targets) {
+        if (target.usedMiB.size() == 0) continue;
+        WindowAggregate aggregate = target.usedMiB.aggregate();
+        AdmissionModel model;
+        model.name = target.name;
+        model.uuid = target.uuid;
+        model.slice = target.slice;
+        model.updatedMs = target.updatedMs;
+        model.totalBytes = target.totalBytes;
+        model.usedBytes = target.usedBytes;
+        model.meanBytes = aggregate.mean() * kBytesPerMiB;
+        model.peakBytes = aggregate.max * kBytesPerMiB;
+        model.stddevBytes = std::sqrt(aggregate.variance()) * kBytesPerMiB;
+        // LeakDetector 증가율은 GPU 단위라 슬라이스에 나눠 붙일 수 없다
+        model.growthBytesPerHour = !target.slice && target.deviceIndex < deviceGrowth.size()
+                                       ? deviceGrowth[target.deviceIndex] : 0;
+        built->push_back(std::move(model));
+    }
+
+    std::lock_guard<std::mutex> lock(modelMutex);
+    models = std::move(built);
+}
+
+std::shared_ptr<const std::vector<AdmissionModel>> AdmissionController::getModels() const {
+    std::lock_guard<std::mutex> lock(modelMutex);
+    return models;
+}
+
+AdmissionResult AdmissionController::check(const std::string& target, double requestBytes, int64_t horizonMs,
+                                           int64_t nowMs) const {
+    auto current = getModels();
+    for (const auto& model : *current) {
+        if (model.name == target || (!model.uuid.empty() && model.uuid == target)) {
+            return evaluate(model, static_cast<double>(config.reserveBytes), requestBytes,
+                            horizonMs > 0 ? horizonMs : config.defaultHorizonMs, nowMs);
+        }
+    }
+    AdmissionResult result{};
+    result.target = target;
+    result.found = false;
+    return result;
+}
+
+void AdmissionController::saveCheckpoint(CheckpointWriter& writer) const {
+    std::lock_guard<std::mutex> lock(updateMutex);
+    writer.put<uint32_t>(static_cast<uint32_t>(targets.size()));
+    for (const auto& target : targets) {
+        writer.putString(target.name);
+        writer.putString(target.uuid);
+        writer.put<uint8_t>(target.slice ? 1 : 0);
+        writer.put<uint32_t>(target.deviceIndex);
+        writer.put<int64_t>(target.updatedMs);
+        writer.put<double>(target.totalBytes);
+        writer.put<double>(target.usedBytes);
+        target.usedMiB.saveCheckpoint(writer);
+    }
+}
+
+bool AdmissionController::restoreCheckpoint(CheckpointReader& reader) {
+    uint32_t count = reader.get<uint32_t>();
+    if (!reader.good()) return false;
+
+    std::vector<Target> restored;
+    std::unordered_map<std::string, size_t> restoredIndex;
+    for (uint32_t i = 0; i < count; i++) {
+        std::string name = reader.getString();
+        std::string uuid = reader.getString();
+        Target target{name, uuid, false, 0, SlidingWindow(config.peakWindowMs), 0, 0, 0};
+        target.slice = reader.get<uint8_t>() != 0;
+        target.deviceIndex = reader.get<uint32_t>();
+        target.updatedMs = reader.get<int64_t>();
+        target.totalBytes = reader.get<double>();
+        target.usedBytes = reader.get<double>();
+        if (!target.usedMiB.restoreCheckpoint(reader) || !reader.good()) return false;
+        restoredIndex[target.name] = restored.size();
+        restored.push_back(std::move(target));
+    }
+
+    std::lock_guard<std::mutex> lock(updateMutex);
+    targets = std::move(restored);
+    targetIndex = std::move(restoredIndex);
+    publish();
+    return true;
+}
+
+void registerAdmissionApi(HttpServer& server, const AdmissionController& controller, const std::string& path) {
+    server.route(path, [&controller](const HttpRequest& request, HttpResponse& response) {
+        response.contentType = "application/json";
+
+        double need = 0;
+        std::string needText = request.queryParam("need");
+        if (!needText.empty() && !parseBytes(needText, need)) {
+            response.status = 400;
+            response.body = errorJson("invalid need");
+            return;
+        }
+        int64_t horizon = 0;
+        std::string horizonText = request.queryParam("horizon");
+        if (!horizonText.empty() && (!parseHistoryDuration(horizonText, horizon) || horizon <= 0)) {
+            response.status = 400;
+            response.body = errorJson("invalid horizon");
+            return;
+        }
+        int64_t now = nowMillis();
+
+        std::string target = request.queryParam("gpu");
+        if (!target.empty()) {
+            AdmissionResult result = controller.check(target, need, horizon, now);
+            if (!result.found) {
+                response.status = 404;
+                response.body = errorJson("unknown gpu");
+                return;
+            }
+            response.body.clear();
+            appendResult(result, true, response.body);
+            response.body += "\n";
+            return;
+        }
+
+        std::string& out = response.body;
+        out = "{\"targets\":[";
+        bool first = true;
+        for (const auto& model : *controller.getModels()) {
+            if (!first) out.push_back(',');
+            first = false;
+            appendResult(controller.check(model.name, need, horizon, now), !needText.empty(), out);
+        }
+        out += "]}\n";
+    });
+}
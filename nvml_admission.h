@@ -0,0 +1,113 @@
+#ifndef NVML_ADMISSION_H
+#define NVML_ADMISSION_H
+
+#include "nvml_leak.h"
+#include "nvml_window.h"
+
+struct AdmissionConfig {
+    int64_t peakWindowMs = 60 * 60 * 1000;              // 최근 최고치/변동을 볼 창
+    unsigned long long reserveBytes = 256ULL << 20;     // CUDA 컨텍스트, 단편화 여유
+    int64_t defaultHorizonMs = 60 * 60 * 1000;
+};
+
+// 대상(GPU 또는 MIG 슬라이스) 하나의 캐시된 모델. 틱마다 새로 만들어 통째로 바꾼다
+struct AdmissionModel {
+    std::string name;               // GPU 인덱스 또는 MIG uuid
+    std::string uuid;
+    bool slice;
+    int64_t updatedMs;
+    double totalBytes;
+    double usedBytes;
+    double meanBytes;               // 창 평균
+    double peakBytes;               // 창 최고치
+    double stddevBytes;             // 창 표준편차
+    double growthBytesPerHour;      // 증가 중인 프로세스 기울기 합 (슬라이스는 0)
+};
+
+struct AdmissionResult {
+    std::string target;
+    bool found;
+    int64_t modelAgeMs;
+    double totalBytes;
+    double predictedPeakBytes;      // 창 끝까지의 예상 최고 사용량 (요청 제외)
+    double headroomBytes;           // total - reserve - predictedPeak
+    double fitProbability;          // 요청을 더해도 창 동안 넘치지 않을 확률 (요청이 없으면 1)
+};
+
+// 예측 OOM 입장 판정
+// 예상 최고 사용량 = max(현재, 창 평균) + 증가율 x horizon + (창 최고치 - 창 평균)
+// 사용량 변동을 평균 주변의 정규분포(창 표준편차)로 보고 요청량이 남는 공간에 들어갈 확률을 구한다.
+// 질의는 NVML을 부르지 않고 마지막 틱의 모델만 읽는다 (shared_ptr 하나 복사 + 산술)
+class AdmissionController {
+private:
+    struct Target {
+        std::string name;
+        std::string uuid;
+        bool slice;
+        unsigned int deviceIndex;   // 슬라이스는 부모 GPU
+        SlidingWindow usedMiB;
+        int64_t updatedMs;
+        double totalBytes;
+        double usedBytes;
+    };
+
+    AdmissionConfig config;
+    const LeakDetector* leaks;
+
+    mutable std::mutex updateMutex;   // 모델 갱신 (수집 쪽)
+    std::vector<Target> targets;
+    std::unordered_map<std::string, size_t> targetIndex;  // 이름 -> targets 위치
+    std::vector<double> deviceGrowth;                     // 마지막 틱의 LeakDetector 디바이스별 증가율
+
+    mutable std::mutex modelMutex;
+    std::shared_ptr<const std::vector<AdmissionModel>> models;
+
+public:
+    explicit AdmissionController(const AdmissionConfig& config = AdmissionConfig(), const LeakDetector* leaks = nullptr);
+
+    void setDevices(const std::vector<GPUInfo>& gpus);
+    // 디바이스와 스냅샷의 MIG 슬라이스 (migSlices)를 함께 갱신한다
+    void add(const MetricsSnapshot& snapshot);
+    // MIG 슬라이스 하나 (스냅샷 밖에서 슬라이스 메모리를 읽은 경우)
+    void updateSlice(const std::string& uuid, unsigned int deviceIndex, int64_t timestampMs,
+                     unsigned long long usedBytes, unsigned long long totalBytes);
+
+    // target은 GPU 인덱스, GPU uuid 또는 MIG uuid. requestBytes가 0이면 헤드룸만
+    AdmissionResult check(const std::string& target, double requestBytes, int64_t horizonMs, int64_t nowMs) const;
+    std::shared_ptr<const std::vector<AdmissionModel>> getModels() const;
+
+    // 체크포인트 (대상별 사용량 창). 창 샘플은 벽시계 시각이라 재시작 뒤에도 그대로 만료된다
+    void saveCheckpoint(CheckpointWriter& writer) const;
+    bool restoreCheckpoint(CheckpointReader& reader);
+
+private:
+    Target& targetFor(const std::string& name, bool slice);
+    void addSlice(const std::string& uuid, unsigned int deviceIndex, int64_t timestampMs,
+                  unsigned long long usedBytes, unsigned long long totalBytes);
+    void publish();
+};
+
+// HTTP API (/api/admission)
+//   gpu=0|<uuid>|<MIG uuid>&need=20GiB&horizon=1h -> 한 대상의 판정
+//   gpu가 없으면 모든 대상의 헤드룸 (need가 있으면 대상마다 확률도)
+void registerAdmissionApi(HttpServer& server, const AdmissionController& controller,
+                          const std::string& path = "/api/admission");
+
+// 파이프라인 싱크
+class AdmissionSink : public MetricsSink {
+private:
+    AdmissionController& controller;
+
+public:
+    explicit AdmissionSink(AdmissionController& controller) : controller(controller) {}
+
+    std::string name() const override { return "admission"; }
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override {
+        for (const auto& snapshot : batch) {
+            controller.add(*snapshot);
+        }
+        return true;
+    }
+};
+
+#endif // NVML_ADMISSION_H
@@ -0,0 +1,496 @@
+#include "nvml_aggregator.h"
+#include <algorithm>
+#include <iostream>
+#include <cerrno>
+#include <cstring>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+const size_t kReadChunk = 64 * 1024;
+const int kMaxEvents = 64;
+
+// 바이트 -> MiB (32비트 저장용)
+uint32_t toMiB(uint64_t bytes) {
+    return static_cast<uint32_t>(bytes >> 20);
+}
+
+} // namespace
+
+FleetAggregator::FleetAggregator(size_t historyPerSeries)
+    : historyCapacity(std::max<size_t>(historyPerSeries, 1)) {
+}
+
+std::string FleetAggregator::seriesKey(const std::string& node, const std::string& uuid) {
+    std::string key;
+    key.reserve(node.size() + uuid.size() + 1);
+    key.append(node);
+    key.push_back('\0');
+    key.append(uuid);
+    return key;
+}
+
+int FleetAggregator::bucketFor(uint32_t utilization) {
+    size_t bucket = utilization / 10;
+    return static_cast<int>(std::min(bucket, FLEET_HISTOGRAM_BUCKETS - 1));
+}
+
+FleetAggregator::Series* FleetAggregator::registerSeries(const std::string& node, const std::string& uuid,
+                                                         const std::string& model) {
+    ModelRollup* rollup;
+    {
+        std::lock_guard<std::mutex> lock(rollupMutex);
+        auto& entry = rollups[model];
+        if (!entry) {
+            entry = std::make_unique<ModelRollup>();
+            entry->model = model;
+        }
+        rollup = entry.get();
+    }
+
+    std::string key = seriesKey(node, uuid);
+    size_t shardIndex = std::hash<std::string>()(key) % FLEET_SHARD_COUNT;
+    Shard& shard = shards[shardIndex];
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto& entry = shard.series[key];
+    if (!entry) {
+        entry = std::make_unique<Series>();
+        entry->node = node;
+        entry->uuid = uuid;
+        entry->shard = shardIndex;
+        entry->history.resize(historyCapacity);
+    }
+
+    // 같은 GPU가 다른 모델로 재선언되면 롤업을 옮긴다
+    Series* series = entry.get();
+    if (series->rollup != rollup) {
+        int bucket = series->bucket;
+        setBucket(*series, -1);
+        series->model = model;
+        series->rollup = rollup;
+        setBucket(*series, bucket);
+    }
+    return series;
+}
+
+void FleetAggregator::setBucket(Series& series, int bucket) {
+    if (series.bucket == bucket) return;
+
+    if (series.rollup) {
+        if (series.bucket >= 0) {
+            series.rollup->buckets[series.bucket].fetch_sub(1, std::memory_order_relaxed);
+            if (bucket < 0) series.rollup->gpuCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+        if (bucket >= 0) {
+            series.rollup->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+            if (series.bucket < 0) series.rollup->gpuCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    series.bucket = bucket;
+}
+
+void FleetAggregator::ingest(Series* series, uint64_t timestampMs, const WireSample& sample) {
+    std::lock_guard<std::mutex> lock(shards[series->shard].mutex);
+
+    // 재전송 등으로 들어온 과거/중복 포인트는 무시
+    if (series->size > 0 && timestampMs <= series->latest.timestampMs) {
+        return;
+    }
+
+    FleetPoint& point = series->history[series->head];
+    point.timestampMs = timestampMs;
+    for (int f = 0; f < WIRE_FIELD_COUNT; f++) {
+        uint64_t value = sample.values[f];
+        if (f == WIRE_FIELD_MEM_USED || f == WIRE_FIELD_MEM_TOTAL) {
+            value = toMiB(value);
+        }
+        point.values[f] = static_cast<uint32_t>(std::min<uint64_t>(value, UINT32_MAX));
+    }
+
+    series->head = (series->head + 1) % series->history.size();
+    series->size = std::min(series->size + 1, series->history.size());
+    series->latest = point;
+    series->online = true;
+
+    setBucket(*series, bucketFor(point.values[WIRE_FIELD_GPU_UTIL]));
+    samplesIngested.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FleetAggregator::markOffline(Series* series) {
+    std::lock_guard<std::mutex> lock(shards[series->shard].mutex);
+    series->online = false;
+    setBucket(*series, -1);
+}
+
+std::vector<FleetHistogram> FleetAggregator::utilizationHistograms() {
+    std::vector<FleetHistogram> result;
+
+    std::lock_guard<std::mutex> lock(rollupMutex);
+    result.reserve(rollups.size());
+    for (const auto& entry : rollups) {
+        FleetHistogram histogram;
+        histogram.model = entry.first;
+        histogram.gpuCount = entry.second->gpuCount.load(std::memory_order_relaxed);
+        for (size_t b = 0; b < FLEET_HISTOGRAM_BUCKETS; b++) {
+            histogram.buckets[b] = entry.second->buckets[b].load(std::memory_order_relaxed);
+        }
+        result.push_back(histogram);
+    }
+    return result;
+}
+
+std::vector<FleetGPUSummary> FleetAggregator::topHotGPUs(size_t count) {
+    // 샤드별 상위 N개를 구한 뒤 병합
+    std::vector<FleetGPUSummary> candidates;
+    auto hotter = [](const FleetGPUSummary& a, const FleetGPUSummary& b) {
+        return a.latest.values[WIRE_FIELD_GPU_UTIL] > b.latest.values[WIRE_FIELD_GPU_UTIL];
+    };
+
+    for (auto& shard : shards) {
+        std::vector<std::pair<uint32_t, const Series*>> local;
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        local.reserve(shard.series.size());
+        for (const auto& entry : shard.series) {
+            if (entry.second->online) {
+                local.emplace_back(entry.second->latest.values[WIRE_FIELD_GPU_UTIL], entry.second.get());
+            }
+        }
+
+        size_t keep = std::min(count, local.size());
+        std::partial_sort(local.begin(), local.begin() + keep, local.end(),
+                          [](const auto& a, const auto& b) { return a.first > b.first; });
+        for (size_t i = 0; i < keep; i++) {
+            const Series* series = local[i].second;
+            candidates.push_back({series->node, series->uuid, series->model, series->latest});
+        }
+    }
+
+    size_t keep = std::min(count, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + keep, candidates.end(), hotter);
+    candidates.resize(keep);
+    return candidates;
+}
+
+bool FleetAggregator::getSeries(const std::string& node, const std::string& uuid, std::vector<FleetPoint>& points) {
+    std::string key = seriesKey(node, uuid);
+    Shard& shard = shards[std::hash<std::string>()(key) % FLEET_SHARD_COUNT];
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.series.find(key);
+    if (it == shard.series.end()) {
+        return false;
+    }
+
+    // 오래된 것부터 순서대로
+    const Series& series = *it->second;
+    size_t capacity = series.history.size();
+    size_t start = (series.head + capacity - series.size) % capacity;
+    points.clear();
+    points.reserve(series.size);
+    for (size_t i = 0; i < series.size; i++) {
+        points.push_back(series.history[(start + i) % capacity]);
+    }
+    return true;
+}
+
+size_t FleetAggregator::seriesCount() {
+    size_t count = 0;
+    for (auto& shard : shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        count += shard.series.size();
+    }
+    return count;
+}
+
+AggregatorServer::AggregatorServer(FleetAggregator& aggregator)
+    : aggregator(aggregator), listenFd(-1), epollFd(-1), running(false), activeConnections(0) {
+}
+
+AggregatorServer::~AggregatorServer() {
+    stop();
+}
+
+bool AggregatorServer::start(const std::string& addressText) {
+    if (running) return false;
+
+    if (!parseSocketAddress(addressText, address)) {
+        std::cerr << "Invalid aggregator address: " << addressText << std::endl;
+        return false;
+    }
+
+    listenFd = listenSocket(address);
+    if (listenFd < 0) {
+        return false;
+    }
+    setNonBlocking(listenFd);
+
+    epollFd = epoll_create1(0);
+    if (epollFd < 0) {
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = listenFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+
+    running = true;
+    serverThread = std::thread(&AggregatorServer::serverLoop, this);
+    return true;
+}
+
+void AggregatorServer::stop() {
+    if (!running) return;
+
+    running = false;
+    if (serverThread.joinable()) {
+        serverThread.join();
+    }
+
+    for (auto& entry : connections) {
+        for (auto* series : entry.second->slots) {
+            if (series) aggregator.markOffline(series);
+        }
+        close(entry.first);
+    }
+    connections.clear();
+    activeConnections = 0;
+
+    close(epollFd);
+    close(listenFd);
+    epollFd = -1;
+    listenFd = -1;
+
+    if (address.isUnix) {
+        unlink(address.path.c_str());
+    }
+}
+
+uint16_t AggregatorServer::port() const {
+    return listenFd >= 0 ? boundPort(listenFd) : 0;
+}
+
+void AggregatorServer::serverLoop() {
+    epoll_event events[kMaxEvents];
+
+    while (running) {
+        int count = epoll_wait(epollFd, events, kMaxEvents, 200);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "epoll_wait failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        for (int i = 0; i < count; i++) {
+            int fd = events[i].data.fd;
+            if (fd == listenFd) {
+                acceptConnections();
+                continue;
+            }
+
+            auto it = connections.find(fd);
+            if (it == connections.end()) continue;
+
+            Connection& conn = *it->second;
+            if ((events[i].events & EPOLLOUT) && !flushAck(conn)) {
+                closeConnection(fd);
+                continue;
+            }
+            if (!(events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))) continue;
+            if (!readConnection(conn) || (events[i].events & (EPOLLHUP | EPOLLERR))) {
+                closeConnection(fd);
+            }
+        }
+    }
+}
+
+void AggregatorServer::acceptConnections() {
+    while (true) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            return; // EAGAIN
+        }
+        setNonBlocking(fd);
+
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            close(fd);
+            continue;
+        }
+
+        auto conn = std::make_unique<Connection>();
+        conn->fd = fd;
+        conn->buffer.reserve(kReadChunk * 2);
+        connections[fd] = std::move(conn);
+        activeConnections++;
+    }
+}
+
+bool AggregatorServer::readConnection(Connection& conn) {
+    while (true) {
+        size_t used = conn.buffer.size();
+        conn.buffer.resize(used + kReadChunk);
+
+        ssize_t received = recv(conn.fd, conn.buffer.data() + used, kReadChunk, 0);
+        if (received <= 0) {
+            conn.buffer.resize(used);
+            if (received == 0) return false; // 상대가 연결 종료
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            if (errno == EINTR) continue;
+            return false;
+        }
+        conn.buffer.resize(used + static_cast<size_t>(received));
+
+        if (!processFrames(conn)) {
+            return false;
+        }
+        if (static_cast<size_t>(received) < kReadChunk) break;
+    }
+    return true;
+}
+
+bool AggregatorServer::processFrames(Connection& conn) {
+    while (true) {
+        WireFrameType type;
+        const uint8_t* payload;
+        uint32_t payloadSize;
+        size_t frameSize;
+
+        WireParseResult result = parseWireFrame(conn.buffer.data() + conn.readPos,
+                                                conn.buffer.size() - conn.readPos,
+                                                type, payload, payloadSize, frameSize);
+        if (result == WireParseResult::NeedMore) break;
+        if (result == WireParseResult::Error) {
+            std::cerr << "Invalid frame from " << (conn.node.empty() ? "unknown node" : conn.node) << std::endl;
+            return false;
+        }
+
+        switch (type) {
+            case WIRE_FRAME_HELLO:
+                if (!decodeWireHello(payload, payloadSize, conn.node)) return false;
+                break;
+
+            case WIRE_FRAME_DEVICES:
+                if (conn.node.empty() || !decodeWireDevices(payload, payloadSize, conn.decls)) return false;
+                for (const auto& decl : conn.decls) {
+                    if (decl.slot >= conn.slots.size()) {
+                        conn.slots.resize(decl.slot + 1, nullptr);
+                    }
+                    conn.slots[decl.slot] = aggregator.registerSeries(conn.node, decl.uuid, decl.model);
+                }
+                break;
+
+            case WIRE_FRAME_SAMPLES: {
+                uint64_t timestampMs;
+                if (!decodeWireSamples(payload, payloadSize, timestampMs, conn.samples)) return false;
+                ingestSamples(conn, timestampMs, conn.samples);
+                break;
+            }
+
+            case WIRE_FRAME_BATCH:
+                if (!decodeWireBatch(payload, payloadSize, conn.delta, conn.ticks)) return false;
+                for (const auto& tick : conn.ticks) {
+                    ingestSamples(conn, tick.timestampMs, tick.samples);
+                }
+                if (!conn.ticks.empty() && !sendAck(conn, conn.ticks.back().sequence)) {
+                    return false;
+                }
+                break;
+
+            default:
+                // 알 수 없는 프레임은 건너뛴다 (상위 호환)
+                break;
+        }
+
+        conn.readPos += frameSize;
+    }
+
+    // 처리한 바이트 정리
+    if (conn.readPos > 0) {
+        conn.buffer.erase(conn.buffer.begin(), conn.buffer.begin() + conn.readPos);
+        conn.readPos = 0;
+    }
+    return true;
+}
+
+void AggregatorServer::ingestSamples(Connection& conn, uint64_t timestampMs,
+                                     const std::vector<WireSample>& samples) {
+    for (const auto& sample : samples) {
+        if (sample.slot < conn.slots.size() && conn.slots[sample.slot]) {
+            aggregator.ingest(conn.slots[sample.slot], timestampMs, sample);
+        }
+    }
+}
+
+bool AggregatorServer::sendAck(Connection& conn, uint64_t sequence) {
+    // ACK는 누적값이므로 아직 한 바이트도 보내지 않은 프레임은 새 ACK로 바꿔도 된다.
+    // 일부만 나간 프레임은 스트림이 어긋나지 않도록 끝까지 보낸 뒤 새 ACK를 보낸다
+    if (conn.ackSent > 0) {
+        conn.ackQueued = true;
+        conn.ackQueuedSequence = sequence;
+        return true;
+    }
+    conn.ackBuffer.clear();
+    WireEncoder encoder(conn.ackBuffer);
+    encoder.ack(sequence);
+    return flushAck(conn);
+}
+
+bool AggregatorServer::flushAck(Connection& conn) {
+    while (true) {
+        while (conn.ackSent < conn.ackBuffer.size()) {
+            ssize_t sent = send(conn.fd, conn.ackBuffer.data() + conn.ackSent, conn.ackBuffer.size() - conn.ackSent,
+                                MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (sent < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    setWritableInterest(conn, true);
+                    return true;
+                }
+                return false;
+            }
+            conn.ackSent += static_cast<size_t>(sent);
+        }
+        conn.ackBuffer.clear();
+        conn.ackSent = 0;
+        if (!conn.ackQueued) break;
+
+        conn.ackQueued = false;
+        WireEncoder encoder(conn.ackBuffer);
+        encoder.ack(conn.ackQueuedSequence);
+    }
+    setWritableInterest(conn, false);
+    return true;
+}
+
+void AggregatorServer::setWritableInterest(Connection& conn, bool enable) {
+    if (conn.waitingWritable == enable) return;
+    epoll_event event = {};
+    event.events = enable ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+    event.data.fd = conn.fd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_MOD, conn.fd, &event) == 0) {
+        conn.waitingWritable = enable;
+    }
+}
+
+void AggregatorServer::closeConnection(int fd) {
+    auto it = connections.find(fd);
+    if (it == connections.end()) return;
+
+    for (auto* series : it->second->slots) {
+        if (series) aggregator.markOffline(series);
+    }
+
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    connections.erase(it);
+    activeConnections--;
+}
@@ -0,0 +1,162 @@
+#ifndef NVML_AGGREGATOR_H
+#define NVML_AGGREGATOR_H
+
+#include "nvml_wire.h"
+#include "nvml_socket.h"
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+const size_t FLEET_SHARD_COUNT = 16;
+const size_t FLEET_HISTOGRAM_BUCKETS = 10; // 사용률 10% 단위
+
+// 집계기 시계열 포인트 (메모리 필드는 MiB 단위로 저장)
+struct FleetPoint {
+    uint64_t timestampMs;
+    uint32_t values[WIRE_FIELD_COUNT];
+};
+
+// 모델별 사용률 히스토그램 (온라인 GPU의 최신 값 기준)
+struct FleetHistogram {
+    std::string model;
+    uint64_t gpuCount;
+    uint64_t buckets[FLEET_HISTOGRAM_BUCKETS];
+};
+
+// 상위 N개 GPU 조회 결과
+struct FleetGPUSummary {
+    std::string node;
+    std::string uuid;
+    std::string model;
+    FleetPoint latest;
+};
+
+// 노드/GPU UUID 기준으로 샤딩된 시계열 저장소와 사전 집계
+class FleetAggregator {
+public:
+    struct Series;
+
+private:
+    // 모델별 롤업: 등록 시에만 생성되고 이후 원자적 증감으로 갱신
+    struct ModelRollup {
+        std::string model;
+        std::atomic<uint64_t> gpuCount{0};
+        std::array<std::atomic<uint64_t>, FLEET_HISTOGRAM_BUCKETS> buckets{};
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::unique_ptr<Series>> series; // node + '\0' + uuid
+    };
+
+    std::array<Shard, FLEET_SHARD_COUNT> shards;
+    std::map<std::string, std::unique_ptr<ModelRollup>> rollups;
+    std::mutex rollupMutex;
+    size_t historyCapacity;
+    std::atomic<uint64_t> samplesIngested{0};
+
+public:
+    struct Series {
+        std::string node;
+        std::string uuid;
+        std::string model;
+        size_t shard = 0;
+        ModelRollup* rollup = nullptr;
+
+        // 최근 포인트 링 버퍼
+        std::vector<FleetPoint> history;
+        size_t head = 0;
+        size_t size = 0;
+
+        FleetPoint latest = {};
+        bool online = false;
+        int bucket = -1;
+    };
+
+    explicit FleetAggregator(size_t historyPerSeries = 120);
+
+    // 시계열 등록 (연결의 디바이스 선언 시 한 번). 반환 포인터는 집계기 수명 동안 유효
+    Series* registerSeries(const std::string& node, const std::string& uuid, const std::string& model);
+
+    // 샘플 적재 (핫 패스: 해시 조회 없이 샤드 락 하나만 잡는다)
+    void ingest(Series* series, uint64_t timestampMs, const WireSample& sample);
+
+    // 연결 종료 시 롤업에서 제외
+    void markOffline(Series* series);
+
+    // 조회
+    std::vector<FleetHistogram> utilizationHistograms();
+    std::vector<FleetGPUSummary> topHotGPUs(size_t count);
+    bool getSeries(const std::string& node, const std::string& uuid, std::vector<FleetPoint>& points);
+    size_t seriesCount();
+    uint64_t totalSamples() const { return samplesIngested.load(std::memory_order_relaxed); }
+
+private:
+    static std::string seriesKey(const std::string& node, const std::string& uuid);
+    static int bucketFor(uint32_t utilization);
+    void setBucket(Series& series, int bucket);
+};
+
+// 에이전트 스트림 수신 서버 (epoll 단일 스레드)
+class AggregatorServer {
+private:
+    struct Connection {
+        int fd;
+        std::vector<uint8_t> buffer;
+        size_t readPos = 0;
+        std::string node;
+        std::vector<FleetAggregator::Series*> slots;
+
+        // 디코딩 버퍼 재사용
+        std::vector<WireDeviceDecl> decls;
+        std::vector<WireSample> samples;
+        std::vector<WireTick> ticks;
+
+        // v2 배치 프레임 델타 상태와 ACK 전송 버퍼
+        // 보내다 만 ACK 프레임은 EPOLLOUT에서 마저 보내고, 그동안 온 새 ACK는 마지막 시퀀스만 기억한다
+        WireDeltaState delta;
+        std::vector<uint8_t> ackBuffer;
+        size_t ackSent = 0;
+        bool ackQueued = false;         // 지금 프레임을 다 보낸 뒤 보낼 ACK
+        uint64_t ackQueuedSequence = 0;
+        bool waitingWritable = false;   // EPOLLOUT 등록 중
+    };
+
+    FleetAggregator& aggregator;
+    SocketAddress address;
+    int listenFd;
+    int epollFd;
+    std::atomic<bool> running;
+    std::thread serverThread;
+    std::unordered_map<int, std::unique_ptr<Connection>> connections;
+    std::atomic<size_t> activeConnections;
+
+public:
+    explicit AggregatorServer(FleetAggregator& aggregator);
+    ~AggregatorServer();
+
+    // "tcp://host:port" 또는 "unix:///path"
+    bool start(const std::string& addressText);
+    void stop();
+
+    // TCP 포트 0으로 시작한 경우 실제 포트
+    uint16_t port() const;
+    size_t connectionCount() const { return activeConnections.load(); }
+
+private:
+    void serverLoop();
+    void acceptConnections();
+    bool readConnection(Connection& conn);
+    bool processFrames(Connection& conn);
+    void ingestSamples(Connection& conn, uint64_t timestampMs, const std::vector<WireSample>& samples);
+    bool sendAck(Connection& conn, uint64_t sequence);
+    bool flushAck(Connection& conn);
+    void setWritableInterest(Connection& conn, bool enable);
+    void closeConnection(int fd);
+};
+
+#endif // NVML_AGGREGATOR_H
@@ -0,0 +1,714 @@
+#include "nvml_arrow.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <iostream>
+#include <unistd.h>
+
+namespace {
+
+// Arrow 포맷 상수 (format/Schema.fbs, Message.fbs, File.fbs)
+const int16_t kMetadataV5 = 4;
+const uint8_t kHeaderSchema = 1;
+const uint8_t kHeaderDictionaryBatch = 2;
+const uint8_t kHeaderRecordBatch = 3;
+const uint8_t kTypeInt = 2;
+const uint8_t kTypeUtf8 = 5;
+const uint8_t kTypeTimestamp = 10;
+const int16_t kTimeUnitMillisecond = 1;
+
+const char kMagic[] = "ARROW1";
+
+const int kSourceTimestamp = -1;
+const int kSourceDevice = -2;
+const int kSourcePid = -3;
+const int kSourceName = -4;
+
+const int64_t kUuidDictionary = 0;
+const int64_t kNameDictionary = 1;
+
+void padTo(std::string& out, size_t alignment) {
+    out.append((alignment - out.size() % alignment) % alignment, '\0');
+}
+
+// 최소 FlatBuffers 직렬화기
+// Arrow 메타데이터는 몇 개의 작은 테이블뿐이라 의존성 없이 앞에서부터 쓴다:
+// 부모 테이블을 먼저 놓고 자식은 뒤에 놓은 다음 uoffset(자식 위치 - 슬롯 위치)을 채운다
+struct FbNode;
+
+struct FbField {
+    int id;
+    int size;        // 1/2/4/8 스칼라, 0이면 자식 오프셋
+    uint64_t scalar;
+    FbNode* child;
+};
+
+struct FbNode {
+    enum Kind {
+        Table,
+        String,
+        Vector,  // 테이블/문자열 오프셋 벡터
+        Structs  // 8바이트 정렬 구조체 벡터
+    };
+
+    Kind kind;
+    std::vector<FbField> fields;
+    std::vector<FbNode*> items;
+    std::string bytes;
+    uint32_t count = 0;
+
+    explicit FbNode(Kind kind) : kind(kind) {}
+};
+
+class FlatBuilder {
+private:
+    std::deque<FbNode> nodes;
+
+public:
+    FbNode* table() {
+        nodes.emplace_back(FbNode::Table);
+        return &nodes.back();
+    }
+
+    FbNode* string(const std::string& value) {
+        nodes.emplace_back(FbNode::String);
+        nodes.back().bytes = value;
+        return &nodes.back();
+    }
+
+    FbNode* vector(const std::vector<FbNode*>& items) {
+        nodes.emplace_back(FbNode::Vector);
+        nodes.back().items = items;
+        return &nodes.back();
+    }
+
+    FbNode* structs(const std::string& bytes, uint32_t count) {
+        nodes.emplace_back(FbNode::Structs);
+        nodes.back().bytes = bytes;
+        nodes.back().count = count;
+        return &nodes.back();
+    }
+
+    template <typename T>
+    static void add(FbNode* table, int id, T value) {
+        FbField field = {id, static_cast<int>(sizeof(T)), 0, nullptr};
+        std::memcpy(&field.scalar, &value, sizeof(T));
+        table->fields.push_back(field);
+    }
+
+    static void add(FbNode* table, int id, FbNode* child) {
+        table->fields.push_back({id, 0, 0, child});
+    }
+
+    std::string finish(FbNode* root) {
+        std::string out(4, '\0');
+        patch(out, 0, place(root, out));
+        padTo(out, 8);
+        return out;
+    }
+
+private:
+    static void patch(std::string& out, size_t slot, size_t target) {
+        uint32_t offset = static_cast<uint32_t>(target - slot);
+        std::memcpy(&out[slot], &offset, sizeof(offset));
+    }
+
+    size_t place(FbNode* node, std::string& out) {
+        switch (node->kind) {
+            case FbNode::String: {
+                padTo(out, 4);
+                size_t pos = out.size();
+                putLE<uint32_t>(static_cast<uint32_t>(node->bytes.size()), out);
+                out += node->bytes;
+                out.push_back('\0');
+                return pos;
+            }
+            case FbNode::Structs: {
+                // 원소가 8바이트 정렬되도록 길이 필드를 8n+4에 둔다
+                padTo(out, 4);
+                if (out.size() % 8 == 0) out.append(4, '\0');
+                size_t pos = out.size();
+                putLE<uint32_t>(node->count, out);
+                out += node->bytes;
+                return pos;
+            }
+            case FbNode::Vector: {
+                padTo(out, 4);
+                size_t pos = out.size();
+                putLE<uint32_t>(static_cast<uint32_t>(node->items.size()), out);
+                out.append(node->items.size() * 4, '\0');
+                for (size_t i = 0; i < node->items.size(); i++) {
+                    size_t slot = pos + 4 + i * 4;
+                    patch(out, slot, place(node->items[i], out));
+                }
+                return pos;
+            }
+            case FbNode::Table:
+                break;
+        }
+
+        // 큰 필드부터 놓으면 테이블 시작이 8n+4일 때 모든 필드가 자연 정렬된다
+        std::vector<FbField> fields = node->fields;
+        std::stable_sort(fields.begin(), fields.end(), [](const FbField& a, const FbField& b) {
+            return (a.size ? a.size : 4) > (b.size ? b.size : 4);
+        });
+
+        int fieldCount = 0;
+        for (const auto& field : fields) {
+            fieldCount = std::max(fieldCount, field.id + 1);
+        }
+        std::vector<uint16_t> slots(fieldCount, 0);
+        uint16_t tableSize = 4;
+        for (const auto& field : fields) {
+            slots[field.id] = tableSize;
+            tableSize += static_cast<uint16_t>(field.size ? field.size : 4);
+        }
+
+        padTo(out, 4);
+        size_t vtablePos = out.size();
+        putLE<uint16_t>(static_cast<uint16_t>(4 + 2 * fieldCount), out);
+        putLE<uint16_t>(tableSize, out);
+        for (uint16_t slot : slots) {
+            putLE<uint16_t>(slot, out);
+        }
+
+        padTo(out, 4);
+        if (out.size() % 8 == 0) out.append(4, '\0');
+        size_t tablePos = out.size();
+        putLE<int32_t>(static_cast<int32_t>(tablePos - vtablePos), out);
+        for (const auto& field : fields) {
+            if (field.size) {
+                out.append(reinterpret_cast<const char*>(&field.scalar), field.size);
+            } else {
+                out.append(4, '\0');
+            }
+        }
+
+        for (const auto& field : fields) {
+            if (!field.size) {
+                size_t slot = tablePos + slots[field.id];
+                patch(out, slot, place(field.child, out));
+            }
+        }
+        return tablePos;
+    }
+};
+
+FbNode* intType(FlatBuilder& fb, int32_t bitWidth, bool isSigned) {
+    FbNode* type = fb.table();
+    FlatBuilder::add<int32_t>(type, 0, bitWidth);
+    FlatBuilder::add<uint8_t>(type, 1, isSigned ? 1 : 0);
+    return type;
+}
+
+// 버퍼 위치 목록 (RecordBatch.buffers)
+struct BufferList {
+    std::string bytes;
+    uint32_t count = 0;
+
+    void add(int64_t offset, int64_t length) {
+        putLE<int64_t>(offset, bytes);
+        putLE<int64_t>(length, bytes);
+        count++;
+    }
+};
+
+// body 끝에 버퍼를 덧붙이고 8바이트 정렬
+void addBuffer(std::string& body, BufferList& buffers, const void* data, size_t length) {
+    buffers.add(static_cast<int64_t>(body.size()), static_cast<int64_t>(length));
+    body.append(static_cast<const char*>(data), length);
+    padTo(body, 8);
+}
+
+FbNode* recordBatch(FlatBuilder& fb, int64_t length, const std::string& nodes, uint32_t nodeCount,
+                    const BufferList& buffers) {
+    FbNode* batch = fb.table();
+    FlatBuilder::add<int64_t>(batch, 0, length);
+    FlatBuilder::add(batch, 1, fb.structs(nodes, nodeCount));
+    FlatBuilder::add(batch, 2, fb.structs(buffers.bytes, buffers.count));
+    return batch;
+}
+
+std::string message(FlatBuilder& fb, uint8_t headerType, FbNode* header, int64_t bodyLength) {
+    FbNode* root = fb.table();
+    FlatBuilder::add<int16_t>(root, 0, kMetadataV5);
+    FlatBuilder::add<uint8_t>(root, 1, headerType);
+    FlatBuilder::add(root, 2, header);
+    FlatBuilder::add<int64_t>(root, 3, bodyLength);
+    return fb.finish(root);
+}
+
+template <typename T, typename Get>
+void addColumn(std::string& body, BufferList& buffers, const std::vector<uint32_t>& selection, Get get) {
+    buffers.add(static_cast<int64_t>(body.size()), 0); // 널 없음: validity 버퍼 생략
+    size_t start = body.size();
+    buffers.add(static_cast<int64_t>(start), static_cast<int64_t>(selection.size() * sizeof(T)));
+    body.resize(start + selection.size() * sizeof(T));
+    char* data = &body[start];
+    for (uint32_t row : selection) {
+        T value = get(row);
+        std::memcpy(data, &value, sizeof(T));
+        data += sizeof(T);
+    }
+    padTo(body, 8);
+}
+
+bool writeAll(int fd, const std::string& data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t n = ::write(fd, data.data() + written, data.size() - written);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        written += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+} // namespace
+
+ArrowHistoryExporter::ArrowHistoryExporter(const MetricHistory& history, const ArrowExportRequest& request,
+                                           const SegmentStore* store)
+    : request(request), persistedUntil(INT64_MIN), nextBlock(0), nextSegment(0), nextSegmentBlock(0),
+      stage(Stage::Schema), offset(0), rows(0) {
+    std::sort(this->request.pids.begin(), this->request.pids.end());
+
+    columns.push_back({"timestamp", ColumnType::Timestamp, kSourceTimestamp, 0});
+    columns.push_back({"gpu", ColumnType::UInt32, kSourceDevice, 0});
+    columns.push_back({"uuid", ColumnType::Dictionary, kSourceDevice, kUuidDictionary});
+    if (request.table == HistoryTable::Device) {
+        std::vector<int> metrics = request.metrics;
+        if (metrics.empty()) {
+            for (int metric = 0; metric < HM_DEVICE_METRIC_COUNT; metric++) {
+                metrics.push_back(metric);
+            }
+        }
+        for (int metric : metrics) {
+            if (metric < 0 || metric >= HM_DEVICE_METRIC_COUNT) continue;
+            bool wide = metric == HM_MEMORY_USED || metric == HM_MEMORY_TOTAL || metric == HM_ECC_SINGLE_BIT ||
+                        metric == HM_ECC_DOUBLE_BIT;
+            columns.push_back({historyMetricName(metric), wide ? ColumnType::UInt64 : ColumnType::UInt32, metric, 0});
+        }
+    } else {
+        columns.push_back({"pid", ColumnType::UInt32, kSourcePid, 0});
+        columns.push_back({"name", ColumnType::Dictionary, kSourceName, kNameDictionary});
+        columns.push_back({historyMetricName(HM_PROCESS_MEMORY), ColumnType::UInt64, 0, 0});
+    }
+
+    // 블록을 먼저 잡고 사전을 읽어야 블록의 모든 이름 id가 사전 안에 있다
+    // 경계를 블록보다 먼저 읽는다: 그 사이 파일로 간 블록은 메모리에도 아직 있다
+    if (store) persistedUntil = store->persistedUntil(request.table);
+    blocks = history.blocks(request.table, request.start, request.end);
+    names = history.processNames();
+    uuids = history.deviceUuids();
+    for (const auto& block : blocks) {
+        for (uint32_t device : block->devices) {
+            if (device >= uuids.size()) uuids.resize(device + 1);
+        }
+    }
+    if (store && persistedUntil >= request.start) openSegments(*store);
+}
+
+void ArrowHistoryExporter::openSegments(const SegmentStore& store) {
+    // 사전은 배치보다 먼저 나가므로 세그먼트 푸터를 지금 다 읽는다 (열 데이터는 배치를 쓸 때 mmap으로 읽힌다)
+    // 열어 둔 파일은 압축기가 목록에서 빼고 지워도 끝까지 읽을 수 있다
+    std::vector<SegmentEntry> entries = store.manifest();
+    std::sort(entries.begin(), entries.end(), [](const SegmentEntry& a, const SegmentEntry& b) {
+        return a.minTimestamp < b.minTimestamp;
+    });
+    std::unordered_map<std::string, uint32_t> nameIds;
+    for (size_t i = 0; i < names.size(); i++) {
+        nameIds.emplace(names[i], static_cast<uint32_t>(i));
+    }
+    for (const auto& entry : entries) {
+        if (entry.table != request.table || entry.maxTimestamp < request.start || entry.minTimestamp >= request.end ||
+            entry.minTimestamp > persistedUntil) {
+            continue;
+        }
+        Segment segment;
+        segment.file = std::make_unique<SegmentFile>();
+        std::string error;
+        if (!segment.file->open(store.path(entry.file), error)) {
+            std::cerr << "Arrow export skipping segment: " << error << std::endl;
+            continue;
+        }
+        const SegmentInfo& info = segment.file->getInfo();
+        for (const auto& name : info.names) {
+            if (name.first >= segment.nameMap.size()) segment.nameMap.resize(name.first + 1, 0);
+            auto it = nameIds.emplace(name.second, static_cast<uint32_t>(names.size())).first;
+            if (it->second == names.size()) names.push_back(name.second);
+            segment.nameMap[name.first] = it->second;
+        }
+        if (info.uuids.size() > uuids.size()) uuids.resize(info.uuids.size());
+        for (size_t device = 0; device < info.uuids.size(); device++) {
+            if (uuids[device].empty()) uuids[device] = info.uuids[device];
+        }
+        segments.push_back(std::move(segment));
+    }
+}
+
+ArrowHistoryExporter::FileBlock ArrowHistoryExporter::writeMessage(const std::string& metadata, std::string& out) {
+    // 캡슐화 메시지: 0xFFFFFFFF, int32 메타데이터 길이, 메타데이터(8바이트 정렬), 본문(8바이트 정렬)
+    FileBlock block;
+    block.offset = offset;
+    block.metadataLength = static_cast<int32_t>(8 + metadata.size());
+    block.bodyLength = static_cast<int64_t>(body.size());
+
+    putLE<uint32_t>(0xFFFFFFFF, out);
+    putLE<int32_t>(static_cast<int32_t>(metadata.size()), out);
+    out += metadata;
+    out += body;
+    offset += block.metadataLength + block.bodyLength;
+    return block;
+}
+
+void ArrowHistoryExporter::writeSchema(bool footer, std::string& out) {
+    FlatBuilder fb;
+    FbNode* schema = fb.table();
+    std::vector<FbNode*> fields;
+    for (const auto& column : columns) {
+        FbNode* field = fb.table();
+        FlatBuilder::add(field, 0, fb.string(column.name));
+        FlatBuilder::add<uint8_t>(field, 1, 0); // nullable = false
+        switch (column.type) {
+            case ColumnType::Timestamp: {
+                FbNode* type = fb.table();
+                FlatBuilder::add<int16_t>(type, 0, kTimeUnitMillisecond);
+                FlatBuilder::add(type, 1, fb.string("UTC"));
+                FlatBuilder::add<uint8_t>(field, 2, kTypeTimestamp);
+                FlatBuilder::add(field, 3, type);
+                break;
+            }
+            case ColumnType::UInt32:
+            case ColumnType::UInt64:
+                FlatBuilder::add<uint8_t>(field, 2, kTypeInt);
+                FlatBuilder::add(field, 3, intType(fb, column.type == ColumnType::UInt32 ? 32 : 64, false));
+                break;
+            case ColumnType::Dictionary: {
+                FbNode* encoding = fb.table();
+                FlatBuilder::add<int64_t>(encoding, 0, column.dictionary);
+                FlatBuilder::add(encoding, 1, intType(fb, 32, true));
+                FlatBuilder::add<uint8_t>(field, 2, kTypeUtf8);
+                FlatBuilder::add(field, 3, fb.table());
+                FlatBuilder::add(field, 4, encoding);
+                break;
+            }
+        }
+        FlatBuilder::add(field, 5, fb.vector({})); // children (리더가 널을 허용하지 않는다)
+        fields.push_back(field);
+    }
+    FlatBuilder::add(schema, 1, fb.vector(fields));
+
+    if (footer) {
+        // 푸터 (같은 스키마 + 메시지 위치): version, schema, dictionaries, recordBatches
+        auto blockList = [&fb](const std::vector<FileBlock>& list) {
+            std::string bytes;
+            for (const auto& block : list) {
+                putLE<int64_t>(block.offset, bytes);
+                putLE<int32_t>(block.metadataLength, bytes);
+                putLE<int32_t>(0, bytes);
+                putLE<int64_t>(block.bodyLength, bytes);
+            }
+            return fb.structs(bytes, static_cast<uint32_t>(list.size()));
+        };
+        FbNode* footer = fb.table();
+        FlatBuilder::add<int16_t>(footer, 0, kMetadataV5);
+        FlatBuilder::add(footer, 1, schema);
+        FlatBuilder::add(footer, 2, blockList(dictionaryBlocks));
+        FlatBuilder::add(footer, 3, blockList(recordBlocks));
+        std::string metadata = fb.finish(footer);
+        out += metadata;
+        putLE<int32_t>(static_cast<int32_t>(metadata.size()), out);
+        out.append(kMagic, 6);
+        offset += static_cast<int64_t>(metadata.size()) + 4 + 6;
+        return;
+    }
+
+    body.clear();
+    writeMessage(message(fb, kHeaderSchema, schema, 0), out);
+}
+
+void ArrowHistoryExporter::writeDictionary(int64_t id, const std::vector<std::string>& values, std::string& out) {
+    body.clear();
+    BufferList buffers;
+    buffers.add(0, 0);
+
+    std::string offsets;
+    offsets.reserve((values.size() + 1) * 4);
+    int32_t position = 0;
+    putLE<int32_t>(position, offsets);
+    size_t dataSize = 0;
+    for (const auto& value : values) {
+        position += static_cast<int32_t>(value.size());
+        putLE<int32_t>(position, offsets);
+        dataSize += value.size();
+    }
+    addBuffer(body, buffers, offsets.data(), offsets.size());
+
+    buffers.add(static_cast<int64_t>(body.size()), static_cast<int64_t>(dataSize));
+    for (const auto& value : values) {
+        body += value;
+    }
+    padTo(body, 8);
+
+    std::string nodes;
+    putLE<int64_t>(static_cast<int64_t>(values.size()), nodes);
+    putLE<int64_t>(0, nodes);
+
+    FlatBuilder fb;
+    FbNode* dictionary = fb.table();
+    FlatBuilder::add<int64_t>(dictionary, 0, id);
+    FlatBuilder::add(dictionary, 1, recordBatch(fb, static_cast<int64_t>(values.size()), nodes, 1, buffers));
+    dictionaryBlocks.push_back(
+        writeMessage(message(fb, kHeaderDictionaryBatch, dictionary, static_cast<int64_t>(body.size())), out));
+}
+
+bool ArrowHistoryExporter::writeBlock(const HistoryBlock& block, std::string& out) {
+    // 세그먼트에 든 행은 이미 내보냈다
+    int64_t start = std::max(request.start, persistedUntil + 1);
+    if (block.maxTimestamp < start || block.minTimestamp >= request.end || !(block.deviceMask & request.deviceMask)) {
+        return false;
+    }
+    BatchRows batch;
+    batch.count = block.rows();
+    batch.timestamps = block.timestamps.data();
+    batch.devices = block.devices.data();
+    batch.pids = block.pids.data();
+    batch.names = block.names.data();
+    for (size_t c = 0; c < block.values.size() && c < HM_DEVICE_METRIC_COUNT; c++) {
+        batch.values[c] = block.values[c].data();
+    }
+    return writeBatch(batch, start, request.end, out);
+}
+
+bool ArrowHistoryExporter::writeSegmentBlock(const Segment& segment, size_t index, std::string& out) {
+    const SegmentInfo& info = segment.file->getInfo();
+    const SegmentBlockInfo& block = info.blocks[index];
+    int64_t end = std::min(request.end, persistedUntil + 1);
+    if (block.maxTimestamp < request.start || block.minTimestamp >= end || !(block.deviceMask & request.deviceMask)) {
+        return false;
+    }
+    // 다운샘플 블록은 버킷 시작 시각과 버킷 평균(values)을 행으로 내보낸다
+    SegmentBlockView view = segment.file->block(index);
+    BatchRows batch;
+    batch.count = view.rows;
+    batch.timestamps = view.timestamps;
+    batch.devices = view.devices;
+    batch.pids = view.pids;
+    batch.names = view.names;
+    size_t valueColumns = info.table == HistoryTable::Device ? HM_DEVICE_METRIC_COUNT : 1;
+    for (size_t c = 0; c < valueColumns; c++) {
+        batch.values[c] = view.values + c * view.rows;
+    }
+    if (info.table == HistoryTable::Process) {
+        // 사전에 없는 이름 id가 있으면 손상된 블록
+        for (size_t i = 0; i < view.rows; i++) {
+            if (view.names[i] >= segment.nameMap.size()) {
+                std::cerr << "Arrow export skipping corrupt block in " << segment.file->getPath() << std::endl;
+                return false;
+            }
+        }
+        batch.nameMap = segment.nameMap.data();
+    }
+    return writeBatch(batch, request.start, end, out);
+}
+
+bool ArrowHistoryExporter::writeBatch(const BatchRows& batch, int64_t start, int64_t end, std::string& out) {
+    // 시각 범위는 이진 탐색, 디바이스/PID는 행 단위로 걸러 선택 벡터를 만든다
+    const int64_t* timestamps = batch.timestamps;
+    size_t lo = std::lower_bound(timestamps, timestamps + batch.count, start) - timestamps;
+    size_t hi = std::lower_bound(timestamps, timestamps + batch.count, end) - timestamps;
+    bool filterPids = request.table == HistoryTable::Process && !request.pids.empty();
+    selection.clear();
+    for (size_t i = lo; i < hi; i++) {
+        if (!(historyDeviceBit(batch.devices[i]) & request.deviceMask)) continue;
+        if (filterPids && !std::binary_search(request.pids.begin(), request.pids.end(), batch.pids[i])) continue;
+        selection.push_back(static_cast<uint32_t>(i));
+    }
+    if (selection.empty()) return false;
+
+    body.clear();
+    BufferList buffers;
+    std::string nodes;
+    for (const auto& column : columns) {
+        putLE<int64_t>(static_cast<int64_t>(selection.size()), nodes);
+        putLE<int64_t>(0, nodes);
+
+        switch (column.source) {
+            case kSourceTimestamp:
+                addColumn<int64_t>(body, buffers, selection, [&](uint32_t row) { return timestamps[row]; });
+                break;
+            case kSourceDevice:
+                if (column.type == ColumnType::Dictionary) {
+                    addColumn<int32_t>(body, buffers, selection,
+                                       [&](uint32_t row) { return static_cast<int32_t>(batch.devices[row]); });
+                } else {
+                    addColumn<uint32_t>(body, buffers, selection, [&](uint32_t row) { return batch.devices[row]; });
+                }
+                break;
+            case kSourcePid:
+                addColumn<uint32_t>(body, buffers, selection, [&](uint32_t row) { return batch.pids[row]; });
+                break;
+            case kSourceName:
+                addColumn<int32_t>(body, buffers, selection, [&](uint32_t row) {
+                    uint32_t name = batch.names[row];
+                    return static_cast<int32_t>(batch.nameMap ? batch.nameMap[name] : name);
+                });
+                break;
+            default: {
+                const double* values = batch.values[column.source];
+                if (column.type == ColumnType::UInt64) {
+                    addColumn<uint64_t>(body, buffers, selection,
+                                        [&](uint32_t row) { return static_cast<uint64_t>(values[row]); });
+                } else {
+                    addColumn<uint32_t>(body, buffers, selection,
+                                        [&](uint32_t row) { return static_cast<uint32_t>(values[row]); });
+                }
+                break;
+            }
+        }
+    }
+
+    FlatBuilder fb;
+    FbNode* batch = recordBatch(fb, static_cast<int64_t>(selection.size()), nodes,
+                                static_cast<uint32_t>(columns.size()), buffers);
+    recordBlocks.push_back(writeMessage(message(fb, kHeaderRecordBatch, batch, static_cast<int64_t>(body.size())), out));
+    rows += selection.size();
+    return true;
+}
+
+void ArrowHistoryExporter::writeFooter(std::string& out) {
+    // 스트림 종료 표시 다음에 푸터
+    putLE<uint32_t>(0xFFFFFFFF, out);
+    putLE<int32_t>(0, out);
+    offset += 8;
+    writeSchema(true, out);
+}
+
+bool ArrowHistoryExporter::next(std::string& out) {
+    switch (stage) {
+        case Stage::Schema:
+            out.append(kMagic, 6);
+            out.append(2, '\0');
+            offset += 8;
+            writeSchema(false, out);
+            stage = Stage::Dictionaries;
+            return true;
+
+        case Stage::Dictionaries:
+            writeDictionary(kUuidDictionary, uuids, out);
+            if (request.table == HistoryTable::Process) {
+                writeDictionary(kNameDictionary, names, out);
+            }
+            stage = Stage::Batches;
+            return true;
+
+        case Stage::Batches:
+            // 조건에 맞는 행이 없는 블록은 건너뛰고 다음 블록으로. 오래된 세그먼트 행부터
+            while (nextSegment < segments.size()) {
+                Segment& segment = segments[nextSegment];
+                if (nextSegmentBlock >= segment.file->getInfo().blocks.size()) {
+                    segment.file.reset(); // 다 읽은 세그먼트는 바로 닫는다
+                    nextSegment++;
+                    nextSegmentBlock = 0;
+                    continue;
+                }
+                if (writeSegmentBlock(segment, nextSegmentBlock++, out)) return true;
+            }
+            while (nextBlock < blocks.size()) {
+                HistoryBlockPtr block = std::move(blocks[nextBlock++]); // 내보낸 블록은 바로 놓는다
+                if (writeBlock(*block, out)) return true;
+            }
+            writeFooter(out);
+            stage = Stage::Done;
+            return false;
+
+        case Stage::Done:
+            break;
+    }
+    return false;
+}
+
+bool exportHistoryArrow(const MetricHistory& history, const ArrowExportRequest& request, const std::string& path,
+                        std::string& error, const SegmentStore* store) {
+    // 임시 파일에 다 쓴 다음 rename (읽는 쪽이 반쯤 쓴 파일을 보지 않도록)
+    std::string temporary = path + ".tmp";
+    int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        error = "cannot open " + temporary + ": " + std::strerror(errno);
+        return false;
+    }
+
+    ArrowHistoryExporter exporter(history, request, store);
+    std::string chunk;
+    bool more = true;
+    bool ok = true;
+    while (more && ok) {
+        chunk.clear();
+        more = exporter.next(chunk);
+        ok = writeAll(fd, chunk);
+    }
+    if (!ok) error = "write failed: " + std::string(std::strerror(errno));
+    if (::close(fd) != 0 && ok) {
+        error = "close failed: " + std::string(std::strerror(errno));
+        ok = false;
+    }
+    if (ok && std::rename(temporary.c_str(), path.c_str()) != 0) {
+        error = "rename failed: " + std::string(std::strerror(errno));
+        ok = false;
+    }
+    if (!ok) ::unlink(temporary.c_str());
+    return ok;
+}
+
+void registerArrowExportApi(HttpServer& server, const MetricHistory& history, const SegmentStore* store,
+                            const std::string& path) {
+    server.route(path, [&history, store](const HttpRequest& request, HttpResponse& response) {
+        HistoryQuery range;
+        std::string error;
+        ArrowExportRequest exportRequest;
+
+        std::string table = request.queryParam("table", "device");
+        if (table == "device") {
+            exportRequest.table = HistoryTable::Device;
+        } else if (table == "process") {
+            exportRequest.table = HistoryTable::Process;
+        } else {
+            error = "unknown table";
+        }
+
+        std::string metrics = request.queryParam("metrics");
+        size_t pos = 0;
+        while (error.empty() && pos < metrics.size()) {
+            size_t end = metrics.find(',', pos);
+            if (end == std::string::npos) end = metrics.size();
+            std::string name = metrics.substr(pos, end - pos);
+            pos = end + 1;
+            if (name.empty()) continue;
+            int metric = historyMetricFromName(name);
+            if (metric < 0 || historyMetricTable(metric) != HistoryTable::Device) {
+                error = "unknown device metric " + name;
+            }
+            exportRequest.metrics.push_back(metric);
+        }
+
+        if (!error.empty() || !parseHistoryRange(request, history, range, error)) {
+            response.status = 400;
+            response.body = error + "\n";
+            return;
+        }
+        exportRequest.start = range.start;
+        exportRequest.end = range.end;
+        exportRequest.deviceMask = range.deviceMask;
+        exportRequest.pids = range.pids;
+
+        // 블록 하나씩 인코딩해 chunked로 보낸다 (메모리는 블록 하나 분량)
+        auto exporter = std::make_shared<ArrowHistoryExporter>(history, exportRequest, store);
+        response.contentType = "application/vnd.apache.arrow.file";
+        response.headers.emplace_back("Content-Disposition", "attachment; filename=\"nvml_" + table + ".arrow\"");
+        response.stream = [exporter](std::string& out) { return exporter->next(out); };
+    });
+}
@@ -0,0 +1,118 @@
+#ifndef NVML_ARROW_H
+#define NVML_ARROW_H
+
+#include "nvml_segment.h"
+
+// 내보낼 히스토리 범위
+struct ArrowExportRequest {
+    HistoryTable table = HistoryTable::Device;
+    int64_t start = 0;             // ms, 포함
+    int64_t end = INT64_MAX;       // ms, 제외
+    uint64_t deviceMask = ~0ULL;
+    std::vector<int> metrics;      // Device 테이블 지표 열 (비어 있으면 전체)
+    std::vector<uint32_t> pids;    // Process 테이블 (비어 있으면 전체)
+};
+
+// 히스토리 -> Arrow IPC 파일 형식 (Feather V2와 같다)
+// 히스토리 블록 하나를 레코드 배치 하나로 인코딩해 조각 단위로 내보내므로
+// 메모리 사용량은 블록 하나 크기를 넘지 않는다
+// 세그먼트 저장소가 있으면 파일에 든 행(persistedUntil 이하)은 세그먼트에서, 그 뒤는 메모리 블록에서 읽는다
+//
+// 스키마 (Device): timestamp timestamp[ms, UTC], gpu uint32, uuid dictionary<int32, utf8>, 지표 열들
+//        (Process): timestamp, gpu, uuid, pid uint32, name dictionary<int32, utf8>, process_memory uint64
+class ArrowHistoryExporter {
+private:
+    struct FileBlock {
+        int64_t offset;
+        int32_t metadataLength;
+        int64_t bodyLength;
+    };
+
+    enum class ColumnType {
+        Timestamp,  // timestamp[ms, UTC]
+        UInt32,
+        UInt64,
+        Dictionary  // dictionary<int32, utf8>
+    };
+
+    struct Column {
+        std::string name;
+        ColumnType type;
+        int source;          // kSource* 또는 HistoryBlock::values 인덱스
+        int64_t dictionary;  // Dictionary 열의 사전 id
+    };
+
+    // 블록 하나의 열 포인터 (메모리 블록 또는 mmap 세그먼트 블록)
+    struct BatchRows {
+        size_t count = 0;
+        const int64_t* timestamps = nullptr;
+        const uint32_t* devices = nullptr;
+        const uint32_t* pids = nullptr;
+        const uint32_t* names = nullptr;
+        const uint32_t* nameMap = nullptr;   // names -> 내보내기 사전 id (nullptr이면 그대로)
+        const double* values[HM_DEVICE_METRIC_COUNT] = {};
+    };
+
+    struct Segment {
+        std::unique_ptr<SegmentFile> file;
+        std::vector<uint32_t> nameMap;       // 세그먼트 이름 id -> names 인덱스
+    };
+
+    enum class Stage {
+        Schema,
+        Dictionaries,
+        Batches,
+        Done
+    };
+
+    ArrowExportRequest request;
+    std::vector<Column> columns;
+    std::vector<HistoryBlockPtr> blocks;
+    std::vector<Segment> segments;
+    int64_t persistedUntil;      // 이 시각 이하의 행은 세그먼트에서 읽는다
+    std::vector<std::string> uuids;
+    std::vector<std::string> names;
+    size_t nextBlock;
+    size_t nextSegment;
+    size_t nextSegmentBlock;
+    Stage stage;
+
+    int64_t offset;  // 지금까지 내보낸 바이트 (푸터의 블록 위치)
+    std::vector<FileBlock> dictionaryBlocks;
+    std::vector<FileBlock> recordBlocks;
+    std::string body;           // 메시지 본문 (재사용)
+    std::vector<uint32_t> selection;
+    uint64_t rows;
+
+public:
+    ArrowHistoryExporter(const MetricHistory& history, const ArrowExportRequest& request,
+                         const SegmentStore* store = nullptr);
+
+    // 다음 조각을 out에 덧붙인다. 마지막 조각이면 false
+    bool next(std::string& out);
+
+    uint64_t rowsWritten() const { return rows; }
+    uint64_t bytesWritten() const { return static_cast<uint64_t>(offset); }
+
+private:
+    void writeSchema(bool footer, std::string& out);
+    void writeDictionary(int64_t id, const std::vector<std::string>& values, std::string& out);
+    void openSegments(const SegmentStore& store);
+    bool writeBlock(const HistoryBlock& block, std::string& out);
+    bool writeSegmentBlock(const Segment& segment, size_t index, std::string& out);
+    bool writeBatch(const BatchRows& rows, int64_t start, int64_t end, std::string& out);
+    void writeFooter(std::string& out);
+    FileBlock writeMessage(const std::string& metadata, std::string& out);
+};
+
+// 파일로 내보내기 (조각마다 write)
+bool exportHistoryArrow(const MetricHistory& history, const ArrowExportRequest& request, const std::string& path,
+                        std::string& error, const SegmentStore* store = nullptr);
+
+// HTTP API (/api/export). 쿼리는 /api/query와 같은 형식
+//   table=device|process&start=-1h&end=now&metrics=gpu_utilization,temperature&gpu=0&pid=123
+// 응답은 chunked로 스트리밍한다 (curl -o history.arrow ...). store가 있으면 세그먼트 파일의 행도 함께 내보낸다
+void registerArrowExportApi(HttpServer& server, const MetricHistory& history, const SegmentStore* store = nullptr,
+                            const std::string& path = "/api/export");
+
+#endif // NVML_ARROW_H
@@ -0,0 +1,248 @@
+#include "nvml_cardinality.h"
+#include <chrono>
+
+namespace {
+
+const char* const kFamilyNames[CARDINALITY_FAMILY_COUNT] = {"process_memory", "process_cpu"};
+
+uint64_t processKey(const ProcessInfo& process) {
+    return (static_cast<uint64_t>(process.deviceIndex) << 32) | process.pid;
+}
+
+} // namespace
+
+CardinalityLimiter::CardinalityLimiter(const CardinalityConfig& config)
+    : config(config), otherName(internString("other")) {
+    for (int i = 0; i < CARDINALITY_FAMILY_COUNT; i++) {
+        if (config.limits[i].maxSeries > 0) {
+            trackers[i].entries.reserve(config.limits[i].maxSeries);
+            trackers[i].index.reserve(config.limits[i].maxSeries);
+        }
+    }
+}
+
+void CardinalityLimiter::unlink(Tracker& tracker, uint32_t entry) {
+    Entry& e = tracker.entries[entry];
+    if (e.prev != kNone) tracker.entries[e.prev].next = e.next;
+    else tracker.head = e.next;
+    if (e.next != kNone) tracker.entries[e.next].prev = e.prev;
+    else tracker.tail = e.prev;
+    e.prev = e.next = kNone;
+}
+
+void CardinalityLimiter::pushFront(Tracker& tracker, uint32_t entry) {
+    Entry& e = tracker.entries[entry];
+    e.prev = kNone;
+    e.next = tracker.head;
+    if (tracker.head != kNone) tracker.entries[tracker.head].prev = entry;
+    tracker.head = entry;
+    if (tracker.tail == kNone) tracker.tail = entry;
+}
+
+bool CardinalityLimiter::touch(Tracker& tracker, uint64_t key, int64_t nowMs) {
+    auto it = tracker.index.find(key);
+    if (it == tracker.index.end()) return false;
+    tracker.entries[it->second].lastSeenMs = nowMs;
+    if (tracker.head != it->second) {
+        unlink(tracker, it->second);
+        pushFront(tracker, it->second);
+    }
+    return true;
+}
+
+bool CardinalityLimiter::admit(Tracker& tracker, size_t limit, uint64_t key, int64_t nowMs) {
+    if (touch(tracker, key, nowMs)) return true;   // 같은 틱에 두 번 나온 키 (graphics + compute)
+
+    uint32_t entry;
+    if (tracker.index.size() < limit) {
+        if (!tracker.freeEntries.empty()) {
+            entry = tracker.freeEntries.back();
+            tracker.freeEntries.pop_back();
+        } else {
+            entry = static_cast<uint32_t>(tracker.entries.size());
+            tracker.entries.push_back(Entry());
+        }
+    } else if (tracker.tail != kNone && tracker.entries[tracker.tail].lastSeenMs < nowMs) {
+        // 가득 찼지만 가장 오래된 키가 이번 틱에 없었다: 그 자리를 준다
+        entry = tracker.tail;
+        tracker.index.erase(tracker.entries[entry].key);
+        unlink(tracker, entry);
+        tracker.evicted++;
+    } else {
+        return false;
+    }
+
+    tracker.entries[entry].key = key;
+    tracker.entries[entry].lastSeenMs = nowMs;
+    tracker.index[key] = entry;
+    pushFront(tracker, entry);
+    tracker.admitted++;
+    return true;
+}
+
+void CardinalityLimiter::expire(Tracker& tracker, int64_t nowMs) {
+    while (tracker.tail != kNone && nowMs - tracker.entries[tracker.tail].lastSeenMs > config.idleMs) {
+        uint32_t entry = tracker.tail;
+        tracker.index.erase(tracker.entries[entry].key);
+        unlink(tracker, entry);
+        tracker.freeEntries.push_back(entry);
+        tracker.evicted++;
+    }
+}
+
+SnapshotPtr CardinalityLimiter::apply(const SnapshotPtr& snapshot) {
+    int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        snapshot->timestamp.time_since_epoch()).count();
+    std::shared_ptr<MetricsSnapshot> limited;   // 넘친 것이 있을 때만 복사한다
+    std::vector<char> keep;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const CardinalityLimit& memoryLimit = config.limits[CARDINALITY_PROCESS_MEMORY];
+    if (memoryLimit.maxSeries > 0) {
+        Tracker& tracker = trackers[CARDINALITY_PROCESS_MEMORY];
+        const auto& processes = snapshot->processes;
+        expire(tracker, nowMs);
+        keep.assign(processes.size(), 0);
+        bool overflow = false;
+        for (size_t i = 0; i < processes.size(); i++) {
+            keep[i] = touch(tracker, processKey(processes[i]), nowMs);
+        }
+        for (size_t i = 0; i < processes.size(); i++) {
+            if (!keep[i]) {
+                keep[i] = admit(tracker, memoryLimit.maxSeries, processKey(processes[i]), nowMs);
+                overflow |= !keep[i];
+            }
+        }
+
+        if (overflow) {
+            limited = std::make_shared<MetricsSnapshot>(*snapshot);
+            limited->processes.clear();
+            std::vector<ProcessInfo> others;    // 디바이스마다 하나
+            for (size_t i = 0; i < processes.size(); i++) {
+                const ProcessInfo& process = processes[i];
+                if (keep[i]) {
+                    limited->processes.push_back(process);
+                    continue;
+                }
+                if (!memoryLimit.foldOverflow) {
+                    tracker.dropped++;
+                    continue;
+                }
+                tracker.folded++;
+                ProcessInfo* other = nullptr;
+                for (auto& candidate : others) {
+                    if (candidate.deviceIndex == process.deviceIndex) other = &candidate;
+                }
+                if (!other) {
+                    others.push_back(process);
+                    others.back().pid = 0;
+                    others.back().nameId = otherName;
+                    others.back().usedGpuMemory = 0;
+                    other = &others.back();
+                }
+                other->usedGpuMemory += process.usedGpuMemory;
+            }
+            limited->processes.insert(limited->processes.end(), others.begin(), others.end());
+        }
+    }
+
+    const CardinalityLimit& cpuLimit = config.limits[CARDINALITY_PROCESS_CPU];
+    if (cpuLimit.maxSeries > 0 && snapshot->host.valid) {
+        Tracker& tracker = trackers[CARDINALITY_PROCESS_CPU];
+        const auto& processes = snapshot->host.processes;
+        expire(tracker, nowMs);
+        keep.assign(processes.size(), 0);
+        bool overflow = false;
+        for (size_t i = 0; i < processes.size(); i++) {
+            keep[i] = touch(tracker, processes[i].pid, nowMs);
+        }
+        for (size_t i = 0; i < processes.size(); i++) {
+            if (!keep[i]) {
+                keep[i] = admit(tracker, cpuLimit.maxSeries, processes[i].pid, nowMs);
+                overflow |= !keep[i];
+            }
+        }
+
+        if (overflow) {
+            if (!limited) limited = std::make_shared<MetricsSnapshot>(*snapshot);
+            limited->host.processes.clear();
+            double otherPercent = 0;
+            for (size_t i = 0; i < processes.size(); i++) {
+                if (keep[i]) {
+                    limited->host.processes.push_back(processes[i]);
+                } else if (cpuLimit.foldOverflow) {
+                    otherPercent += processes[i].cpuPercent;
+                    tracker.folded++;
+                } else {
+                    tracker.dropped++;
+                }
+            }
+            if (cpuLimit.foldOverflow) {
+                // 합쳐지는 프로세스가 바뀌어도 카운터가 줄지 않도록 누적 시간은 틱별 사용량으로 쌓는다
+                otherCpuMs += otherPercent * snapshot->host.intervalMs / 100.0;
+                HostProcessCpu other;
+                other.pid = 0;
+                other.cpuTimeMs = static_cast<unsigned long long>(otherCpuMs);
+                other.cpuPercent = otherPercent;
+                limited->host.processes.push_back(other);
+            }
+        }
+    }
+
+    if (!limited) return snapshot;
+    return limited;
+}
+
+CardinalityStats CardinalityLimiter::getStats(CardinalityFamily family) {
+    std::lock_guard<std::mutex> lock(mutex);
+    const Tracker& tracker = trackers[family];
+    CardinalityStats stats;
+    stats.series = tracker.index.size();
+    stats.limit = config.limits[family].maxSeries;
+    stats.admitted = tracker.admitted;
+    stats.evicted = tracker.evicted;
+    stats.folded = tracker.folded;
+    stats.dropped = tracker.dropped;
+    return stats;
+}
+
+void CardinalityLimiter::renderMetrics(std::string& out) {
+    CardinalityStats stats[CARDINALITY_FAMILY_COUNT];
+    for (int i = 0; i < CARDINALITY_FAMILY_COUNT; i++) {
+        stats[i] = getStats(static_cast<CardinalityFamily>(i));
+    }
+
+    auto family = [&](const char* name, const char* type, const char* help, auto value) {
+        out += "# HELP ";
+        out += name;
+        out += " ";
+        out += help;
+        out += "\n# TYPE ";
+        out += name;
+        out += " ";
+        out += type;
+        out += "\n";
+        for (int i = 0; i < CARDINALITY_FAMILY_COUNT; i++) {
+            out += name;
+            out += "{family=\"";
+            out += kFamilyNames[i];
+            out += "\"} ";
+            out += std::to_string(value(stats[i]));
+            out += "\n";
+        }
+    };
+
+    family("nvml_cardinality_series", "gauge", "Per-process series currently tracked for export.",
+           [](const CardinalityStats& s) { return static_cast<uint64_t>(s.series); });
+    family("nvml_cardinality_limit", "gauge", "Series cap (0 means unlimited).",
+           [](const CardinalityStats& s) { return static_cast<uint64_t>(s.limit); });
+    family("nvml_cardinality_admitted_total", "counter", "Series admitted to the tracked set.",
+           [](const CardinalityStats& s) { return s.admitted; });
+    family("nvml_cardinality_evicted_total", "counter", "Idle series evicted from the tracked set.",
+           [](const CardinalityStats& s) { return s.evicted; });
+    family("nvml_cardinality_folded_total", "counter", "Samples folded into the \"other\" series.",
+           [](const CardinalityStats& s) { return s.folded; });
+    family("nvml_cardinality_dropped_total", "counter", "Samples dropped over the series cap.",
+           [](const CardinalityStats& s) { return s.dropped; });
+}
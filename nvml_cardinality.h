@@ -0,0 +1,87 @@
+#ifndef NVML_CARDINALITY_H
+#define NVML_CARDINALITY_H
+
+#include "nvml_exporter.h"
+#include <mutex>
+#include <unordered_map>
+
+// 프로세스/PID 단위 시계열 묶음 (묶음마다 상한이 따로 있다)
+enum CardinalityFamily {
+    CARDINALITY_PROCESS_MEMORY = 0,     // snapshot.processes (gpu, pid)
+    CARDINALITY_PROCESS_CPU = 1,        // snapshot.host.processes (pid)
+    CARDINALITY_FAMILY_COUNT = 2
+};
+
+struct CardinalityLimit {
+    size_t maxSeries = 1000;            // 0이면 제한 없음
+    bool foldOverflow = true;           // false면 넘친 시계열을 "other"로 합치지 않고 버린다
+};
+
+struct CardinalityConfig {
+    CardinalityLimit limits[CARDINALITY_FAMILY_COUNT];
+    int64_t idleMs = 5 * 60 * 1000;     // 이만큼 보이지 않은 PID는 추적에서 뺀다
+};
+
+struct CardinalityStats {
+    size_t series;          // 지금 추적 중인 시계열
+    size_t limit;
+    uint64_t admitted;
+    uint64_t evicted;       // 유휴라서 자리를 내준 시계열
+    uint64_t folded;        // "other"로 합친 샘플
+    uint64_t dropped;       // 버린 샘플
+};
+
+// 내보내기 경로의 카디널리티 제한
+// 묶음마다 상한만큼의 (gpu, pid) 키를 LRU로 추적한다. 새 키는 빈자리가 있거나 가장 오래된 키가
+// 이번 틱에 보이지 않았으면(유휴) 그 자리를 받고, 아니면 디바이스별 "other" 항목(pid 0)에 합쳐진다.
+// 이미 추적 중인 키는 새 키보다 먼저 갱신하므로 살아 있는 시계열이 뒤늦게 온 키에 밀리지 않는다.
+// 넘친 것이 없는 틱은 스냅샷을 복사하지 않고 그대로 돌려준다
+class CardinalityLimiter {
+private:
+    static const uint32_t kNone = UINT32_MAX;
+
+    struct Entry {
+        uint64_t key;
+        int64_t lastSeenMs;
+        uint32_t prev;      // 더 최근
+        uint32_t next;      // 더 오래됨
+    };
+
+    // 고정 크기 풀 위의 LRU (head가 가장 최근)
+    struct Tracker {
+        std::vector<Entry> entries;
+        std::vector<uint32_t> freeEntries;
+        std::unordered_map<uint64_t, uint32_t> index;
+        uint32_t head = kNone;
+        uint32_t tail = kNone;
+
+        uint64_t admitted = 0;
+        uint64_t evicted = 0;
+        uint64_t folded = 0;
+        uint64_t dropped = 0;
+    };
+
+    CardinalityConfig config;
+    std::mutex mutex;
+    Tracker trackers[CARDINALITY_FAMILY_COUNT];
+    InternId otherName;
+    double otherCpuMs = 0;      // "other"의 누적 CPU 시간 (합쳐진 프로세스의 틱별 사용량을 더한다)
+
+public:
+    explicit CardinalityLimiter(const CardinalityConfig& config = CardinalityConfig());
+
+    // 수집 스레드에서 틱마다 한 번 (제한한 스냅샷, 넘친 것이 없으면 입력 그대로)
+    SnapshotPtr apply(const SnapshotPtr& snapshot);
+
+    CardinalityStats getStats(CardinalityFamily family);
+    void renderMetrics(std::string& out);
+
+private:
+    bool touch(Tracker& tracker, uint64_t key, int64_t nowMs);
+    bool admit(Tracker& tracker, size_t limit, uint64_t key, int64_t nowMs);
+    void expire(Tracker& tracker, int64_t nowMs);
+    void unlink(Tracker& tracker, uint32_t entry);
+    void pushFront(Tracker& tracker, uint32_t entry);
+};
+
+#endif // NVML_CARDINALITY_H
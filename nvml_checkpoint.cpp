@@ -0,0 +1,331 @@
+#include "nvml_checkpoint.h"
+#include "nvml_util.h"
+#include <cerrno>
+#include <chrono>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const char kHeaderMagic[8] = {'N', 'V', 'C', 'K', 'P', 'T', '0', '1'};
+const char kTrailerMagic[8] = {'N', 'V', 'C', 'K', 'P', 'E', 'N', 'D'};
+const uint32_t kCheckpointVersion = 2; // 2: 섹션 payload CRC
+const size_t kTrailerBytes = 4 + 8;
+const size_t kWriteBufferBytes = 1024 * 1024;
+
+double elapsedMs(std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+}
+
+void syncParentDirectory(const std::string& path) {
+    size_t slash = path.rfind('/');
+    std::string directory = slash == std::string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+}
+
+} // namespace
+
+CheckpointWriter::CheckpointWriter(int fd) : fd(fd), offset(0), crc(0), failed(false) {
+    buffer.reserve(kWriteBufferBytes);
+}
+
+void CheckpointWriter::putString(const std::string& value) {
+    put<uint32_t>(static_cast<uint32_t>(value.size()));
+    append(value.data(), value.size());
+}
+
+void CheckpointWriter::append(const void* data, size_t size) {
+    offset += size;
+    crc = updateCrc32(crc, data, size);
+    if (buffer.size() + size <= kWriteBufferBytes) {
+        buffer.append(static_cast<const char*>(data), size);
+        return;
+    }
+    // 큰 열은 버퍼를 거치지 않고 바로 쓴다
+    if (!flush()) return;
+    const char* pos = static_cast<const char*>(data);
+    while (size > 0 && !failed) {
+        ssize_t n = ::write(fd, pos, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            failed = true;
+            break;
+        }
+        pos += n;
+        size -= n;
+    }
+}
+
+void CheckpointWriter::patchBytes(uint64_t position, const void* data, size_t size) {
+    if (!flush()) return;
+    if (::pwrite(fd, data, size, static_cast<off_t>(position)) != static_cast<ssize_t>(size)) {
+        failed = true;
+    }
+}
+
+bool CheckpointWriter::flush() {
+    size_t done = 0;
+    while (done < buffer.size() && !failed) {
+        ssize_t n = ::write(fd, buffer.data() + done, buffer.size() - done);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            failed = true;
+            break;
+        }
+        done += n;
+    }
+    buffer.clear();
+    return !failed;
+}
+
+std::string CheckpointReader::getString() {
+    uint32_t length = get<uint32_t>();
+    if (!ok || static_cast<size_t>(end - pos) < length) {
+        ok = false;
+        return "";
+    }
+    std::string value(reinterpret_cast<const char*>(pos), length);
+    pos += length;
+    return value;
+}
+
+void CheckpointReader::skip(size_t bytes) {
+    if (!ok || static_cast<size_t>(end - pos) < bytes) {
+        ok = false;
+        return;
+    }
+    pos += bytes;
+}
+
+std::string readBootId() {
+    std::ifstream file("/proc/sys/kernel/random/boot_id");
+    std::string id;
+    std::getline(file, id);
+    return id;
+}
+
+CheckpointManager::CheckpointManager(const CheckpointConfig& config)
+    : config(config), bootId(readBootId()), stats{}, running(false) {}
+
+CheckpointManager::~CheckpointManager() {
+    stop();
+}
+
+void CheckpointManager::setFingerprint(const std::vector<std::string>& uuids) {
+    std::lock_guard<std::mutex> lock(mutex);
+    fingerprint.clear();
+    for (const auto& uuid : uuids) {
+        fingerprint += uuid;
+        fingerprint += ',';
+    }
+}
+
+void CheckpointManager::addSection(const CheckpointSection& section) {
+    std::lock_guard<std::mutex> lock(mutex);
+    sections.push_back(section);
+}
+
+bool CheckpointManager::save(std::string& error) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto started = std::chrono::steady_clock::now();
+    std::string tmpPath = config.path + ".tmp";
+
+    int fd = ::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        error = "cannot create " + tmpPath + ": " + std::strerror(errno);
+        stats.saveErrors++;
+        return false;
+    }
+
+    CheckpointWriter writer(fd);
+    writer.append(kHeaderMagic, sizeof(kHeaderMagic));
+    writer.put<uint32_t>(kCheckpointVersion);
+    writer.put<int64_t>(nowMillis());
+    writer.putString(bootId);
+    writer.putString(fingerprint);
+
+    for (const auto& section : sections) {
+        writer.putString(section.name);
+        writer.put<uint32_t>(section.version);
+        uint64_t lengthPosition = writer.position();
+        writer.put<uint64_t>(0);
+        writer.put<uint32_t>(0);
+        uint64_t start = writer.position();
+        writer.resetChecksum();
+        section.save(writer);
+        writer.patch<uint64_t>(lengthPosition, writer.position() - start);
+        writer.patch<uint32_t>(lengthPosition + sizeof(uint64_t), writer.checksum());
+    }
+
+    writer.put<uint32_t>(static_cast<uint32_t>(sections.size()));
+    writer.append(kTrailerMagic, sizeof(kTrailerMagic));
+
+    bool ok = writer.flush() && ::fsync(fd) == 0;
+    if (!ok) error = "cannot write " + tmpPath + ": " + std::strerror(errno);
+    ::close(fd);
+    if (ok && ::rename(tmpPath.c_str(), config.path.c_str()) != 0) {
+        error = "cannot rename " + tmpPath + ": " + std::strerror(errno);
+        ok = false;
+    }
+    if (!ok) {
+        ::unlink(tmpPath.c_str());
+        stats.saveErrors++;
+        return false;
+    }
+    syncParentDirectory(config.path);
+
+    stats.saves++;
+    stats.lastBytes = writer.position();
+    stats.lastSaveMs = elapsedMs(started);
+    return true;
+}
+
+bool CheckpointManager::restore(std::string& error) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto started = std::chrono::steady_clock::now();
+
+    int fd = ::open(config.path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        error = "no checkpoint at " + config.path;
+        return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(kHeaderMagic) + kTrailerBytes) {
+        ::close(fd);
+        error = "checkpoint is truncated";
+        return false;
+    }
+    size_t size = st.st_size;
+    void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        error = std::string("cannot map checkpoint: ") + std::strerror(errno);
+        return false;
+    }
+    const uint8_t* data = static_cast<const uint8_t*>(mapped);
+
+    bool accepted = false;
+    do {
+        if (std::memcmp(data + size - sizeof(kTrailerMagic), kTrailerMagic, sizeof(kTrailerMagic)) != 0) {
+            error = "checkpoint is truncated";
+            break;
+        }
+        uint32_t sectionCount;
+        std::memcpy(&sectionCount, data + size - kTrailerBytes, sizeof(sectionCount));
+
+        CheckpointReader reader(data, size - kTrailerBytes);
+        if (std::memcmp(data, kHeaderMagic, sizeof(kHeaderMagic)) != 0) {
+            error = "not a checkpoint file";
+            break;
+        }
+        reader.skip(sizeof(kHeaderMagic));
+        uint32_t version = reader.get<uint32_t>();
+        int64_t created = reader.get<int64_t>();
+        std::string fileBootId = reader.getString();
+        std::string fileFingerprint = reader.getString();
+        if (!reader.good()) {
+            error = "checkpoint header is corrupt";
+            break;
+        }
+        if (version != kCheckpointVersion) {
+            error = "incompatible checkpoint version " + std::to_string(version);
+            break;
+        }
+        int64_t age = nowMillis() - created;
+        if (config.maxAgeMs > 0 && age > config.maxAgeMs) {
+            error = "stale checkpoint (" + std::to_string(age / 1000) + "s old)";
+            break;
+        }
+        if (fileFingerprint != fingerprint) {
+            error = "checkpoint was taken with a different device configuration";
+            break;
+        }
+        bool sameBoot = !bootId.empty() && fileBootId == bootId;
+
+        accepted = true;
+        for (uint32_t i = 0; i < sectionCount; i++) {
+            std::string name = reader.getString();
+            uint32_t sectionVersion = reader.get<uint32_t>();
+            uint64_t length = reader.get<uint64_t>();
+            uint32_t crc = reader.get<uint32_t>();
+            if (!reader.good() || length > reader.remaining()) {
+                std::cerr << "Checkpoint section " << i << " is corrupt, skipping the rest" << std::endl;
+                stats.sectionsSkipped += sectionCount - i;
+                break;
+            }
+            CheckpointReader payload(reader.current(), length);
+            reader.skip(length);
+
+            const CheckpointSection* section = nullptr;
+            for (const auto& candidate : sections) {
+                if (candidate.name == name) section = &candidate;
+            }
+            const char* reason = nullptr;
+            if (!section) {
+                reason = "unknown section";
+            } else if (section->version != sectionVersion) {
+                reason = "section version changed";
+            } else if (section->bootScoped && !sameBoot) {
+                reason = "taken before reboot";
+            } else if (updateCrc32(0, payload.current(), payload.remaining()) != crc) {
+                reason = "checksum mismatch";
+            } else if (!section->restore(payload) || !payload.good()) {
+                reason = "restore failed";
+            }
+            if (reason) {
+                std::cerr << "Checkpoint section " << name << " skipped: " << reason << std::endl;
+                stats.sectionsSkipped++;
+            } else {
+                stats.sectionsRestored++;
+            }
+        }
+    } while (false);
+
+    ::munmap(mapped, size);
+    stats.restoreMs = elapsedMs(started);
+    return accepted;
+}
+
+void CheckpointManager::start() {
+    if (running || config.intervalMs <= 0) return;
+    running = true;
+    checkpointThread = std::thread(&CheckpointManager::checkpointLoop, this);
+}
+
+void CheckpointManager::stop() {
+    if (!running) return;
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        running = false;
+    }
+    wake.notify_all();
+    if (checkpointThread.joinable()) checkpointThread.join();
+}
+
+void CheckpointManager::checkpointLoop() {
+    while (running) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wake.wait_for(lock, std::chrono::milliseconds(config.intervalMs), [this] { return !running; });
+        }
+        if (!running) break;
+
+        std::string error;
+        if (!save(error)) {
+            std::cerr << "Checkpoint failed: " << error << std::endl;
+        }
+    }
+}
+
+CheckpointStats CheckpointManager::getStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
@@ -0,0 +1,178 @@
+#ifndef NVML_CHECKPOINT_H
+#define NVML_CHECKPOINT_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 체크포인트 파일 (리틀 엔디언)
+//   헤더     "NVCKPT01", u32 version, i64 createdMs, string bootId, string fingerprint
+//   섹션들   string name, u32 sectionVersion, u64 length, u32 payload CRC-32, payload
+//   트레일러 u32 sectionCount, "NVCKPEND"
+// string은 u32 길이 + 바이트. 임시 파일 + fsync + rename으로 쓰므로 잘린 파일은 트레일러로 걸러진다
+
+// 섹션 payload 쓰기. 파일로 바로 흘려 쓰므로 큰 섹션(히스토리 열)도 메모리에 한 번 더 올리지 않는다
+class CheckpointWriter {
+private:
+    int fd;
+    std::string buffer;
+    uint64_t offset;   // 파일 안 현재 위치 (버퍼 포함)
+    uint32_t crc;      // resetChecksum 이후 쓴 바이트의 CRC-32
+    bool failed;
+
+public:
+    explicit CheckpointWriter(int fd);
+
+    template <typename T>
+    void put(T value) {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T)); // x86/ARM 리틀 엔디언 가정
+        append(bytes, sizeof(T));
+    }
+
+    void putString(const std::string& value);
+
+    // u64 개수 + 원소 그대로 (POD)
+    template <typename T>
+    void putVector(const std::vector<T>& values) {
+        put<uint64_t>(values.size());
+        append(values.data(), values.size() * sizeof(T));
+    }
+
+    void append(const void* data, size_t size);
+    uint64_t position() const { return offset; }
+    void resetChecksum() { crc = 0; }
+    uint32_t checksum() const { return crc; }
+
+    // 이미 쓴 위치의 값을 고친다 (섹션 길이, CRC). 체크섬에는 반영하지 않는다
+    template <typename T>
+    void patch(uint64_t position, T value) {
+        patchBytes(position, &value, sizeof(T));
+    }
+    bool flush();
+    bool good() const { return !failed; }
+
+private:
+    void patchBytes(uint64_t position, const void* data, size_t size);
+};
+
+// 경계 검사하는 payload 읽기. 한 번이라도 넘치면 good()이 false가 되고 이후 값은 0
+class CheckpointReader {
+private:
+    const uint8_t* pos;
+    const uint8_t* end;
+    bool ok;
+
+public:
+    CheckpointReader(const uint8_t* data, size_t size) : pos(data), end(data + size), ok(true) {}
+
+    template <typename T>
+    T get() {
+        T value = T();
+        if (!ok || static_cast<size_t>(end - pos) < sizeof(T)) {
+            ok = false;
+            return value;
+        }
+        std::memcpy(&value, pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    std::string getString();
+
+    template <typename T>
+    bool getVector(std::vector<T>& values) {
+        uint64_t count = get<uint64_t>();
+        if (!ok || count > static_cast<size_t>(end - pos) / sizeof(T)) {
+            ok = false;
+            values.clear();
+            return false;
+        }
+        values.resize(count);
+        std::memcpy(values.data(), pos, count * sizeof(T));
+        pos += count * sizeof(T);
+        return true;
+    }
+
+    const uint8_t* current() const { return pos; }
+    void skip(size_t bytes);
+    size_t remaining() const { return end - pos; }
+    bool good() const { return ok; }
+    bool done() const { return ok && pos == end; }
+};
+
+// 상태를 가진 구성 요소마다 하나씩 등록한다
+struct CheckpointSection {
+    std::string name;
+    uint32_t version = 1;     // payload 형식. 파일의 버전과 다르면 복원하지 않는다
+    bool bootScoped = false;  // 같은 부팅에서만 유효 (NVML 샘플 타임스탬프 커서 등)
+    std::function<void(CheckpointWriter&)> save;
+    std::function<bool(CheckpointReader&)> restore; // 실패하면 상태를 바꾸지 않고 false
+};
+
+struct CheckpointConfig {
+    std::string path;
+    int64_t intervalMs = 60 * 1000;
+    int64_t maxAgeMs = 6LL * 3600 * 1000; // 이보다 오래된 체크포인트는 복원하지 않는다
+};
+
+struct CheckpointStats {
+    uint64_t saves;
+    uint64_t saveErrors;
+    uint64_t lastBytes;
+    double lastSaveMs;
+    size_t sectionsRestored;
+    size_t sectionsSkipped;   // 버전/부팅 불일치, 모르는 섹션, 복원 실패
+    double restoreMs;
+};
+
+// 주기적 체크포인트와 시작 시 복원
+// 파일 전체는 형식 버전, 디바이스 구성(fingerprint), 나이로 호환성을 판단하고
+// 섹션은 이름과 섹션 버전이 맞는 것만 복원한다. bootScoped 섹션은 부팅 id가 같을 때만 복원한다
+class CheckpointManager {
+private:
+    CheckpointConfig config;
+    std::string bootId;
+    std::string fingerprint;
+
+    std::mutex mutex; // sections, stats, 저장 직렬화
+    std::vector<CheckpointSection> sections;
+    CheckpointStats stats;
+
+    std::atomic<bool> running;
+    std::thread checkpointThread;
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+
+public:
+    explicit CheckpointManager(const CheckpointConfig& config);
+    ~CheckpointManager();
+
+    // 디바이스 구성 (UUID 인덱스 순). 다른 구성에서 만든 체크포인트는 복원하지 않는다
+    void setFingerprint(const std::vector<std::string>& uuids);
+    void addSection(const CheckpointSection& section);
+
+    // 시작 시 한 번. 파일이 없거나 호환되지 않으면 false (error에 이유)
+    bool restore(std::string& error);
+    bool save(std::string& error);
+
+    // 주기 저장 스레드
+    void start();
+    void stop();
+
+    CheckpointStats getStats();
+
+private:
+    void checkpointLoop();
+};
+
+// /proc/sys/kernel/random/boot_id (없으면 빈 문자열)
+std::string readBootId();
+
+#endif // NVML_CHECKPOINT_H
@@ -0,0 +1,379 @@
+#include "nvml_compaction.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <tuple>
+#include <unistd.h>
+
+namespace {
+
+const size_t kOutputBlockRows = 4096;
+
+// 입력 세그먼트들의 이름 id를 하나의 사전으로 모은다
+struct MergedNames {
+    std::vector<std::string> names;
+    std::unordered_map<std::string, uint32_t> ids;
+
+    uint32_t intern(const std::string& name) {
+        auto it = ids.find(name);
+        if (it != ids.end()) return it->second;
+        uint32_t id = static_cast<uint32_t>(names.size());
+        names.push_back(name);
+        ids.emplace(name, id);
+        return id;
+    }
+};
+
+// 다운샘플 그룹 (버킷 시각, 디바이스, PID). 이미 다운샘플된 행은 원본 샘플 수만큼 가중해 합친다
+struct DownsampleGroup {
+    uint64_t count = 0;
+    std::vector<double> sum;
+    std::vector<double> min;
+    std::vector<double> max;
+    uint32_t name = 0;
+    int64_t nameTimestamp = INT64_MIN;
+};
+
+void appendRow(HistoryBlock& block, int64_t ts, uint32_t device) {
+    block.timestamps.push_back(ts);
+    block.devices.push_back(device);
+    block.minTimestamp = std::min(block.minTimestamp, ts);
+    block.maxTimestamp = std::max(block.maxTimestamp, ts);
+    block.deviceMask |= historyDeviceBit(device);
+}
+
+// 크기 순으로 targetBytes까지 묶는다 (시간 순 입력)
+std::vector<std::vector<SegmentEntry>> batches(const std::vector<SegmentEntry>& entries, uint64_t targetBytes) {
+    std::vector<std::vector<SegmentEntry>> result;
+    uint64_t bytes = 0;
+    for (const auto& entry : entries) {
+        if (result.empty() || (bytes + entry.bytes > targetBytes && !result.back().empty())) {
+            result.emplace_back();
+            bytes = 0;
+        }
+        result.back().push_back(entry);
+        bytes += entry.bytes;
+    }
+    return result;
+}
+
+} // namespace
+
+SegmentCompactor::SegmentCompactor(SegmentStore& store, const CompactionConfig& config)
+    : store(store), config(config), limiter(config.ioBytesPerSecond, 1024 * 1024), running(false),
+      stopping(false), stats{} {
+    if (this->config.tiers.empty()) this->config.tiers.push_back({0, 0, 0});
+    this->config.minMergeSegments = std::max<size_t>(this->config.minMergeSegments, 2);
+}
+
+SegmentCompactor::~SegmentCompactor() {
+    stop();
+}
+
+void SegmentCompactor::start() {
+    if (running) return;
+    running = true;
+    stopping = false;
+    compactThread = std::thread(&SegmentCompactor::compactLoop, this);
+}
+
+void SegmentCompactor::stop() {
+    if (!running) return;
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        running = false;
+        stopping = true;
+    }
+    wake.notify_all();
+    if (compactThread.joinable()) compactThread.join();
+}
+
+void SegmentCompactor::compactLoop() {
+    while (running) {
+        runOnce(nowMillis());
+
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wake.wait_for(lock, std::chrono::milliseconds(config.intervalMs), [this] { return !running; });
+    }
+}
+
+std::vector<SegmentEntry> SegmentCompactor::tierEntries(uint32_t tier, HistoryTable table) {
+    std::vector<SegmentEntry> result;
+    for (const auto& entry : store.manifest()) {
+        if (entry.tier == tier && entry.table == table) result.push_back(entry);
+    }
+    std::sort(result.begin(), result.end(), [](const SegmentEntry& a, const SegmentEntry& b) {
+        return a.minTimestamp < b.minTimestamp;
+    });
+    return result;
+}
+
+void SegmentCompactor::runOnce(int64_t now) {
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.runs++;
+    }
+
+    for (uint32_t tier = 0; tier < config.tiers.size() && !stopping; tier++) {
+        const CompactionTier& current = config.tiers[tier];
+        bool last = tier + 1 == config.tiers.size();
+
+        for (HistoryTable table : {HistoryTable::Device, HistoryTable::Process}) {
+            // 1) 보관 기간
+            if (current.retentionMs > 0) {
+                std::vector<SegmentEntry> aged;
+                for (const auto& entry : tierEntries(tier, table)) {
+                    if (entry.maxTimestamp < now - current.retentionMs) aged.push_back(entry);
+                }
+                if (last) {
+                    if (!aged.empty()) remove(aged);
+                } else {
+                    for (const auto& batch : batches(aged, config.targetSegmentBytes)) {
+                        if (stopping) return;
+                        rewrite(batch, tier + 1, config.tiers[tier + 1].resolutionMs);
+                    }
+                }
+            }
+
+            // 3) 작은 세그먼트 병합
+            std::vector<SegmentEntry> small;
+            for (const auto& entry : tierEntries(tier, table)) {
+                if (entry.bytes < config.targetSegmentBytes / 2) small.push_back(entry);
+            }
+            if (small.size() >= config.minMergeSegments) {
+                for (const auto& batch : batches(small, config.targetSegmentBytes)) {
+                    if (stopping) return;
+                    if (batch.size() >= 2) rewrite(batch, tier, 0);
+                }
+            }
+        }
+
+        // 2) 단계 크기 상한 (두 테이블 합)
+        if (current.maxBytes > 0) {
+            std::vector<SegmentEntry> entries;
+            uint64_t total = 0;
+            for (const auto& entry : store.manifest()) {
+                if (entry.tier != tier) continue;
+                entries.push_back(entry);
+                total += entry.bytes;
+            }
+            std::sort(entries.begin(), entries.end(), [](const SegmentEntry& a, const SegmentEntry& b) {
+                return a.maxTimestamp < b.maxTimestamp;
+            });
+            std::vector<SegmentEntry> dropped;
+            for (const auto& entry : entries) {
+                if (total <= current.maxBytes) break;
+                dropped.push_back(entry);
+                total -= entry.bytes;
+            }
+            if (!dropped.empty()) remove(dropped);
+        }
+    }
+
+    store.deleteObsolete(config.deleteDelayMs);
+}
+
+bool SegmentCompactor::remove(const std::vector<SegmentEntry>& inputs) {
+    std::vector<std::string> files;
+    for (const auto& entry : inputs) {
+        files.push_back(entry.file);
+    }
+    bool ok = store.replace(files, {});
+    std::lock_guard<std::mutex> lock(statsMutex);
+    if (ok) {
+        stats.segmentsExpired += files.size();
+    } else {
+        stats.failures++;
+    }
+    return ok;
+}
+
+bool SegmentCompactor::rewrite(const std::vector<SegmentEntry>& inputs, uint32_t tier, int64_t resolutionMs) {
+    if (inputs.empty()) return false;
+    HistoryTable table = inputs.front().table;
+
+    MergedNames names;
+    std::vector<std::string> uuids;
+    std::vector<HistoryBlockPtr> output;
+    std::map<std::tuple<int64_t, uint32_t, uint32_t>, DownsampleGroup> groups;
+    size_t columns = HistoryBlock(table).values.size();
+    uint64_t rowsIn = 0;
+    uint64_t bytesRead = 0;
+
+    auto fail = [this](const std::string& error) {
+        std::cerr << "Segment compaction failed: " << error << std::endl;
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.failures++;
+        return false;
+    };
+
+    for (const auto& input : inputs) {
+        SegmentFile segment;
+        std::string error;
+        if (!segment.open(store.path(input.file), error)) return fail(error);
+
+        const SegmentInfo& info = segment.getInfo();
+        if (info.uuids.size() >= uuids.size()) uuids = info.uuids;
+        std::vector<uint32_t> nameMap;
+        for (const auto& entry : info.names) {
+            if (entry.first >= nameMap.size()) nameMap.resize(entry.first + 1, 0);
+            nameMap[entry.first] = names.intern(entry.second);
+        }
+
+        for (size_t b = 0; b < info.blocks.size(); b++) {
+            if (stopping) return false;
+            SegmentBlockView view = segment.block(b);
+            size_t blockBytes = view.rows * (12 + columns * 8 + (table == HistoryTable::Process ? 8 : 0) +
+                                             (view.counts ? 4 + columns * 24 : 0));
+            limiter.acquire(blockBytes);
+            bytesRead += blockBytes;
+            rowsIn += view.rows;
+
+            if (table == HistoryTable::Process) {
+                for (size_t i = 0; i < view.rows; i++) {
+                    if (view.names[i] >= nameMap.size()) return fail(input.file + ": unknown process name id");
+                }
+            }
+
+            if (resolutionMs <= 0) {
+                // 병합: 블록을 그대로 옮긴다 (이름 id만 새 사전으로)
+                auto block = std::make_shared<HistoryBlock>(table);
+                block->timestamps.assign(view.timestamps, view.timestamps + view.rows);
+                block->devices.assign(view.devices, view.devices + view.rows);
+                if (table == HistoryTable::Process) {
+                    block->pids.assign(view.pids, view.pids + view.rows);
+                    block->names.resize(view.rows);
+                    for (size_t i = 0; i < view.rows; i++) {
+                        block->names[i] = nameMap[view.names[i]];
+                    }
+                }
+                for (size_t c = 0; c < columns; c++) {
+                    block->values[c].assign(view.values + c * view.rows, view.values + (c + 1) * view.rows);
+                }
+                if (view.counts) {
+                    block->counts.assign(view.counts, view.counts + view.rows);
+                    block->sums.resize(columns);
+                    block->mins.resize(columns);
+                    block->maxs.resize(columns);
+                    for (size_t c = 0; c < columns; c++) {
+                        block->sums[c].assign(view.sums + c * view.rows, view.sums + (c + 1) * view.rows);
+                        block->mins[c].assign(view.mins + c * view.rows, view.mins + (c + 1) * view.rows);
+                        block->maxs[c].assign(view.maxs + c * view.rows, view.maxs + (c + 1) * view.rows);
+                    }
+                }
+                block->minTimestamp = info.blocks[b].minTimestamp;
+                block->maxTimestamp = info.blocks[b].maxTimestamp;
+                block->deviceMask = info.blocks[b].deviceMask;
+                output.push_back(block);
+                continue;
+            }
+
+            // 다운샘플: (버킷, 디바이스, PID)별 샘플 수/합/최소/최대, 이름은 마지막 것
+            // 입력이 이미 다운샘플 블록이면 행의 count/sum/min/max를 그대로 합친다 (평균의 평균을 내지 않는다)
+            for (size_t i = 0; i < view.rows; i++) {
+                int64_t ts = view.timestamps[i];
+                int64_t bucket = ts - ((ts % resolutionMs) + resolutionMs) % resolutionMs;
+                uint32_t pid = table == HistoryTable::Process ? view.pids[i] : 0;
+                DownsampleGroup& group = groups[std::make_tuple(bucket, view.devices[i], pid)];
+                if (group.sum.empty()) {
+                    group.sum.assign(columns, 0.0);
+                    group.min.assign(columns, INFINITY);
+                    group.max.assign(columns, -INFINITY);
+                }
+                for (size_t c = 0; c < columns; c++) {
+                    size_t cell = c * view.rows + i;
+                    double value = view.values[cell];
+                    group.sum[c] += view.counts ? view.sums[cell] : value;
+                    group.min[c] = std::min(group.min[c], view.counts ? view.mins[cell] : value);
+                    group.max[c] = std::max(group.max[c], view.counts ? view.maxs[cell] : value);
+                }
+                group.count += view.counts ? view.counts[i] : 1;
+                if (table == HistoryTable::Process && ts >= group.nameTimestamp) {
+                    group.nameTimestamp = ts;
+                    group.name = nameMap[view.names[i]];
+                }
+            }
+        }
+    }
+
+    if (resolutionMs > 0) {
+        // 맵 순서가 (버킷 시각, 디바이스, PID)이므로 블록 안 시각이 오름차순이다
+        std::shared_ptr<HistoryBlock> block;
+        for (const auto& item : groups) {
+            if (!block) {
+                block = std::make_shared<HistoryBlock>(table);
+                block->sums.resize(columns);
+                block->mins.resize(columns);
+                block->maxs.resize(columns);
+            }
+            const DownsampleGroup& group = item.second;
+            appendRow(*block, std::get<0>(item.first), std::get<1>(item.first));
+            if (table == HistoryTable::Process) {
+                block->pids.push_back(std::get<2>(item.first));
+                block->names.push_back(group.name);
+            }
+            block->counts.push_back(static_cast<uint32_t>(std::min<uint64_t>(group.count, UINT32_MAX)));
+            for (size_t c = 0; c < columns; c++) {
+                block->values[c].push_back(group.sum[c] / group.count);
+                block->sums[c].push_back(group.sum[c]);
+                block->mins[c].push_back(group.min[c]);
+                block->maxs[c].push_back(group.max[c]);
+            }
+            if (block->rows() >= kOutputBlockRows) {
+                output.push_back(block);
+                block.reset();
+            }
+        }
+        if (block) output.push_back(block);
+    }
+
+    std::vector<std::string> removed;
+    for (const auto& input : inputs) {
+        removed.push_back(input.file);
+    }
+
+    std::vector<SegmentEntry> added;
+    uint64_t rowsOut = 0;
+    uint64_t bytesWritten = 0;
+    if (!output.empty()) {
+        std::string file = store.reserveFile("compact-", table, output.front()->minTimestamp);
+        std::string error;
+        SegmentEntry entry;
+        if (!writeHistorySegment(store.path(file), table, output, uuids, names.names, error, &limiter) ||
+            !describeSegment(store.directory(), file, tier, entry, error)) {
+            ::unlink(store.path(file).c_str());
+            return fail(error);
+        }
+        added.push_back(entry);
+        rowsOut = entry.rows;
+        bytesWritten = entry.bytes;
+    }
+
+    if (!store.replace(removed, added)) {
+        for (const auto& entry : added) {
+            ::unlink(store.path(entry.file).c_str());
+        }
+        return fail("manifest swap failed");
+    }
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    if (resolutionMs > 0) {
+        stats.downsamples++;
+    } else {
+        stats.merges++;
+    }
+    stats.segmentsIn += inputs.size();
+    stats.segmentsOut += added.size();
+    stats.rowsIn += rowsIn;
+    stats.rowsOut += rowsOut;
+    stats.bytesRead += bytesRead;
+    stats.bytesWritten += bytesWritten;
+    return true;
+}
+
+CompactionStats SegmentCompactor::getStats() {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return stats;
+}
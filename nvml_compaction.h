@@ -0,0 +1,83 @@
+#ifndef NVML_COMPACTION_H
+#define NVML_COMPACTION_H
+
+#include "nvml_segment.h"
+#include <condition_variable>
+
+// 보관 단계. 0단계는 원본, 다음 단계들은 점점 거친 해상도로 다운샘플한 세그먼트
+struct CompactionTier {
+    int64_t resolutionMs;  // 0이면 원본
+    int64_t retentionMs;   // 이보다 오래된 세그먼트는 다음 단계로 다운샘플 (마지막 단계면 삭제). 0이면 무기한
+    uint64_t maxBytes;     // 단계 전체 크기 상한 (넘으면 오래된 세그먼트부터 삭제). 0이면 무제한
+};
+
+struct CompactionConfig {
+    std::vector<CompactionTier> tiers = {
+        {0, 7LL * 86400 * 1000, 0},         // 원본 7일
+        {60 * 1000, 90LL * 86400 * 1000, 0}, // 1분 평균 90일
+        {3600 * 1000, 0, 0},                 // 1시간 평균
+    };
+    uint64_t targetSegmentBytes = 64ULL * 1024 * 1024; // 병합/다운샘플 결과 세그먼트 크기
+    size_t minMergeSegments = 4;                        // 작은 세그먼트가 이만큼 모이면 병합
+    uint64_t ioBytesPerSecond = 16ULL * 1024 * 1024;    // 압축 읽기+쓰기 속도 상한 (0이면 무제한)
+    int64_t intervalMs = 60 * 1000;
+    int64_t deleteDelayMs = 60 * 1000;                  // 목록에서 뺀 파일을 지우기까지 (진행 중인 스캔 보호)
+};
+
+struct CompactionStats {
+    uint64_t runs;
+    uint64_t merges;
+    uint64_t downsamples;
+    uint64_t segmentsExpired;  // 보관 기간/크기 초과로 지운 세그먼트
+    uint64_t segmentsIn;
+    uint64_t segmentsOut;
+    uint64_t rowsIn;
+    uint64_t rowsOut;
+    uint64_t bytesRead;
+    uint64_t bytesWritten;
+    uint64_t failures;
+};
+
+// 세그먼트 보관/압축 관리자
+// 닫힌(불변) 세그먼트만 읽어 새 세그먼트를 쓰고 매니페스트 교체로 바꿔 끼우므로 쓰기와 스캔을 막지 않는다.
+// 주기마다 단계별로
+//   1) 보관 기간이 지난 세그먼트를 다음 단계 해상도로 다운샘플 (그룹별 평균, 마지막 단계는 삭제)
+//   2) 단계 크기 상한을 넘으면 오래된 세그먼트 삭제
+//   3) 작은 세그먼트들을 targetSegmentBytes 크기로 병합
+// 읽기/쓰기는 토큰 버킷으로 속도를 제한해 학습 작업의 I/O를 방해하지 않는다
+class SegmentCompactor {
+private:
+    SegmentStore& store;
+    CompactionConfig config;
+    RateLimiter limiter;
+
+    std::atomic<bool> running;
+    std::atomic<bool> stopping;
+    std::thread compactThread;
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+
+    std::mutex statsMutex;
+    CompactionStats stats;
+
+public:
+    SegmentCompactor(SegmentStore& store, const CompactionConfig& config = CompactionConfig());
+    ~SegmentCompactor();
+
+    void start();
+    void stop();
+
+    // 한 주기 실행 (now: 벽시계 ms)
+    void runOnce(int64_t now);
+
+    CompactionStats getStats();
+
+private:
+    void compactLoop();
+    // inputs를 읽어 tier 단계 세그먼트 하나로 다시 쓴다 (resolutionMs > 0이면 다운샘플)
+    bool rewrite(const std::vector<SegmentEntry>& inputs, uint32_t tier, int64_t resolutionMs);
+    bool remove(const std::vector<SegmentEntry>& inputs);
+    std::vector<SegmentEntry> tierEntries(uint32_t tier, HistoryTable table);
+};
+
+#endif // NVML_COMPACTION_H
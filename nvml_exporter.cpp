@@ -0,0 +1,233 @@
+#include "nvml_exporter.h"
+#include "nvml_cardinality.h"
+#include <algorithm>
+#include <iostream>
+
+ExporterPipeline::ExporterPipeline() : running(false) {
+}
+
+ExporterPipeline::~ExporterPipeline() {
+    stop();
+}
+
+void ExporterPipeline::addSink(std::unique_ptr<MetricsSink> sink, const SinkConfig& config) {
+    if (running) return;
+
+    auto state = std::make_unique<SinkState>();
+    state->sink = std::move(sink);
+    state->config = config;
+    state->config.queueCapacity = std::max<size_t>(state->config.queueCapacity, 1);
+    state->config.maxBatch = std::max<size_t>(state->config.maxBatch, 1);
+    sinks.push_back(std::move(state));
+}
+
+void ExporterPipeline::setCardinalityLimiter(CardinalityLimiter* limiter) {
+    if (running) return;
+    this->limiter = limiter;
+}
+
+bool ExporterPipeline::start() {
+    if (running) return false;
+
+    for (auto& state : sinks) {
+        if (!state->sink->open()) {
+            std::cerr << "Failed to open sink " << state->sink->name() << std::endl;
+        }
+    }
+
+    running = true;
+    for (auto& state : sinks) {
+        state->worker = std::thread(&ExporterPipeline::workerLoop, this, std::ref(*state));
+    }
+    return true;
+}
+
+void ExporterPipeline::stop() {
+    if (!running) return;
+
+    running = false;
+    for (auto& state : sinks) {
+        {
+            // 대기 조건 확인과 알림 사이에 끼어들지 않도록 락을 한 번 잡는다
+            std::lock_guard<std::mutex> lock(state->mutex);
+        }
+        state->cv.notify_all();
+    }
+    for (auto& state : sinks) {
+        if (state->worker.joinable()) {
+            state->worker.join();
+        }
+        state->sink->close();
+    }
+}
+
+void ExporterPipeline::publish(const MetricsSnapshot& snapshot) {
+    if (sinks.empty()) return;
+    publish(std::make_shared<const MetricsSnapshot>(snapshot));
+}
+
+void ExporterPipeline::publish(SnapshotPtr snapshot) {
+    SnapshotPtr limited;
+    if (limiter) {
+        for (auto& state : sinks) {
+            if (state->config.limitCardinality) {
+                limited = limiter->apply(snapshot);
+                break;
+            }
+        }
+    }
+
+    for (auto& state : sinks) {
+        const SnapshotPtr& queued = state->config.limitCardinality && limited ? limited : snapshot;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->enqueued++;
+            if (state->queue.size() >= state->config.queueCapacity) {
+                state->dropped++;
+                if (state->config.overflow == OverflowPolicy::DropNewest) {
+                    continue;
+                }
+                state->queue.pop_front();
+            }
+            state->queue.push_back(queued);
+        }
+        state->cv.notify_one();
+    }
+}
+
+void ExporterPipeline::workerLoop(SinkState& state) {
+    std::vector<SnapshotPtr> batch;
+    batch.reserve(state.config.maxBatch);
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.cv.wait(lock, [&] { return !state.queue.empty() || !running; });
+            if (state.queue.empty()) {
+                break; // 종료 요청이고 남은 스냅샷 없음
+            }
+
+            // 배치가 찰 때까지 잠깐 기다린다
+            if (running && state.config.maxBatchDelayMs > 0 && state.queue.size() < state.config.maxBatch) {
+                state.cv.wait_for(lock, std::chrono::milliseconds(state.config.maxBatchDelayMs), [&] {
+                    return state.queue.size() >= state.config.maxBatch || !running;
+                });
+            }
+
+            size_t count = std::min(state.queue.size(), state.config.maxBatch);
+            batch.assign(state.queue.begin(), state.queue.begin() + count);
+            state.queue.erase(state.queue.begin(), state.queue.begin() + count);
+        }
+
+        exportWithRetry(state, batch);
+        batch.clear();
+    }
+}
+
+bool ExporterPipeline::exportWithRetry(SinkState& state, const std::vector<SnapshotPtr>& batch) {
+    int backoffMs = state.config.initialBackoffMs;
+
+    for (int attempt = 0;; attempt++) {
+        auto start = std::chrono::steady_clock::now();
+        bool ok = state.sink->exportBatch(batch);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.lastExportSeconds = elapsed;
+        if (ok) {
+            state.exported += batch.size();
+            state.batches++;
+            state.retrying = false;
+            return true;
+        }
+
+        // 종료 중에는 재시도하지 않는다
+        if (attempt >= state.config.maxRetries || !running) {
+            state.failed += batch.size();
+            state.retrying = false;
+            std::cerr << "Sink " << state.sink->name() << ": dropping batch of " << batch.size()
+                      << " snapshots after " << (attempt + 1) << " attempts" << std::endl;
+            return false;
+        }
+
+        state.retries++;
+        state.retrying = true;
+        state.cv.wait_for(lock, std::chrono::milliseconds(backoffMs), [this] { return !running; });
+        backoffMs = std::min(backoffMs * 2, state.config.maxBackoffMs);
+    }
+}
+
+std::vector<SinkMetrics> ExporterPipeline::getMetrics() {
+    std::vector<SinkMetrics> result;
+    auto now = std::chrono::system_clock::now();
+
+    for (auto& state : sinks) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        SinkMetrics metrics;
+        metrics.name = state->sink->name();
+        metrics.enqueued = state->enqueued;
+        metrics.exported = state->exported;
+        metrics.dropped = state->dropped;
+        metrics.failed = state->failed;
+        metrics.retries = state->retries;
+        metrics.batches = state->batches;
+        metrics.queueDepth = state->queue.size();
+        metrics.lagSeconds = state->queue.empty() ? 0.0 :
+            std::max(0.0, std::chrono::duration<double>(now - state->queue.front()->timestamp).count());
+        metrics.lastExportSeconds = state->lastExportSeconds;
+        metrics.backpressure = state->retrying ||
+            metrics.queueDepth >= state->config.queueCapacity * state->config.backpressureRatio;
+        result.push_back(metrics);
+    }
+    return result;
+}
+
+bool ExporterPipeline::isBackpressured() {
+    for (const auto& metrics : getMetrics()) {
+        if (metrics.backpressure) return true;
+    }
+    return false;
+}
+
+void ExporterPipeline::renderMetrics(std::string& out) {
+    auto metrics = getMetrics();
+
+    auto family = [&](const char* name, const char* type, const char* help, auto value) {
+        out += "# HELP ";
+        out += name;
+        out += " ";
+        out += help;
+        out += "\n# TYPE ";
+        out += name;
+        out += " ";
+        out += type;
+        out += "\n";
+        for (const auto& sink : metrics) {
+            out += name;
+            out += "{sink=\"" + sink.name + "\"} ";
+            out += std::to_string(value(sink));
+            out += "\n";
+        }
+    };
+
+    family("nvml_exporter_enqueued_total", "counter", "Snapshots queued for the sink.",
+           [](const SinkMetrics& m) { return m.enqueued; });
+    family("nvml_exporter_exported_total", "counter", "Snapshots exported by the sink.",
+           [](const SinkMetrics& m) { return m.exported; });
+    family("nvml_exporter_dropped_total", "counter", "Snapshots dropped because the sink queue was full.",
+           [](const SinkMetrics& m) { return m.dropped; });
+    family("nvml_exporter_failed_total", "counter", "Snapshots dropped after exhausting retries.",
+           [](const SinkMetrics& m) { return m.failed; });
+    family("nvml_exporter_retries_total", "counter", "Export retries.",
+           [](const SinkMetrics& m) { return m.retries; });
+    family("nvml_exporter_queue_depth", "gauge", "Snapshots waiting in the sink queue.",
+           [](const SinkMetrics& m) { return static_cast<uint64_t>(m.queueDepth); });
+    family("nvml_exporter_lag_seconds", "gauge", "Age of the oldest queued snapshot.",
+           [](const SinkMetrics& m) { return m.lagSeconds; });
+    family("nvml_exporter_backpressure", "gauge", "1 if the sink is retrying or its queue is nearly full.",
+           [](const SinkMetrics& m) { return m.backpressure ? 1 : 0; });
+
+    if (limiter) {
+        limiter->renderMetrics(out);
+    }
+}
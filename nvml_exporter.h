@@ -0,0 +1,119 @@
+#ifndef NVML_EXPORTER_H
+#define NVML_EXPORTER_H
+
+#include "nvml_types.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// 모든 싱크가 공유하는 스냅샷 (틱마다 한 번만 복사)
+using SnapshotPtr = std::shared_ptr<const MetricsSnapshot>;
+
+class CardinalityLimiter;
+
+// 내보내기 싱크. exportBatch는 싱크 전용 스레드에서만 호출된다
+class MetricsSink {
+public:
+    virtual ~MetricsSink() = default;
+
+    virtual std::string name() const = 0;
+    virtual bool open() { return true; }
+    virtual void close() {}
+
+    // false를 반환하면 파이프라인이 백오프 후 같은 배치를 다시 넘긴다
+    virtual bool exportBatch(const std::vector<SnapshotPtr>& batch) = 0;
+};
+
+// 큐가 가득 찼을 때 버릴 스냅샷
+enum class OverflowPolicy {
+    DropOldest,
+    DropNewest
+};
+
+// 싱크별 큐/배치/재시도 설정
+struct SinkConfig {
+    size_t queueCapacity = 300;
+    size_t maxBatch = 10;
+    int maxBatchDelayMs = 0;        // 배치가 찰 때까지 기다리는 최대 시간 (0이면 바로 보냄)
+    int maxRetries = 5;             // 초과하면 배치를 버린다
+    int initialBackoffMs = 200;
+    int maxBackoffMs = 30000;
+    double backpressureRatio = 0.8; // 큐가 이 비율을 넘으면 backpressure
+    OverflowPolicy overflow = OverflowPolicy::DropOldest;
+    bool limitCardinality = false;  // 카디널리티 제한을 거친 스냅샷을 받는다 (TSDB로 가는 싱크)
+};
+
+// 싱크별 지표
+struct SinkMetrics {
+    std::string name;
+    uint64_t enqueued;
+    uint64_t exported;
+    uint64_t dropped;       // 큐 초과로 버림
+    uint64_t failed;        // 재시도 초과로 버림
+    uint64_t retries;
+    uint64_t batches;
+    size_t queueDepth;
+    double lagSeconds;      // 가장 오래된 대기 스냅샷의 나이
+    double lastExportSeconds;
+    bool backpressure;
+};
+
+// 스냅샷 스트림을 여러 싱크로 나눠 보내는 파이프라인
+// 싱크마다 큐와 스레드가 따로 있어 멈춘 싱크가 수집이나 다른 싱크를 막지 않는다
+class ExporterPipeline {
+private:
+    struct SinkState {
+        std::unique_ptr<MetricsSink> sink;
+        SinkConfig config;
+        std::thread worker;
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<SnapshotPtr> queue;
+        bool retrying = false;
+
+        uint64_t enqueued = 0;
+        uint64_t exported = 0;
+        uint64_t dropped = 0;
+        uint64_t failed = 0;
+        uint64_t retries = 0;
+        uint64_t batches = 0;
+        double lastExportSeconds = 0;
+    };
+
+    std::vector<std::unique_ptr<SinkState>> sinks;
+    std::atomic<bool> running;
+    CardinalityLimiter* limiter = nullptr;
+
+public:
+    ExporterPipeline();
+    ~ExporterPipeline();
+
+    // start 전에 등록
+    void addSink(std::unique_ptr<MetricsSink> sink, const SinkConfig& config = SinkConfig());
+    // start 전에 설정. limitCardinality 싱크는 publish마다 한 번 제한한 스냅샷을 함께 받는다
+    void setCardinalityLimiter(CardinalityLimiter* limiter);
+
+    bool start();
+    // 큐에 남은 스냅샷을 한 번씩 시도한 뒤 종료
+    void stop();
+
+    // 수집 스레드에서 호출 (대기하지 않음)
+    void publish(const MetricsSnapshot& snapshot);
+    void publish(SnapshotPtr snapshot);
+
+    std::vector<SinkMetrics> getMetrics();
+    bool isBackpressured();
+
+    // 파이프라인 자체 지표 (Prometheus 텍스트 형식)
+    void renderMetrics(std::string& out);
+
+private:
+    void workerLoop(SinkState& state);
+    bool exportWithRetry(SinkState& state, const std::vector<SnapshotPtr>& batch);
+};
+
+#endif // NVML_EXPORTER_H
@@ -0,0 +1,1050 @@
+#include "nvml_history.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+
+namespace {
+
+const char* const kMetricNames[HM_METRIC_COUNT] = {
+    "gpu_utilization",
+    "memory_utilization",
+    "encoder_utilization",
+    "decoder_utilization",
+    "memory_used",
+    "memory_total",
+    "temperature",
+    "fan_speed",
+    "power_usage",
+    "power_limit",
+    "sm_clock",
+    "memory_clock",
+    "graphics_clock",
+    "ecc_single_bit",
+    "ecc_double_bit",
+    "process_memory",
+};
+
+// 한 질의가 만들 수 있는 최대 (그룹 x 버킷) 수
+const size_t kMaxQueryCells = 4 * 1024 * 1024;
+
+int64_t toMillis(std::chrono::system_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+}
+
+double metricValue(const GPUMetrics& m, int metric) {
+    switch (metric) {
+        case HM_GPU_UTILIZATION: return m.gpuUtilization;
+        case HM_MEMORY_UTILIZATION: return m.memoryUtilization;
+        case HM_ENCODER_UTILIZATION: return m.encoderUtilization;
+        case HM_DECODER_UTILIZATION: return m.decoderUtilization;
+        case HM_MEMORY_USED: return static_cast<double>(m.memoryUsed);
+        case HM_MEMORY_TOTAL: return static_cast<double>(m.memoryTotal);
+        case HM_TEMPERATURE: return m.temperature;
+        case HM_FAN_SPEED: return m.fanSpeed;
+        case HM_POWER_USAGE: return m.powerUsage;
+        case HM_POWER_LIMIT: return m.powerLimit;
+        case HM_SM_CLOCK: return m.smClock;
+        case HM_MEMORY_CLOCK: return m.memoryClock;
+        case HM_GRAPHICS_CLOCK: return m.graphicsClock;
+        case HM_ECC_SINGLE_BIT: return static_cast<double>(m.eccSingleBit);
+        case HM_ECC_DOUBLE_BIT: return static_cast<double>(m.eccDoubleBit);
+        default: return 0;
+    }
+}
+
+// "10s", "5m", "250ms", "2h", "1d" (단위 없으면 ms)
+bool parseDurationMs(const std::string& text, int64_t& result) {
+    char* end = nullptr;
+    double value = std::strtod(text.c_str(), &end);
+    if (end == text.c_str() || value < 0) return false;
+
+    std::string unit(end);
+    double scale;
+    if (unit.empty() || unit == "ms") scale = 1;
+    else if (unit == "s") scale = 1000;
+    else if (unit == "m") scale = 60 * 1000;
+    else if (unit == "h") scale = 3600 * 1000;
+    else if (unit == "d") scale = 86400 * 1000;
+    else return false;
+
+    result = static_cast<int64_t>(value * scale);
+    return true;
+}
+
+// 절대 ms, "now", "-<기간>"
+bool parseTimeMs(const std::string& text, int64_t now, int64_t& result) {
+    if (text == "now") {
+        result = now;
+        return true;
+    }
+    if (!text.empty() && text[0] == '-') {
+        int64_t offset;
+        if (!parseDurationMs(text.substr(1), offset)) return false;
+        result = now - offset;
+        return true;
+    }
+    char* end = nullptr;
+    long long value = std::strtoll(text.c_str(), &end, 10);
+    if (end == text.c_str() || *end != '\0') return false;
+    result = value;
+    return true;
+}
+
+const char* aggregateName(const HistoryQuery& query, char* buffer, size_t size) {
+    switch (query.aggregate) {
+        case HistoryAggregate::Avg: return "avg";
+        case HistoryAggregate::Min: return "min";
+        case HistoryAggregate::Max: return "max";
+        case HistoryAggregate::Sum: return "sum";
+        case HistoryAggregate::Count: return "count";
+        case HistoryAggregate::Last: return "last";
+        case HistoryAggregate::Quantile:
+            std::snprintf(buffer, size, "p%g", query.quantile * 100);
+            return buffer;
+    }
+    return "";
+}
+
+} // namespace
+
+const char* historyMetricName(int metric) {
+    return metric >= 0 && metric < HM_METRIC_COUNT ? kMetricNames[metric] : "";
+}
+
+int historyMetricFromName(const std::string& name) {
+    for (int i = 0; i < HM_METRIC_COUNT; i++) {
+        if (name == kMetricNames[i]) return i;
+    }
+    return -1;
+}
+
+HistoryTable historyMetricTable(int metric) {
+    return metric >= HM_DEVICE_METRIC_COUNT ? HistoryTable::Process : HistoryTable::Device;
+}
+
+double historyMetricValue(const GPUMetrics& metrics, int metric) {
+    return metricValue(metrics, metric);
+}
+
+bool parseHistoryDuration(const std::string& text, int64_t& ms) {
+    return parseDurationMs(text, ms);
+}
+
+HistoryBlock::HistoryBlock(HistoryTable table) : table(table) {
+    values.resize(table == HistoryTable::Device ? HM_DEVICE_METRIC_COUNT : HM_METRIC_COUNT - HM_DEVICE_METRIC_COUNT);
+}
+
+size_t HistoryBlock::bytes() const {
+    size_t total = timestamps.capacity() * sizeof(int64_t) + devices.capacity() * sizeof(uint32_t) +
+                   pids.capacity() * sizeof(uint32_t) + names.capacity() * sizeof(uint32_t);
+    for (const auto& column : values) {
+        total += column.capacity() * sizeof(double);
+    }
+    total += counts.capacity() * sizeof(uint32_t);
+    for (const auto* rollupColumns : {&sums, &mins, &maxs}) {
+        for (const auto& column : *rollupColumns) {
+            total += column.capacity() * sizeof(double);
+        }
+    }
+    return total;
+}
+
+MetricHistory::MetricHistory(const HistoryConfig& config) : config(config), sealedBytes(0), blocksExpired(0) {
+    this->config.blockRows = std::max<size_t>(this->config.blockRows, 16);
+}
+
+void MetricHistory::setDevices(const std::vector<GPUInfo>& gpus) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    for (const auto& gpu : gpus) {
+        if (gpu.index >= uuids.size()) uuids.resize(gpu.index + 1);
+        uuids[gpu.index] = gpu.uuid;
+    }
+}
+
+HistoryBlock& MetricHistory::activeBlock(HistoryTable table) {
+    auto& block = active[static_cast<int>(table)];
+    if (!block) {
+        block = std::make_shared<HistoryBlock>(table);
+        block->timestamps.reserve(config.blockRows);
+        block->devices.reserve(config.blockRows);
+        if (table == HistoryTable::Process) {
+            block->pids.reserve(config.blockRows);
+            block->names.reserve(config.blockRows);
+        }
+        for (auto& column : block->values) {
+            column.reserve(config.blockRows);
+        }
+    }
+    return *block;
+}
+
+void MetricHistory::seal(HistoryTable table) {
+    auto& block = active[static_cast<int>(table)];
+    if (!block || block->rows() == 0) return;
+
+    sealedBytes += block->bytes();
+    if (sealCallback) newlySealed.push_back(block);
+    sealed[static_cast<int>(table)].push_back(std::move(block));
+    block.reset();
+}
+
+void MetricHistory::notifySealed(std::unique_lock<std::shared_mutex>& lock) {
+    if (newlySealed.empty()) return;
+    std::vector<HistoryBlockPtr> ready;
+    ready.swap(newlySealed);
+    auto callback = sealCallback;
+    lock.unlock();
+    for (const auto& block : ready) {
+        callback(block);
+    }
+}
+
+void MetricHistory::setSealCallback(std::function<void(const HistoryBlockPtr&)> callback) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    sealCallback = std::move(callback);
+}
+
+void MetricHistory::flush() {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    seal(HistoryTable::Device);
+    seal(HistoryTable::Process);
+    notifySealed(lock);
+}
+
+void MetricHistory::append(const MetricsSnapshot& snapshot) {
+    int64_t ts = toMillis(snapshot.timestamp);
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+
+    // 블록 안의 시각은 오름차순이어야 이진 탐색할 수 있다 (시계가 되돌아가면 새 블록)
+    for (HistoryTable table : {HistoryTable::Device, HistoryTable::Process}) {
+        auto& block = active[static_cast<int>(table)];
+        if (block && block->rows() > 0 && ts < block->maxTimestamp) {
+            seal(table);
+        }
+    }
+
+    for (const auto& m : snapshot.devices) {
+        HistoryBlock& block = activeBlock(HistoryTable::Device);
+        block.timestamps.push_back(ts);
+        block.devices.push_back(m.deviceIndex);
+        for (int metric = 0; metric < HM_DEVICE_METRIC_COUNT; metric++) {
+            block.values[metric].push_back(metricValue(m, metric));
+        }
+        block.minTimestamp = std::min(block.minTimestamp, ts);
+        block.maxTimestamp = std::max(block.maxTimestamp, ts);
+        block.deviceMask |= historyDeviceBit(m.deviceIndex);
+    }
+
+    for (const auto& p : snapshot.processes) {
+        // 사전 id는 체크포인트/세그먼트에 남으므로 실행마다 바뀌는 인터닝 id를 그대로 쓰지 않는다
+        uint32_t nameId;
+        auto interned = internedNameIds.find(p.nameId);
+        if (interned != internedNameIds.end()) {
+            nameId = interned->second;
+        } else {
+            const std::string& name = internedString(p.nameId);
+            auto it = nameIds.find(name);
+            if (it != nameIds.end()) {
+                nameId = it->second;
+            } else {
+                nameId = static_cast<uint32_t>(names.size());
+                names.push_back(name);
+                nameIds.emplace(name, nameId);
+            }
+            internedNameIds.emplace(p.nameId, nameId);
+        }
+
+        HistoryBlock& block = activeBlock(HistoryTable::Process);
+        block.timestamps.push_back(ts);
+        block.devices.push_back(p.deviceIndex);
+        block.pids.push_back(p.pid);
+        block.names.push_back(nameId);
+        block.values[0].push_back(static_cast<double>(p.usedGpuMemory));
+        block.minTimestamp = std::min(block.minTimestamp, ts);
+        block.maxTimestamp = std::max(block.maxTimestamp, ts);
+        block.deviceMask |= historyDeviceBit(p.deviceIndex);
+    }
+
+    // 한 틱은 한 블록에 담는다. 블록(과 세그먼트) 경계가 시각 경계가 되어
+    // "이 시각까지는 세그먼트에 있다"는 체크포인트 기준이 행 단위로 정확하다
+    for (HistoryTable table : {HistoryTable::Device, HistoryTable::Process}) {
+        auto& block = active[static_cast<int>(table)];
+        if (block && block->rows() >= config.blockRows) seal(table);
+    }
+
+    expire(ts);
+    notifySealed(lock);
+}
+
+void MetricHistory::expire(int64_t now) {
+    int64_t cutoff = now - config.retentionMs;
+    while (true) {
+        // 두 테이블 중 더 오래된 블록부터
+        auto& devices = sealed[0];
+        auto& processes = sealed[1];
+        std::vector<HistoryBlockPtr>* oldest = nullptr;
+        if (!devices.empty()) oldest = &devices;
+        if (!processes.empty() && (!oldest || processes.front()->maxTimestamp < devices.front()->maxTimestamp)) {
+            oldest = &processes;
+        }
+        if (!oldest) break;
+
+        const HistoryBlockPtr& block = oldest->front();
+        if (block->maxTimestamp >= cutoff && sealedBytes <= config.maxBytes) break;
+
+        sealedBytes -= block->bytes();
+        oldest->erase(oldest->begin());
+        blocksExpired++;
+    }
+}
+
+std::vector<HistoryBlockPtr> MetricHistory::blocks(HistoryTable table, int64_t start, int64_t end) const {
+    std::vector<HistoryBlockPtr> result;
+    std::shared_lock<std::shared_mutex> lock(mutex);
+
+    for (const auto& block : sealed[static_cast<int>(table)]) {
+        if (block->maxTimestamp >= start && block->minTimestamp < end) {
+            result.push_back(block);
+        }
+    }
+
+    // 활성 블록은 계속 바뀌므로 복사본을 넘긴다 (최대 blockRows 행)
+    const auto& current = active[static_cast<int>(table)];
+    if (current && current->rows() > 0 && current->maxTimestamp >= start && current->minTimestamp < end) {
+        result.push_back(std::make_shared<const HistoryBlock>(*current));
+    }
+    return result;
+}
+
+std::string MetricHistory::processName(uint32_t id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return id < names.size() ? names[id] : "";
+}
+
+std::vector<std::string> MetricHistory::processNames() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return names;
+}
+
+std::vector<std::string> MetricHistory::deviceUuids() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return uuids;
+}
+
+std::string MetricHistory::deviceUuid(unsigned int index) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return index < uuids.size() ? uuids[index] : "";
+}
+
+int MetricHistory::deviceIndex(const std::string& uuid) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    for (size_t i = 0; i < uuids.size(); i++) {
+        if (uuids[i] == uuid) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+namespace {
+
+void saveBlock(const HistoryBlock& block, CheckpointWriter& writer) {
+    writer.putVector(block.timestamps);
+    writer.putVector(block.devices);
+    if (block.table == HistoryTable::Process) {
+        writer.putVector(block.pids);
+        writer.putVector(block.names);
+    }
+    for (const auto& column : block.values) {
+        writer.putVector(column);
+    }
+    writer.put<int64_t>(block.minTimestamp);
+    writer.put<int64_t>(block.maxTimestamp);
+    writer.put<uint64_t>(block.deviceMask);
+}
+
+std::shared_ptr<HistoryBlock> restoreBlock(HistoryTable table, size_t nameCount, CheckpointReader& reader) {
+    auto block = std::make_shared<HistoryBlock>(table);
+    reader.getVector(block->timestamps);
+    reader.getVector(block->devices);
+    size_t rows = block->timestamps.size();
+    bool ok = block->devices.size() == rows;
+    if (table == HistoryTable::Process) {
+        reader.getVector(block->pids);
+        reader.getVector(block->names);
+        ok = ok && block->pids.size() == rows && block->names.size() == rows;
+        for (size_t i = 0; ok && i < rows; i++) {
+            ok = block->names[i] < nameCount;
+        }
+    }
+    for (auto& column : block->values) {
+        reader.getVector(column);
+        ok = ok && column.size() == rows;
+    }
+    block->minTimestamp = reader.get<int64_t>();
+    block->maxTimestamp = reader.get<int64_t>();
+    block->deviceMask = reader.get<uint64_t>();
+    if (!ok || !reader.good() || rows == 0) return nullptr;
+    return block;
+}
+
+// after 이하 시각의 행을 앞에서 잘라낸다 (블록 안 시각은 오름차순). 남은 행이 없으면 false
+bool trimBlock(HistoryBlock& block, int64_t after) {
+    if (block.minTimestamp > after) return true;
+    if (block.maxTimestamp <= after) return false;
+    size_t keep = std::upper_bound(block.timestamps.begin(), block.timestamps.end(), after) -
+                  block.timestamps.begin();
+    auto cut = [keep](auto& column) { column.erase(column.begin(), column.begin() + keep); };
+    cut(block.timestamps);
+    cut(block.devices);
+    if (block.table == HistoryTable::Process) {
+        cut(block.pids);
+        cut(block.names);
+    }
+    for (auto& column : block.values) {
+        cut(column);
+    }
+    block.minTimestamp = block.timestamps.front();
+    return true;
+}
+
+} // namespace
+
+void MetricHistory::saveCheckpoint(CheckpointWriter& writer, const int64_t* persistedUntil) const {
+    std::vector<HistoryBlockPtr> blocks[2];
+    std::shared_ptr<const HistoryBlock> current[2];
+    std::vector<std::string> nameList;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        for (int t = 0; t < 2; t++) {
+            // 세그먼트에 이미 있는 봉인 블록은 다시 쓰지 않는다 (아직 세그먼트로 가지 않은 블록만)
+            for (const auto& block : sealed[t]) {
+                if (!persistedUntil || block->maxTimestamp > persistedUntil[t]) blocks[t].push_back(block);
+            }
+            if (active[t] && active[t]->rows() > 0) {
+                current[t] = std::make_shared<const HistoryBlock>(*active[t]);
+            }
+        }
+        nameList = names;
+    }
+
+    writer.put<uint32_t>(static_cast<uint32_t>(nameList.size()));
+    for (const auto& name : nameList) {
+        writer.putString(name);
+    }
+    for (int t = 0; t < 2; t++) {
+        writer.put<int64_t>(persistedUntil ? persistedUntil[t] : INT64_MIN);
+        writer.put<uint32_t>(static_cast<uint32_t>(blocks[t].size()));
+        for (const auto& block : blocks[t]) {
+            saveBlock(*block, writer);
+        }
+        writer.put<uint8_t>(current[t] ? 1 : 0);
+        if (current[t]) saveBlock(*current[t], writer);
+    }
+}
+
+bool MetricHistory::restoreCheckpoint(CheckpointReader& reader, const int64_t* persistedUntil) {
+    uint32_t nameCount = reader.get<uint32_t>();
+    std::vector<std::string> nameList;
+    for (uint32_t i = 0; i < nameCount && reader.good(); i++) {
+        nameList.push_back(reader.getString());
+    }
+
+    // 저장 당시의 활성 블록은 활성 블록으로 되살려, 봉인될 때 세그먼트 저장소로 넘어가게 한다.
+    // 저장 뒤 죽기 전에 세그먼트로 간 행은 지금 저장소의 기준 시각으로 걸러 중복 저장을 막는다
+    std::vector<std::shared_ptr<HistoryBlock>> blocks[2];
+    std::shared_ptr<HistoryBlock> current[2];
+    for (int t = 0; t < 2 && reader.good(); t++) {
+        HistoryTable table = static_cast<HistoryTable>(t);
+        int64_t persisted = reader.get<int64_t>();
+        if (persistedUntil) persisted = std::max(persisted, persistedUntil[t]);
+        uint32_t count = reader.get<uint32_t>();
+        for (uint32_t i = 0; i < count && reader.good(); i++) {
+            auto block = restoreBlock(table, nameList.size(), reader);
+            if (!block) return false;
+            if (trimBlock(*block, persisted)) blocks[t].push_back(std::move(block));
+        }
+        if (reader.get<uint8_t>() != 0) {
+            current[t] = restoreBlock(table, nameList.size(), reader);
+            if (!current[t]) return false;
+            if (!trimBlock(*current[t], persisted)) current[t].reset();
+        }
+    }
+    if (!reader.good()) return false;
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    for (int t = 0; t < 2; t++) {
+        if (!sealed[t].empty() || (active[t] && active[t]->rows() > 0)) return false;
+    }
+    names = std::move(nameList);
+    nameIds.clear();
+    internedNameIds.clear();
+    for (uint32_t i = 0; i < names.size(); i++) {
+        nameIds.emplace(names[i], i);
+    }
+    int64_t newest = INT64_MIN;
+    for (int t = 0; t < 2; t++) {
+        for (auto& block : blocks[t]) {
+            sealedBytes += block->bytes();
+            newest = std::max(newest, block->maxTimestamp);
+            // 세그먼트로 가기 전에 죽은 블록이므로 다시 넘긴다
+            if (sealCallback) newlySealed.push_back(block);
+            sealed[t].push_back(std::move(block));
+        }
+        if (current[t]) {
+            newest = std::max(newest, current[t]->maxTimestamp);
+            HistoryBlock& block = *current[t];
+            block.timestamps.reserve(config.blockRows);
+            block.devices.reserve(config.blockRows);
+            block.pids.reserve(block.table == HistoryTable::Process ? config.blockRows : 0);
+            block.names.reserve(block.table == HistoryTable::Process ? config.blockRows : 0);
+            for (auto& column : block.values) {
+                column.reserve(config.blockRows);
+            }
+            active[t] = std::move(current[t]);
+        }
+    }
+    if (newest != INT64_MIN) expire(std::max(newest, toMillis(std::chrono::system_clock::now())));
+    notifySealed(lock);
+    return true;
+}
+
+HistoryStats MetricHistory::getStats() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    HistoryStats stats = {};
+    stats.deviceBlocks = sealed[0].size();
+    stats.processBlocks = sealed[1].size();
+    stats.bytes = sealedBytes;
+    stats.oldestTimestamp = INT64_MAX;
+    for (int t = 0; t < 2; t++) {
+        for (const auto& block : sealed[t]) {
+            stats.rows += block->rows();
+            stats.oldestTimestamp = std::min(stats.oldestTimestamp, block->minTimestamp);
+        }
+        if (active[t]) {
+            stats.rows += active[t]->rows();
+            stats.bytes += active[t]->bytes();
+            stats.oldestTimestamp = std::min(stats.oldestTimestamp, active[t]->minTimestamp);
+        }
+    }
+    if (stats.oldestTimestamp == INT64_MAX) stats.oldestTimestamp = 0;
+    stats.blocksExpired = blocksExpired;
+    return stats;
+}
+
+HistoryAccumulator::HistoryAccumulator()
+    : table(HistoryTable::Device), column(0), bucketCount(1), overflow(false) {
+}
+
+bool HistoryAccumulator::init(const HistoryQuery& query, std::string& error) {
+    if (query.metric < 0 || query.metric >= HM_METRIC_COUNT) {
+        error = "unknown metric";
+        return false;
+    }
+    if (query.end <= query.start || query.step < 0) {
+        error = "invalid time range";
+        return false;
+    }
+
+    table = historyMetricTable(query.metric);
+    column = table == HistoryTable::Device ? query.metric : query.metric - HM_DEVICE_METRIC_COUNT;
+    if (query.groupBy == HistoryGroupBy::Process && table != HistoryTable::Process) {
+        error = "group=process requires a process metric";
+        return false;
+    }
+    if (!query.pids.empty() && table != HistoryTable::Process) {
+        error = "pid filter requires a process metric";
+        return false;
+    }
+
+    bucketCount = query.step > 0 ? static_cast<size_t>((query.end - query.start + query.step - 1) / query.step) : 1;
+    if (bucketCount > kMaxQueryCells) {
+        error = "too many buckets";
+        return false;
+    }
+
+    this->query = query;
+    std::sort(this->query.pids.begin(), this->query.pids.end());
+    groups.clear();
+    groupIds.clear();
+    deviceGroups.clear();
+    overflow = false;
+    return true;
+}
+
+uint32_t HistoryAccumulator::addGroup(uint64_t key, unsigned int device, uint32_t pid) {
+    auto it = groupIds.find(key);
+    if (it != groupIds.end()) return it->second;
+
+    Group group;
+    group.series.device = device;
+    group.series.pid = pid;
+    group.count.assign(bucketCount, 0);
+    if (query.aggregate == HistoryAggregate::Quantile) {
+        group.samples.resize(bucketCount);
+    } else {
+        group.sum.assign(bucketCount, 0.0);
+        group.min.assign(bucketCount, INFINITY);
+        group.max.assign(bucketCount, -INFINITY);
+        group.last.assign(bucketCount, 0.0);
+        group.lastTimestamp.assign(bucketCount, INT64_MIN);
+    }
+    groups.push_back(std::move(group));
+    uint32_t id = static_cast<uint32_t>(groups.size() - 1);
+    groupIds.emplace(key, id);
+    if (groups.size() * bucketCount > kMaxQueryCells) overflow = true;
+    return id;
+}
+
+size_t HistoryAccumulator::add(const HistoryRows& rows) {
+    if (overflow) return 0;
+
+    const int64_t* ts = rows.timestamps;
+    size_t lo = std::lower_bound(ts, ts + rows.count, query.start) - ts;
+    size_t hi = std::lower_bound(ts, ts + rows.count, query.end) - ts;
+    if (lo >= hi) return 0;
+
+    // 1) 선택 벡터
+    selection.clear();
+    const uint32_t* devices = rows.devices;
+    const std::vector<uint32_t>& pids = query.pids;
+    if (query.deviceMask == ~0ULL && pids.empty()) {
+        for (size_t i = lo; i < hi; i++) selection.push_back(static_cast<uint32_t>(i));
+    } else {
+        for (size_t i = lo; i < hi; i++) {
+            if (!(query.deviceMask & historyDeviceBit(devices[i]))) continue;
+            if (!pids.empty() && !std::binary_search(pids.begin(), pids.end(), rows.pids[i])) continue;
+            selection.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    size_t n = selection.size();
+    if (n == 0) return 0;
+
+    // 2) 버킷 id
+    buckets.resize(n);
+    if (query.step > 0) {
+        for (size_t k = 0; k < n; k++) {
+            buckets[k] = static_cast<uint32_t>((ts[selection[k]] - query.start) / query.step);
+        }
+    } else {
+        std::fill(buckets.begin(), buckets.end(), 0);
+    }
+
+    // 3) 그룹 id
+    groupOf.resize(n);
+    switch (query.groupBy) {
+        case HistoryGroupBy::None: {
+            uint32_t id = addGroup(0, 0, 0);
+            std::fill(groupOf.begin(), groupOf.end(), id);
+            break;
+        }
+        case HistoryGroupBy::Device:
+            // 디바이스 수가 작으므로 인덱스로 바로 찾는다
+            for (size_t k = 0; k < n; k++) {
+                uint32_t device = devices[selection[k]];
+                if (device >= deviceGroups.size()) deviceGroups.resize(device + 1, UINT32_MAX);
+                if (deviceGroups[device] == UINT32_MAX) deviceGroups[device] = addGroup(device, device, 0);
+                groupOf[k] = deviceGroups[device];
+            }
+            break;
+        case HistoryGroupBy::Process:
+            for (size_t k = 0; k < n; k++) {
+                size_t row = selection[k];
+                uint64_t key = (static_cast<uint64_t>(devices[row]) << 32) | rows.pids[row];
+                groupOf[k] = addGroup(key, devices[row], rows.pids[row]);
+                Group& g = groups[groupOf[k]];
+                if (ts[row] >= g.nameTimestamp) {
+                    g.nameTimestamp = ts[row];
+                    g.series.nameId = rows.nameMap ? rows.nameMap[rows.names[row]] : rows.names[row];
+                }
+            }
+            break;
+    }
+    if (overflow) return 0;
+
+    // 4) 집계 (집계 종류별로 분기 밖에서 고른 단순 루프)
+    if (rows.counts) {
+        addRollup(rows, n);
+        return n;
+    }
+    const double* values = rows.values;
+    switch (query.aggregate) {
+        case HistoryAggregate::Avg:
+        case HistoryAggregate::Sum:
+            for (size_t k = 0; k < n; k++) {
+                Group& g = groups[groupOf[k]];
+                g.sum[buckets[k]] += values[selection[k]];
+                g.count[buckets[k]]++;
+            }
+            break;
+        case HistoryAggregate::Min:
+            for (size_t k = 0; k < n; k++) {
+                Group& g = groups[groupOf[k]];
+                g.min[buckets[k]] = std::min(g.min[buckets[k]], values[selection[k]]);
+                g.count[buckets[k]]++;
+            }
+            break;
+        case HistoryAggregate::Max:
+            for (size_t k = 0; k < n; k++) {
+                Group& g = groups[groupOf[k]];
+                g.max[buckets[k]] = std::max(g.max[buckets[k]], values[selection[k]]);
+                g.count[buckets[k]]++;
+            }
+            break;
+        case HistoryAggregate::Count:
+            for (size_t k = 0; k < n; k++) {
+                groups[groupOf[k]].count[buckets[k]]++;
+            }
+            break;
+        case HistoryAggregate::Last:
+            for (size_t k = 0; k < n; k++) {
+                Group& g = groups[groupOf[k]];
+                int64_t rowTs = ts[selection[k]];
+                if (rowTs >= g.lastTimestamp[buckets[k]]) {
+                    g.lastTimestamp[buckets[k]] = rowTs;
+                    g.last[buckets[k]] = values[selection[k]];
+                }
+                g.count[buckets[k]]++;
+            }
+            break;
+        case HistoryAggregate::Quantile:
+            for (size_t k = 0; k < n; k++) {
+                Group& g = groups[groupOf[k]];
+                g.samples[buckets[k]].push_back(values[selection[k]]);
+                g.count[buckets[k]]++;
+            }
+            break;
+    }
+    return n;
+}
+
+void HistoryAccumulator::addRollup(const HistoryRows& rows, size_t n) {
+    // 다운샘플 행은 버킷 하나가 원본 샘플 counts[i]개를 대표한다
+    const uint32_t* counts = rows.counts;
+    switch (query.aggregate) {
+        case HistoryAggregate::Avg:
+        case HistoryAggregate::Sum:
+            for (size_t k = 0; k < n; k++) {
+                Group& g = groups[groupOf[k]];
+                g.sum[buckets[k]] += rows.sums[selection[k]];
+                g.count[buckets[k]] += counts[selection[k]];
+            }
+            break;
+        case HistoryAggregate::Min:
+            for (size_t k = 0; k < n; k++) {
+                Group& g = groups[groupOf[k]];
+                g.min[buckets[k]] = std::min(g.min[buckets[k]], rows.mins[selection[k]]);
+                g.count[buckets[k]] += counts[selection[k]];
+            }
+            break;
+        case HistoryAggregate::Max:
+            for (size_t k = 0; k < n; k++) {
+                Group& g = groups[groupOf[k]];
+                g.max[buckets[k]] = std::max(g.max[buckets[k]], rows.maxs[selection[k]]);
+                g.count[buckets[k]] += counts[selection[k]];
+            }
+            break;
+        case HistoryAggregate::Count:
+            for (size_t k = 0; k < n; k++) {
+                groups[groupOf[k]].count[buckets[k]] += counts[selection[k]];
+            }
+            break;
+        case HistoryAggregate::Last:
+            for (size_t k = 0; k < n; k++) {
+                Group& g = groups[groupOf[k]];
+                int64_t rowTs = rows.timestamps[selection[k]];
+                if (rowTs >= g.lastTimestamp[buckets[k]]) {
+                    g.lastTimestamp[buckets[k]] = rowTs;
+                    g.last[buckets[k]] = rows.values[selection[k]];
+                }
+                g.count[buckets[k]] += counts[selection[k]];
+            }
+            break;
+        case HistoryAggregate::Quantile:
+            for (size_t k = 0; k < n; k++) {
+                Group& g = groups[groupOf[k]];
+                g.samples[buckets[k]].push_back(rows.values[selection[k]]);
+                g.count[buckets[k]] += counts[selection[k]];
+            }
+            break;
+    }
+}
+
+void HistoryAccumulator::merge(HistoryAccumulator& other) {
+    overflow = overflow || other.overflow;
+    for (auto& theirs : other.groups) {
+        uint64_t key = 0;
+        if (query.groupBy == HistoryGroupBy::Device) key = theirs.series.device;
+        if (query.groupBy == HistoryGroupBy::Process) {
+            key = (static_cast<uint64_t>(theirs.series.device) << 32) | theirs.series.pid;
+        }
+        Group& g = groups[addGroup(key, theirs.series.device, theirs.series.pid)];
+        if (theirs.nameTimestamp >= g.nameTimestamp) {
+            g.nameTimestamp = theirs.nameTimestamp;
+            g.series.nameId = theirs.series.nameId;
+        }
+        for (size_t b = 0; b < bucketCount; b++) {
+            if (theirs.count[b] == 0) continue;
+            g.count[b] += theirs.count[b];
+            if (query.aggregate == HistoryAggregate::Quantile) {
+                g.samples[b].insert(g.samples[b].end(), theirs.samples[b].begin(), theirs.samples[b].end());
+                continue;
+            }
+            g.sum[b] += theirs.sum[b];
+            g.min[b] = std::min(g.min[b], theirs.min[b]);
+            g.max[b] = std::max(g.max[b], theirs.max[b]);
+            if (theirs.lastTimestamp[b] >= g.lastTimestamp[b]) {
+                g.lastTimestamp[b] = theirs.lastTimestamp[b];
+                g.last[b] = theirs.last[b];
+            }
+        }
+    }
+    other.groups.clear();
+    other.groupIds.clear();
+}
+
+bool HistoryAccumulator::finish(std::vector<HistorySeries>& result, std::string& error) {
+    if (overflow) {
+        error = "too many groups";
+        return false;
+    }
+
+    // 결과: 값이 있는 버킷만
+    result.clear();
+    for (auto& g : groups) {
+        HistorySeries& series = g.series;
+        for (size_t b = 0; b < bucketCount; b++) {
+            if (g.count[b] == 0) continue;
+
+            double value = 0;
+            switch (query.aggregate) {
+                case HistoryAggregate::Avg: value = g.sum[b] / g.count[b]; break;
+                case HistoryAggregate::Sum: value = g.sum[b]; break;
+                case HistoryAggregate::Min: value = g.min[b]; break;
+                case HistoryAggregate::Max: value = g.max[b]; break;
+                case HistoryAggregate::Count: value = g.count[b]; break;
+                case HistoryAggregate::Last: value = g.last[b]; break;
+                case HistoryAggregate::Quantile: {
+                    // 가장 가까운 순위 (nearest-rank)
+                    auto& samples = g.samples[b];
+                    size_t rank = static_cast<size_t>(std::ceil(query.quantile * samples.size()));
+                    rank = std::min(std::max<size_t>(rank, 1), samples.size()) - 1;
+                    std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+                    value = samples[rank];
+                    break;
+                }
+            }
+            series.timestamps.push_back(query.start + static_cast<int64_t>(b) * query.step);
+            series.values.push_back(value);
+        }
+        result.push_back(std::move(series));
+    }
+    groups.clear();
+    groupIds.clear();
+
+    std::sort(result.begin(), result.end(), [](const HistorySeries& a, const HistorySeries& b) {
+        return a.device != b.device ? a.device < b.device : a.pid < b.pid;
+    });
+    return true;
+}
+
+bool HistoryQueryEngine::run(const HistoryQuery& query, std::vector<HistorySeries>& result,
+                             std::string& error) const {
+    HistoryAccumulator accumulator;
+    if (!accumulator.init(query, error)) return false;
+
+    for (const auto& blockPtr : history.blocks(accumulator.getTable(), query.start, query.end)) {
+        const HistoryBlock& block = *blockPtr;
+        if (!(block.deviceMask & query.deviceMask)) continue;
+
+        HistoryRows rows;
+        rows.count = block.rows();
+        rows.timestamps = block.timestamps.data();
+        rows.devices = block.devices.data();
+        rows.pids = block.pids.data();
+        rows.names = block.names.data();
+        rows.values = block.values[accumulator.getColumn()].data();
+        if (block.rollup()) {
+            rows.counts = block.counts.data();
+            rows.sums = block.sums[accumulator.getColumn()].data();
+            rows.mins = block.mins[accumulator.getColumn()].data();
+            rows.maxs = block.maxs[accumulator.getColumn()].data();
+        }
+        accumulator.add(rows);
+    }
+    return accumulator.finish(result, error);
+}
+
+bool parseHistoryRange(const HttpRequest& request, const MetricHistory& history, HistoryQuery& query,
+                       std::string& error) {
+    int64_t now = toMillis(std::chrono::system_clock::now());
+
+    if (!parseTimeMs(request.queryParam("start", "-1h"), now, query.start) ||
+        !parseTimeMs(request.queryParam("end", "now"), now, query.end)) {
+        error = "invalid start/end";
+        return false;
+    }
+    // end가 "now"이면 방금 들어온 행도 포함
+    if (request.queryParam("end", "now") == "now") query.end++;
+
+    std::string gpus = request.queryParam("gpu");
+    if (!gpus.empty()) {
+        query.deviceMask = 0;
+        for (const auto& item : splitList(gpus)) {
+            char* end = nullptr;
+            unsigned long index = std::strtoul(item.c_str(), &end, 10);
+            if (*end != '\0') {
+                int found = history.deviceIndex(item);
+                if (found < 0) {
+                    error = "unknown gpu " + item;
+                    return false;
+                }
+                index = static_cast<unsigned long>(found);
+            }
+            query.deviceMask |= historyDeviceBit(static_cast<unsigned int>(index));
+        }
+    }
+
+    for (const auto& item : splitList(request.queryParam("pid"))) {
+        char* end = nullptr;
+        errno = 0;
+        unsigned long pid = std::strtoul(item.c_str(), &end, 10);
+        if (*end != '\0' || errno == ERANGE || pid > UINT32_MAX || item[0] == '-') {
+            error = "invalid pid " + item;
+            return false;
+        }
+        query.pids.push_back(static_cast<uint32_t>(pid));
+    }
+    return true;
+}
+
+bool parseHistoryQuery(const HttpRequest& request, const MetricHistory& history, HistoryQuery& query,
+                       std::string& error) {
+    query.metric = historyMetricFromName(request.queryParam("metric"));
+    if (query.metric < 0) {
+        error = "unknown metric";
+        return false;
+    }
+
+    if (!parseHistoryRange(request, history, query, error)) return false;
+
+    std::string step = request.queryParam("step");
+    query.step = 0;
+    if (!step.empty() && !parseDurationMs(step, query.step)) {
+        error = "invalid step";
+        return false;
+    }
+
+    std::string aggregate = request.queryParam("agg", "avg");
+    if (aggregate == "avg") query.aggregate = HistoryAggregate::Avg;
+    else if (aggregate == "min") query.aggregate = HistoryAggregate::Min;
+    else if (aggregate == "max") query.aggregate = HistoryAggregate::Max;
+    else if (aggregate == "sum") query.aggregate = HistoryAggregate::Sum;
+    else if (aggregate == "count") query.aggregate = HistoryAggregate::Count;
+    else if (aggregate == "last") query.aggregate = HistoryAggregate::Last;
+    else if (aggregate.size() > 1 && aggregate[0] == 'p') {
+        // p50, p95, p99.9
+        char* end = nullptr;
+        double percent = std::strtod(aggregate.c_str() + 1, &end);
+        if (*end != '\0' || percent <= 0 || percent > 100) {
+            error = "invalid percentile";
+            return false;
+        }
+        query.aggregate = HistoryAggregate::Quantile;
+        query.quantile = percent / 100;
+    } else {
+        error = "unknown aggregate";
+        return false;
+    }
+
+    std::string group = request.queryParam("group", "none");
+    if (group == "none") query.groupBy = HistoryGroupBy::None;
+    else if (group == "device") query.groupBy = HistoryGroupBy::Device;
+    else if (group == "process") query.groupBy = HistoryGroupBy::Process;
+    else if (group == "mig") {
+        error = "MIG slices are not recorded in the history";
+        return false;
+    } else {
+        error = "unknown group";
+        return false;
+    }
+    return true;
+}
+
+void appendHistoryJson(const HistoryQuery& query, const std::vector<HistorySeries>& result,
+                       const std::vector<std::string>& uuids, const std::vector<std::string>& names, std::string& out) {
+    char aggregate[16];
+    out += "{\"metric\":\"";
+    out += historyMetricName(query.metric);
+    out += "\",\"aggregate\":\"";
+    out += aggregateName(query, aggregate, sizeof(aggregate));
+    out += "\",\"start\":" + std::to_string(query.start);
+    out += ",\"end\":" + std::to_string(query.end);
+    out += ",\"step\":" + std::to_string(query.step);
+    out += ",\"series\":[";
+    for (size_t s = 0; s < result.size(); s++) {
+        const HistorySeries& series = result[s];
+        if (s) out.push_back(',');
+        out.push_back('{');
+        if (query.groupBy != HistoryGroupBy::None) {
+            out += "\"gpu\":" + std::to_string(series.device) + ",\"uuid\":";
+            appendJsonString(series.device < uuids.size() ? uuids[series.device] : "", out);
+            out.push_back(',');
+        }
+        if (query.groupBy == HistoryGroupBy::Process) {
+            out += "\"pid\":" + std::to_string(series.pid) + ",\"name\":";
+            appendJsonString(series.nameId < names.size() ? names[series.nameId] : "", out);
+            out.push_back(',');
+        }
+        out += "\"points\":[";
+        for (size_t i = 0; i < series.timestamps.size(); i++) {
+            if (i) out.push_back(',');
+            out.push_back('[');
+            out += std::to_string(series.timestamps[i]);
+            out.push_back(',');
+            appendNumber(series.values[i], out);
+            out.push_back(']');
+        }
+        out += "]}";
+    }
+    out += "]}\n";
+}
+
+void registerHistoryApi(HttpServer& server, const MetricHistory& history, const std::string& path) {
+    server.route(path, [&history](const HttpRequest& request, HttpResponse& response) {
+        HistoryQuery query;
+        std::string error;
+        std::vector<HistorySeries> result;
+        if (!parseHistoryQuery(request, history, query, error) ||
+            !HistoryQueryEngine(history).run(query, result, error)) {
+            response.status = 400;
+            response.contentType = "application/json";
+            response.body = errorJson(error);
+            return;
+        }
+
+        std::string& out = response.body;
+        if (request.queryParam("format") == "binary") {
+            response.contentType = "application/octet-stream";
+            putLE<uint32_t>(static_cast<uint32_t>(result.size()), out);
+            for (const auto& series : result) {
+                std::string name = query.groupBy == HistoryGroupBy::Process ? history.processName(series.nameId) : "";
+                putLE<uint32_t>(series.device, out);
+                putLE<uint32_t>(series.pid, out);
+                putLE<uint32_t>(static_cast<uint32_t>(name.size()), out);
+                out += name;
+                putLE<uint32_t>(static_cast<uint32_t>(series.timestamps.size()), out);
+                for (size_t i = 0; i < series.timestamps.size(); i++) {
+                    putLE<int64_t>(series.timestamps[i], out);
+                    putLE<double>(series.values[i], out);
+                }
+            }
+            return;
+        }
+
+        response.contentType = "application/json";
+        appendHistoryJson(query, result, history.deviceUuids(), history.processNames(), out);
+    });
+}
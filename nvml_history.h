@@ -0,0 +1,293 @@
+#ifndef NVML_HISTORY_H
+#define NVML_HISTORY_H
+
+#include "nvml_checkpoint.h"
+#include "nvml_exporter.h"
+#include "nvml_http.h"
+#include <shared_mutex>
+#include <unordered_map>
+
+// 히스토리 테이블
+enum class HistoryTable {
+    Device,  // 틱마다 GPU당 한 행
+    Process  // 틱마다 프로세스당 한 행
+};
+
+// 열 (Device 테이블 지표 15개 + Process 테이블 지표 1개)
+enum HistoryMetric {
+    HM_GPU_UTILIZATION,
+    HM_MEMORY_UTILIZATION,
+    HM_ENCODER_UTILIZATION,
+    HM_DECODER_UTILIZATION,
+    HM_MEMORY_USED,
+    HM_MEMORY_TOTAL,
+    HM_TEMPERATURE,
+    HM_FAN_SPEED,
+    HM_POWER_USAGE,
+    HM_POWER_LIMIT,
+    HM_SM_CLOCK,
+    HM_MEMORY_CLOCK,
+    HM_GRAPHICS_CLOCK,
+    HM_ECC_SINGLE_BIT,
+    HM_ECC_DOUBLE_BIT,
+    HM_DEVICE_METRIC_COUNT,
+
+    HM_PROCESS_MEMORY = HM_DEVICE_METRIC_COUNT,
+    HM_METRIC_COUNT
+};
+
+const char* historyMetricName(int metric);
+int historyMetricFromName(const std::string& name); // 없으면 -1
+HistoryTable historyMetricTable(int metric);
+double historyMetricValue(const GPUMetrics& metrics, int metric); // Device 테이블 지표 값
+bool parseHistoryDuration(const std::string& text, int64_t& ms);   // "250ms", "10s", "5m", "2h", "1d"
+
+// 열 단위 블록. 봉인된 블록은 바뀌지 않으므로 질의는 락 없이 읽는다
+struct HistoryBlock {
+    HistoryTable table;
+    std::vector<int64_t> timestamps;  // ms, 오름차순
+    std::vector<uint32_t> devices;
+    std::vector<uint32_t> pids;       // Process
+    std::vector<uint32_t> names;      // Process, MetricHistory 이름 사전 id
+    std::vector<std::vector<double>> values; // 테이블의 지표별 열
+    int64_t minTimestamp = INT64_MAX;
+    int64_t maxTimestamp = INT64_MIN;
+    uint64_t deviceMask = 0;          // 블록에 있는 디바이스 (64 이상은 비트 63)
+
+    // 다운샘플 블록만: 행(버킷)마다 원본 샘플 수와 열별 합/최소/최대. values는 평균 (sums / counts)
+    // 비어 있으면 원본 블록 (행마다 샘플 하나)
+    std::vector<uint32_t> counts;
+    std::vector<std::vector<double>> sums;
+    std::vector<std::vector<double>> mins;
+    std::vector<std::vector<double>> maxs;
+
+    explicit HistoryBlock(HistoryTable table);
+    size_t rows() const { return timestamps.size(); }
+    bool rollup() const { return !counts.empty(); }
+    size_t bytes() const;
+};
+
+using HistoryBlockPtr = std::shared_ptr<const HistoryBlock>;
+
+inline uint64_t historyDeviceBit(unsigned int device) {
+    return 1ULL << (device < 63 ? device : 63);
+}
+
+struct HistoryConfig {
+    size_t blockRows = 4096;
+    int64_t retentionMs = 24LL * 3600 * 1000;     // 이보다 오래된 블록은 버린다
+    size_t maxBytes = 256ULL * 1024 * 1024;      // 메모리 상한 (오래된 블록부터 버린다)
+};
+
+struct HistoryStats {
+    size_t deviceBlocks;
+    size_t processBlocks;
+    size_t rows;
+    size_t bytes;
+    int64_t oldestTimestamp;
+    uint64_t blocksExpired;
+};
+
+// 로컬 지표 히스토리 (메모리 열 저장소)
+class MetricHistory {
+private:
+    HistoryConfig config;
+
+    mutable std::shared_mutex mutex;
+    std::vector<HistoryBlockPtr> sealed[2];        // 테이블별, 오래된 순
+    std::shared_ptr<HistoryBlock> active[2];
+    std::vector<std::string> names;                // 프로세스 이름 사전
+    std::unordered_map<std::string, uint32_t> nameIds;
+    std::unordered_map<InternId, uint32_t> internedNameIds;   // 인터닝 id -> 사전 id (틱마다 문자열 해시 없이)
+    std::vector<std::string> uuids;                // 디바이스 인덱스 -> UUID
+    size_t sealedBytes;
+    uint64_t blocksExpired;
+    std::function<void(const HistoryBlockPtr&)> sealCallback;
+    std::vector<HistoryBlockPtr> newlySealed;      // 락을 놓은 뒤 콜백으로 넘긴다
+
+public:
+    explicit MetricHistory(const HistoryConfig& config = HistoryConfig());
+
+    void setDevices(const std::vector<GPUInfo>& gpus);
+    void append(const MetricsSnapshot& snapshot);
+
+    // 블록이 봉인될 때마다 호출 (append/flush를 부른 스레드에서, 락 밖에서)
+    void setSealCallback(std::function<void(const HistoryBlockPtr&)> callback);
+    // 활성 블록을 강제로 봉인 (종료 시)
+    void flush();
+
+    // [start, end)와 겹치는 블록 (활성 블록은 복사본). 반환된 블록은 읽기 전용으로 계속 유효하다
+    std::vector<HistoryBlockPtr> blocks(HistoryTable table, int64_t start, int64_t end) const;
+
+    std::string processName(uint32_t id) const;
+    std::vector<std::string> processNames() const;
+    std::vector<std::string> deviceUuids() const;    // 인덱스 순
+    std::string deviceUuid(unsigned int index) const;
+    int deviceIndex(const std::string& uuid) const; // 없으면 -1
+
+    HistoryStats getStats() const;
+
+    // 체크포인트 (이름 사전, 봉인/활성 블록). 봉인된 블록은 바뀌지 않으므로 락은 목록 복사에만 잡는다
+    // persistedUntil이 있으면 테이블별로 그 시각까지의 행은 세그먼트에 있다고 보고, 그 뒤의 블록만 쓴다
+    void saveCheckpoint(CheckpointWriter& writer, const int64_t* persistedUntil = nullptr) const;
+    // 시작 시 append 전에 한 번. 이미 쌓인 행이 있거나 payload가 깨졌으면 아무것도 바꾸지 않고 false
+    // 저장 당시나 지금(persistedUntil) 세그먼트에 있는 행은 버리고, 되살린 봉인 블록은 봉인 콜백으로 다시 넘긴다
+    bool restoreCheckpoint(CheckpointReader& reader, const int64_t* persistedUntil = nullptr);
+
+private:
+    HistoryBlock& activeBlock(HistoryTable table);
+    void seal(HistoryTable table);
+    void expire(int64_t now);
+    void notifySealed(std::unique_lock<std::shared_mutex>& lock);
+};
+
+// 집계 함수
+enum class HistoryAggregate {
+    Avg,
+    Min,
+    Max,
+    Sum,
+    Count,
+    Last,
+    Quantile
+};
+
+enum class HistoryGroupBy {
+    None,
+    Device,
+    Process  // (디바이스, PID)
+};
+
+struct HistoryQuery {
+    int metric = HM_GPU_UTILIZATION;
+    int64_t start = 0;        // ms, 포함
+    int64_t end = 0;          // ms, 제외
+    int64_t step = 0;         // ms, 0이면 구간 전체를 한 값으로
+    HistoryAggregate aggregate = HistoryAggregate::Avg;
+    double quantile = 0.5;
+    HistoryGroupBy groupBy = HistoryGroupBy::None;
+    uint64_t deviceMask = ~0ULL;
+    std::vector<uint32_t> pids; // 비어 있으면 전체
+};
+
+struct HistorySeries {
+    unsigned int device = 0;  // groupBy Device/Process
+    uint32_t pid = 0;         // groupBy Process
+    uint32_t nameId = 0;
+    std::vector<int64_t> timestamps; // 버킷 시작 시각 (값이 있는 버킷만)
+    std::vector<double> values;
+};
+
+// 열 단위 행 묶음 (HistoryBlock 또는 세그먼트 mmap 영역)
+struct HistoryRows {
+    size_t count = 0;
+    const int64_t* timestamps = nullptr;  // 오름차순
+    const uint32_t* devices = nullptr;
+    const uint32_t* pids = nullptr;       // Process
+    const uint32_t* names = nullptr;      // Process
+    const double* values = nullptr;       // 질의 지표 열
+    const uint32_t* nameMap = nullptr;    // names -> 결과 이름 id (nullptr이면 그대로)
+
+    // 다운샘플 행: 원본 샘플 수와 질의 지표 열의 합/최소/최대 (원본 행이면 nullptr)
+    // avg/sum/count/min/max는 정확히 합쳐지고, last/분위수는 버킷 평균을 값 하나로 본다
+    const uint32_t* counts = nullptr;
+    const double* sums = nullptr;
+    const double* mins = nullptr;
+    const double* maxs = nullptr;
+};
+
+// 질의 집계 상태 (그룹 x 버킷)
+// 열 단위 벡터화 실행: 행 묶음마다 시간 범위를 이진 탐색으로 자르고, 선택 벡터 -> 버킷/그룹 id 벡터 -> 집계 순으로
+// 한 열씩 훑는다. 스레드마다 따로 쌓은 상태는 merge로 합친다. 분위수는 버킷별 값을 모아 nth_element
+class HistoryAccumulator {
+private:
+    struct Group {
+        HistorySeries series;
+        int64_t nameTimestamp = INT64_MIN; // PID 재사용 시 최신 이름
+        std::vector<double> sum;
+        std::vector<double> min;
+        std::vector<double> max;
+        std::vector<double> last;
+        std::vector<int64_t> lastTimestamp;
+        std::vector<uint32_t> count;
+        std::vector<std::vector<double>> samples;
+    };
+
+    HistoryQuery query;
+    HistoryTable table;
+    int column;
+    size_t bucketCount;
+    std::vector<Group> groups;
+    std::unordered_map<uint64_t, uint32_t> groupIds;
+    std::vector<uint32_t> deviceGroups;
+    bool overflow;
+
+    std::vector<uint32_t> selection;
+    std::vector<uint32_t> buckets;
+    std::vector<uint32_t> groupOf;
+
+public:
+    HistoryAccumulator();
+
+    // 질의 검증. 실패하면 error
+    bool init(const HistoryQuery& query, std::string& error);
+
+    HistoryTable getTable() const { return table; }
+    int getColumn() const { return column; } // 테이블 안의 지표 열
+
+    // 선택된 행 수
+    size_t add(const HistoryRows& rows);
+    void merge(HistoryAccumulator& other);
+    bool finish(std::vector<HistorySeries>& result, std::string& error);
+
+private:
+    uint32_t addGroup(uint64_t key, unsigned int device, uint32_t pid);
+    void addRollup(const HistoryRows& rows, size_t n);
+};
+
+class HistoryQueryEngine {
+private:
+    const MetricHistory& history;
+
+public:
+    explicit HistoryQueryEngine(const MetricHistory& history) : history(history) {}
+
+    bool run(const HistoryQuery& query, std::vector<HistorySeries>& result, std::string& error) const;
+};
+
+// 범위 파라미터만 파싱 (start/end/gpu/pid -> query.start/end/deviceMask/pids)
+bool parseHistoryRange(const HttpRequest& request, const MetricHistory& history, HistoryQuery& query,
+                       std::string& error);
+
+// 질의 문자열 파싱
+//   metric=gpu_utilization&start=-1h&end=now&step=10s&agg=p95&group=device&gpu=<index|uuid>&pid=123
+// 시각은 ms 절대값, "now", "-<기간>"(지금 기준). 기간은 ms/s/m/h/d 단위
+bool parseHistoryQuery(const HttpRequest& request, const MetricHistory& history, HistoryQuery& query,
+                       std::string& error);
+
+// 질의 결과 JSON ({"metric":..,"series":[..]}). uuids/names는 series.device/nameId로 찾는다
+void appendHistoryJson(const HistoryQuery& query, const std::vector<HistorySeries>& result,
+                       const std::vector<std::string>& uuids, const std::vector<std::string>& names, std::string& out);
+
+// HTTP API (/api/query). format=binary이면 리틀 엔디언 바이너리:
+//   u32 seriesCount, 시리즈마다 u32 device, u32 pid, u32 nameLength, name, u32 pointCount, (i64 ts, f64 value)*
+void registerHistoryApi(HttpServer& server, const MetricHistory& history, const std::string& path = "/api/query");
+
+// 파이프라인 싱크: 스냅샷을 히스토리에 쌓는다
+class HistorySink : public MetricsSink {
+private:
+    MetricHistory& history;
+
+public:
+    explicit HistorySink(MetricHistory& history) : history(history) {}
+
+    std::string name() const override { return "history"; }
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override {
+        for (const auto& snapshot : batch) {
+            history.append(*snapshot);
+        }
+        return true;
+    }
+};
+
+#endif // NVML_HISTORY_H
@@ -0,0 +1,280 @@
+#include "nvml_host.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <unistd.h>
+
+namespace {
+
+const char* const kPressurePaths[HOST_PRESSURE_COUNT] = {
+    "/proc/pressure/cpu",
+    "/proc/pressure/memory",
+    "/proc/pressure/io",
+};
+
+int openProc(const char* path) {
+    return ::open(path, O_RDONLY | O_CLOEXEC);
+}
+
+// 공백으로 구분된 다음 부호 없는 정수 (없으면 0)
+unsigned long long nextNumber(const char*& cursor) {
+    char* end = nullptr;
+    unsigned long long value = std::strtoull(cursor, &end, 10);
+    if (end == cursor) return 0;
+    cursor = end;
+    return value;
+}
+
+// "some avg10=1.23 avg60=... total=456" 한 줄
+bool parsePressureLine(const char* line, const char* kind, double& avg10, unsigned long long& totalUs) {
+    size_t length = std::strlen(kind);
+    if (std::strncmp(line, kind, length) != 0) return false;
+    const char* avg = std::strstr(line, "avg10=");
+    const char* total = std::strstr(line, "total=");
+    if (!avg || !total) return false;
+    avg10 = std::strtod(avg + 6, nullptr);
+    totalUs = std::strtoull(total + 6, nullptr, 10);
+    return true;
+}
+
+double percentOf(unsigned long long delta, unsigned long long total) {
+    return total > 0 ? 100.0 * delta / total : 0;
+}
+
+} // namespace
+
+HostCollector::HostCollector()
+    : statFd(-1), meminfoFd(-1), ticksPerSecond(100), cpuCount(0), primed(false),
+      lastCpuTotal(0), lastCpuIdle(0), lastCpuIowait(0), lastCpuSteal(0), generation(0) {
+    for (int i = 0; i < HOST_PRESSURE_COUNT; i++) {
+        pressureFd[i] = -1;
+        lastStallUs[i][0] = lastStallUs[i][1] = 0;
+    }
+}
+
+HostCollector::~HostCollector() {
+    close();
+}
+
+bool HostCollector::open() {
+    close();
+    statFd = openProc("/proc/stat");
+    meminfoFd = openProc("/proc/meminfo");
+    if (statFd < 0 || meminfoFd < 0) {
+        std::cerr << "Failed to open /proc/stat or /proc/meminfo: " << std::strerror(errno) << std::endl;
+        close();
+        return false;
+    }
+    // PSI는 CONFIG_PSI가 꺼져 있으면 없다 (읽기 실패 시에도 닫는다)
+    for (int i = 0; i < HOST_PRESSURE_COUNT; i++) {
+        pressureFd[i] = openProc(kPressurePaths[i]);
+    }
+
+    long ticks = sysconf(_SC_CLK_TCK);
+    ticksPerSecond = ticks > 0 ? ticks : 100;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    cpuCount = cpus > 0 ? static_cast<unsigned int>(cpus) : 0;
+    primed = false;
+    return true;
+}
+
+void HostCollector::close() {
+    if (statFd >= 0) ::close(statFd);
+    if (meminfoFd >= 0) ::close(meminfoFd);
+    statFd = meminfoFd = -1;
+    for (int i = 0; i < HOST_PRESSURE_COUNT; i++) {
+        if (pressureFd[i] >= 0) ::close(pressureFd[i]);
+        pressureFd[i] = -1;
+    }
+    for (auto& entry : processes) {
+        if (entry.second.fd >= 0) ::close(entry.second.fd);
+    }
+    processes.clear();
+}
+
+ssize_t HostCollector::readAll(int fd) {
+    // /proc 파일은 offset 0 pread마다 내용을 새로 만든다. 버퍼보다 길면 앞부분만 (필요한 줄은 앞에 있다)
+    ssize_t length = pread(fd, buffer, sizeof(buffer) - 1, 0);
+    if (length < 0) return -1;
+    buffer[length] = '\0';
+    return length;
+}
+
+bool HostCollector::readCpu(HostMetrics& out, double seconds) {
+    if (readAll(statFd) <= 0 || std::strncmp(buffer, "cpu ", 4) != 0) return false;
+
+    // cpu user nice system idle iowait irq softirq steal (guest는 user에 이미 포함)
+    const char* cursor = buffer + 4;
+    unsigned long long fields[8];
+    for (int i = 0; i < 8; i++) {
+        fields[i] = nextNumber(cursor);
+    }
+    unsigned long long total = 0;
+    for (int i = 0; i < 8; i++) {
+        total += fields[i];
+    }
+    unsigned long long idle = fields[3];
+    unsigned long long iowait = fields[4];
+    unsigned long long steal = fields[7];
+
+    if (seconds > 0 && total > lastCpuTotal) {
+        unsigned long long deltaTotal = total - lastCpuTotal;
+        unsigned long long deltaIdle = (idle - lastCpuIdle) + (iowait - lastCpuIowait);
+        out.cpuBusyPercent = percentOf(deltaTotal > deltaIdle ? deltaTotal - deltaIdle : 0, deltaTotal);
+        out.cpuIowaitPercent = percentOf(iowait - lastCpuIowait, deltaTotal);
+        out.cpuStealPercent = percentOf(steal - lastCpuSteal, deltaTotal);
+    } else {
+        out.cpuBusyPercent = out.cpuIowaitPercent = out.cpuStealPercent = 0;
+    }
+    lastCpuTotal = total;
+    lastCpuIdle = idle;
+    lastCpuIowait = iowait;
+    lastCpuSteal = steal;
+    return true;
+}
+
+bool HostCollector::readMemory(HostMetrics& out) {
+    if (readAll(meminfoFd) <= 0) return false;
+
+    struct Field {
+        const char* name;
+        unsigned long long* value;
+    };
+    const Field fields[] = {
+        {"MemTotal:", &out.memoryTotal},
+        {"MemAvailable:", &out.memoryAvailable},
+        {"SwapTotal:", &out.swapTotal},
+        {"SwapFree:", &out.swapFree},
+    };
+    size_t found = 0;
+    for (const char* line = buffer; *line && found < 4; ) {
+        for (const auto& field : fields) {
+            size_t length = std::strlen(field.name);
+            if (std::strncmp(line, field.name, length) == 0) {
+                const char* cursor = line + length;
+                *field.value = nextNumber(cursor) * 1024;   // kB
+                found++;
+                break;
+            }
+        }
+        const char* next = std::strchr(line, '\n');
+        if (!next) break;
+        line = next + 1;
+    }
+    return found > 0;
+}
+
+void HostCollector::readPressure(HostMetrics& out, double seconds) {
+    out.pressureValid = false;
+    for (int i = 0; i < HOST_PRESSURE_COUNT; i++) {
+        HostPressure& pressure = out.pressure[i];
+        pressure = HostPressure();
+        if (pressureFd[i] < 0) continue;
+        if (readAll(pressureFd[i]) <= 0) {
+            // psi=0 부팅이면 파일은 있지만 읽기가 EOPNOTSUPP
+            ::close(pressureFd[i]);
+            pressureFd[i] = -1;
+            continue;
+        }
+
+        unsigned long long stall[2] = {0, 0};
+        parsePressureLine(buffer, "some ", pressure.someAvg10, stall[0]);
+        const char* full = std::strstr(buffer, "\nfull ");
+        if (full) {
+            parsePressureLine(full + 1, "full ", pressure.fullAvg10, stall[1]);
+        }
+
+        if (seconds > 0) {
+            double intervalUs = seconds * 1e6;
+            pressure.somePercent = stall[0] >= lastStallUs[i][0] ? 100.0 * (stall[0] - lastStallUs[i][0]) / intervalUs : 0;
+            pressure.fullPercent = stall[1] >= lastStallUs[i][1] ? 100.0 * (stall[1] - lastStallUs[i][1]) / intervalUs : 0;
+        }
+        lastStallUs[i][0] = stall[0];
+        lastStallUs[i][1] = stall[1];
+        out.pressureValid = true;
+    }
+}
+
+void HostCollector::readProcesses(const std::vector<ProcessInfo>& gpuProcesses, HostMetrics& out, double seconds) {
+    generation++;
+    out.processes.clear();
+
+    for (const auto& process : gpuProcesses) {
+        auto inserted = processes.emplace(process.pid, ProcessState{-1, 0, 0, false});
+        ProcessState& state = inserted.first->second;
+        if (!inserted.second && state.generation == generation) continue;   // 여러 GPU를 쓰는 프로세스
+        state.generation = generation;
+
+        char path[32];
+        std::snprintf(path, sizeof(path), "/proc/%u/stat", process.pid);
+        if (inserted.second) {
+            state.fd = openProc(path);
+        }
+        if (state.fd < 0) continue;
+
+        ssize_t length = readAll(state.fd);
+        if (length <= 0) {
+            // 열어 둔 프로세스가 끝났고 같은 pid가 재사용됨 (ESRCH). 새 프로세스로 다시 연다
+            ::close(state.fd);
+            state.fd = openProc(path);
+            state.sampled = false;
+            if (state.fd < 0 || readAll(state.fd) <= 0) continue;
+        }
+
+        // pid (comm) state ppid ... utime(14) stime(15). comm에 공백/괄호가 있을 수 있어 마지막 ')' 뒤부터
+        const char* cursor = std::strrchr(buffer, ')');
+        if (!cursor) continue;
+        cursor++;
+        for (int field = 0; field < 11 && *cursor; field++) {
+            while (*cursor == ' ') cursor++;
+            while (*cursor && *cursor != ' ') cursor++;
+        }
+        unsigned long long ticks = nextNumber(cursor);
+        ticks += nextNumber(cursor);
+
+        HostProcessCpu cpu;
+        cpu.pid = process.pid;
+        cpu.cpuTimeMs = ticks * 1000 / ticksPerSecond;
+        cpu.cpuPercent = state.sampled && seconds > 0 && ticks >= state.lastTicks
+                             ? 100.0 * (ticks - state.lastTicks) / ticksPerSecond / seconds : 0;
+        out.processes.push_back(cpu);
+        state.lastTicks = ticks;
+        state.sampled = true;
+    }
+
+    // 목록에서 빠진 프로세스의 파일은 닫는다
+    for (auto it = processes.begin(); it != processes.end(); ) {
+        if (it->second.generation != generation) {
+            if (it->second.fd >= 0) ::close(it->second.fd);
+            it = processes.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+bool HostCollector::sample(const std::vector<ProcessInfo>& gpuProcesses, HostMetrics& out) {
+    if (statFd < 0) {
+        out.valid = false;
+        return false;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    double seconds = 0;
+    if (primed) {
+        seconds = std::chrono::duration<double>(now - lastSample).count();
+    }
+    out.intervalMs = static_cast<unsigned int>(seconds * 1000);
+    out.cpuCount = cpuCount;
+
+    out.valid = readCpu(out, seconds) && readMemory(out);
+    readPressure(out, seconds);
+    readProcesses(gpuProcesses, out, seconds);
+
+    lastSample = now;
+    primed = true;
+    return out.valid;
+}
@@ -0,0 +1,63 @@
+#ifndef NVML_HOST_H
+#define NVML_HOST_H
+
+#include "nvml_types.h"
+#include <chrono>
+#include <unordered_map>
+#include <sys/types.h>
+
+// 호스트 CPU/메모리/PSI 수집기 (Linux /proc)
+// 입력 파이프라인의 CPU/메모리 정체가 GPU 대기로 보이는 경우를 같은 틱에서 나란히 보려고
+// GPU 스냅샷을 만드는 모니터링 스레드에서 부른다.
+// /proc 파일은 한 번 열어 두고 틱마다 pread(offset 0)로 다시 읽는다 (open/close 없음).
+// 프로세스별 /proc/<pid>/stat도 GPU 프로세스 목록에 있는 동안 열어 둔다
+class HostCollector {
+private:
+    struct ProcessState {
+        int fd;                         // -1이면 열 수 없음 (다른 pid 네임스페이스 등), 목록에서 빠질 때까지 재시도하지 않음
+        unsigned long long lastTicks;
+        unsigned long long generation;
+        bool sampled;
+    };
+
+    int statFd;
+    int meminfoFd;
+    int pressureFd[HOST_PRESSURE_COUNT];
+    long ticksPerSecond;
+    unsigned int cpuCount;
+
+    // 이전 틱 (차이 계산용)
+    bool primed;
+    std::chrono::steady_clock::time_point lastSample;
+    unsigned long long lastCpuTotal;
+    unsigned long long lastCpuIdle;
+    unsigned long long lastCpuIowait;
+    unsigned long long lastCpuSteal;
+    unsigned long long lastStallUs[HOST_PRESSURE_COUNT][2];    // some, full
+
+    std::unordered_map<unsigned int, ProcessState> processes;  // pid -> 상태
+    unsigned long long generation;
+    char buffer[8192];                                         // 모든 파일 읽기에 재사용
+
+public:
+    HostCollector();
+    ~HostCollector();
+    HostCollector(const HostCollector&) = delete;
+    HostCollector& operator=(const HostCollector&) = delete;
+
+    // /proc/stat과 /proc/meminfo를 열 수 없으면 false (PSI는 없어도 된다)
+    bool open();
+    void close();
+
+    // 한 틱 수집. gpuProcesses의 pid마다 CPU 시간을 채우고, 빠진 pid의 파일은 닫는다
+    bool sample(const std::vector<ProcessInfo>& gpuProcesses, HostMetrics& out);
+
+private:
+    ssize_t readAll(int fd);
+    bool readCpu(HostMetrics& out, double seconds);
+    bool readMemory(HostMetrics& out);
+    void readPressure(HostMetrics& out, double seconds);
+    void readProcesses(const std::vector<ProcessInfo>& gpuProcesses, HostMetrics& out, double seconds);
+};
+
+#endif // NVML_HOST_H
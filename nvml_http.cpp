@@ -0,0 +1,555 @@
+#include "nvml_http.h"
+#include <algorithm>
+#include <iostream>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace {
+
+const size_t kReadChunk = 16 * 1024;
+const size_t kMaxHeaderBytes = 64 * 1024;
+const size_t kMaxBodyBytes = 16 * 1024 * 1024;
+const int kMaxEvents = 64;
+
+std::string toLower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+std::string trim(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t");
+    if (begin == std::string::npos) return "";
+    size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// idle keep-alive 연결을 서버가 닫았는지 (FIN/RST가 와 있거나 요청하지 않은 바이트가 있다)
+bool peerClosed(int fd) {
+    char byte;
+    ssize_t n = recv(fd, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (n < 0) return errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR;
+    return true;
+}
+
+} // namespace
+
+std::string urlDecode(const std::string& text) {
+    std::string result;
+    result.reserve(text.size());
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '+') {
+            result.push_back(' ');
+        } else if (text[i] == '%' && i + 2 < text.size() &&
+                   hexValue(text[i + 1]) >= 0 && hexValue(text[i + 2]) >= 0) {
+            result.push_back(static_cast<char>(hexValue(text[i + 1]) * 16 + hexValue(text[i + 2])));
+            i += 2;
+        } else {
+            result.push_back(text[i]);
+        }
+    }
+    return result;
+}
+
+std::string HttpRequest::queryParam(const std::string& name, const std::string& defaultValue) const {
+    size_t pos = 0;
+    while (pos <= query.size()) {
+        size_t end = query.find('&', pos);
+        if (end == std::string::npos) end = query.size();
+
+        size_t eq = query.find('=', pos);
+        std::string key = urlDecode(query.substr(pos, (eq < end ? eq : end) - pos));
+        if (key == name) {
+            return eq < end ? urlDecode(query.substr(eq + 1, end - eq - 1)) : "";
+        }
+        pos = end + 1;
+    }
+    return defaultValue;
+}
+
+std::string HttpRequest::header(const std::string& name) const {
+    auto it = headers.find(toLower(name));
+    return it != headers.end() ? it->second : "";
+}
+
+const char* httpStatusText(int status) {
+    switch (status) {
+        case 101: return "Switching Protocols";
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 413: return "Payload Too Large";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default: return "Unknown";
+    }
+}
+
+HttpServer::HttpServer() : listenFd(-1), epollFd(-1), running(false) {
+}
+
+HttpServer::~HttpServer() {
+    stop();
+}
+
+void HttpServer::route(const std::string& path, HttpHandler handler) {
+    std::lock_guard<std::mutex> lock(routeMutex);
+    routes[path] = std::move(handler);
+}
+
+void HttpServer::upgrade(const std::string& path, HttpUpgradeHandler handler) {
+    std::lock_guard<std::mutex> lock(routeMutex);
+    upgradeRoutes[path] = std::move(handler);
+}
+
+bool HttpServer::start(const std::string& addressText) {
+    if (running) return false;
+
+    if (!parseSocketAddress(addressText, address)) {
+        std::cerr << "Invalid HTTP address: " << addressText << std::endl;
+        return false;
+    }
+
+    listenFd = listenSocket(address);
+    if (listenFd < 0) {
+        return false;
+    }
+    setNonBlocking(listenFd);
+
+    epollFd = epoll_create1(0);
+    if (epollFd < 0) {
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = listenFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+
+    running = true;
+    serverThread = std::thread(&HttpServer::serverLoop, this);
+    return true;
+}
+
+void HttpServer::stop() {
+    if (!running) return;
+
+    running = false;
+    if (serverThread.joinable()) {
+        serverThread.join();
+    }
+
+    for (auto& entry : connections) {
+        close(entry.first);
+    }
+    connections.clear();
+
+    close(epollFd);
+    close(listenFd);
+    epollFd = -1;
+    listenFd = -1;
+
+    if (address.isUnix) {
+        unlink(address.path.c_str());
+    }
+}
+
+uint16_t HttpServer::port() const {
+    return listenFd >= 0 ? boundPort(listenFd) : 0;
+}
+
+void HttpServer::serverLoop() {
+    epoll_event events[kMaxEvents];
+
+    while (running) {
+        int count = epoll_wait(epollFd, events, kMaxEvents, 200);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "epoll_wait failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        for (int i = 0; i < count; i++) {
+            int fd = events[i].data.fd;
+            if (fd == listenFd) {
+                acceptConnections();
+                continue;
+            }
+
+            auto it = connections.find(fd);
+            if (it == connections.end()) continue;
+            Connection& conn = *it->second;
+
+            bool ok = !(events[i].events & (EPOLLHUP | EPOLLERR));
+            if (ok && (events[i].events & EPOLLIN)) ok = readConnection(conn);
+            if (ok && (events[i].events & EPOLLOUT)) ok = writeConnection(conn) && processRequests(conn);
+            if (!ok) {
+                closeConnection(fd);
+            }
+        }
+    }
+}
+
+void HttpServer::acceptConnections() {
+    while (true) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            return; // EAGAIN
+        }
+        setNonBlocking(fd);
+
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            close(fd);
+            continue;
+        }
+
+        auto conn = std::make_unique<Connection>();
+        conn->fd = fd;
+        connections[fd] = std::move(conn);
+    }
+}
+
+bool HttpServer::readConnection(Connection& conn) {
+    char buffer[kReadChunk];
+    while (true) {
+        ssize_t n = recv(conn.fd, buffer, sizeof(buffer), 0);
+        if (n > 0) {
+            conn.input.append(buffer, n);
+            continue;
+        }
+        if (n == 0) return false;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        if (errno == EINTR) continue;
+        return false;
+    }
+    return processRequests(conn);
+}
+
+bool HttpServer::processRequests(Connection& conn) {
+    // 응답을 다 쓰기 전에는 다음 요청을 처리하지 않는다 (파이프라이닝 순서 보장)
+    while (conn.outputPos == conn.output.size() && !conn.stream && !conn.closeAfterWrite) {
+        size_t headerEnd = conn.input.find("\r\n\r\n");
+        if (headerEnd == std::string::npos) {
+            return conn.input.size() <= kMaxHeaderBytes;
+        }
+
+        HttpRequest request;
+        HttpResponse response;
+        size_t lineEnd = conn.input.find("\r\n");
+        std::string requestLine = conn.input.substr(0, lineEnd);
+        size_t sp1 = requestLine.find(' ');
+        size_t sp2 = requestLine.find(' ', sp1 + 1);
+        if (sp1 == std::string::npos || sp2 == std::string::npos) {
+            return false;
+        }
+        request.method = requestLine.substr(0, sp1);
+        std::string target = requestLine.substr(sp1 + 1, sp2 - sp1 - 1);
+        std::string version = requestLine.substr(sp2 + 1);
+        size_t question = target.find('?');
+        request.path = target.substr(0, question);
+        if (question != std::string::npos) {
+            request.query = target.substr(question + 1);
+        }
+
+        size_t pos = lineEnd + 2;
+        while (pos < headerEnd) {
+            size_t end = conn.input.find("\r\n", pos);
+            size_t colon = conn.input.find(':', pos);
+            if (colon != std::string::npos && colon < end) {
+                request.headers[toLower(conn.input.substr(pos, colon - pos))] =
+                    trim(conn.input.substr(colon + 1, end - colon - 1));
+            }
+            pos = end + 2;
+        }
+
+        size_t contentLength = 0;
+        std::string lengthHeader = request.header("content-length");
+        if (!lengthHeader.empty()) {
+            contentLength = std::strtoull(lengthHeader.c_str(), nullptr, 10);
+            if (contentLength > kMaxBodyBytes) return false;
+        }
+        size_t requestSize = headerEnd + 4 + contentLength;
+        if (conn.input.size() < requestSize) {
+            return true; // 본문 대기
+        }
+        request.body = conn.input.substr(headerEnd + 4, contentLength);
+        conn.input.erase(0, requestSize);
+
+        if (!request.header("upgrade").empty()) {
+            HttpUpgradeHandler upgradeHandler;
+            {
+                std::lock_guard<std::mutex> lock(routeMutex);
+                auto it = upgradeRoutes.find(request.path);
+                if (it != upgradeRoutes.end()) upgradeHandler = it->second;
+            }
+            if (upgradeHandler) {
+                // 이 서버의 epoll에서 빼고 소켓을 넘긴다. false를 반환해 연결 상태만 정리한다
+                epoll_ctl(epollFd, EPOLL_CTL_DEL, conn.fd, nullptr);
+                conn.detached = upgradeHandler(request, conn.fd, conn.input);
+                return false;
+            }
+        }
+
+        dispatch(request, response);
+
+        std::string connectionHeader = toLower(request.header("connection"));
+        conn.closeAfterWrite = connectionHeader == "close" ||
+                               (version == "HTTP/1.0" && connectionHeader != "keep-alive");
+
+        conn.output.clear();
+        conn.outputPos = 0;
+        conn.output.reserve(response.body.size() + 256);
+        conn.output += "HTTP/1.1 " + std::to_string(response.status) + " " + httpStatusText(response.status) + "\r\n";
+        conn.output += "Content-Type: " + response.contentType + "\r\n";
+        if (response.stream) {
+            conn.output += "Transfer-Encoding: chunked\r\n";
+            conn.stream = std::move(response.stream);
+        } else {
+            conn.output += "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+        }
+        for (const auto& header : response.headers) {
+            conn.output += header.first + ": " + header.second + "\r\n";
+        }
+        if (conn.closeAfterWrite) {
+            conn.output += "Connection: close\r\n";
+        }
+        conn.output += "\r\n";
+        conn.output += response.body;
+
+        if (!writeConnection(conn)) return false;
+    }
+    return true;
+}
+
+void HttpServer::dispatch(const HttpRequest& request, HttpResponse& response) {
+    HttpHandler handler;
+    {
+        std::lock_guard<std::mutex> lock(routeMutex);
+        auto it = routes.find(request.path);
+        if (it != routes.end()) handler = it->second;
+    }
+
+    if (!handler) {
+        response.status = 404;
+        response.body = "not found\n";
+        return;
+    }
+    handler(request, response);
+}
+
+bool HttpServer::writeConnection(Connection& conn) {
+    // 이전 출력을 다 보냈으면 스트림에서 다음 조각 하나를 만든다 (나머지는 다음 EPOLLOUT에서)
+    if (conn.outputPos == conn.output.size() && conn.stream) {
+        conn.chunk.clear();
+        bool more = conn.stream(conn.chunk);
+        conn.output.clear();
+        conn.outputPos = 0;
+        if (!conn.chunk.empty()) {
+            char size[24];
+            std::snprintf(size, sizeof(size), "%zx\r\n", conn.chunk.size());
+            conn.output += size;
+            conn.output += conn.chunk;
+            conn.output += "\r\n";
+        }
+        if (!more) {
+            conn.output += "0\r\n\r\n";
+            conn.stream = nullptr;
+        }
+    }
+
+    while (conn.outputPos < conn.output.size()) {
+        ssize_t n = send(conn.fd, conn.output.data() + conn.outputPos, conn.output.size() - conn.outputPos,
+                         MSG_NOSIGNAL);
+        if (n > 0) {
+            conn.outputPos += n;
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        if (n < 0 && errno == EINTR) continue;
+        return false;
+    }
+
+    bool done = conn.outputPos == conn.output.size() && !conn.stream;
+    if (done) {
+        conn.output.clear();
+        conn.outputPos = 0;
+        if (conn.closeAfterWrite) return false;
+    }
+    updateEvents(conn);
+    return true;
+}
+
+void HttpServer::updateEvents(Connection& conn) {
+    epoll_event event = {};
+    event.events = conn.outputPos < conn.output.size() || conn.stream ? EPOLLIN | EPOLLOUT : EPOLLIN;
+    event.data.fd = conn.fd;
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, conn.fd, &event);
+}
+
+void HttpServer::closeConnection(int fd) {
+    auto it = connections.find(fd);
+    if (it != connections.end() && !it->second->detached) {
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+        close(fd);
+    }
+    connections.erase(fd);
+}
+
+bool parseHttpUrl(const std::string& url, HttpUrl& result) {
+    const std::string prefix = "http://";
+    if (url.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+
+    size_t slash = url.find('/', prefix.size());
+    std::string hostPort = url.substr(prefix.size(), slash == std::string::npos ? std::string::npos
+                                                                                 : slash - prefix.size());
+    result.target = slash == std::string::npos ? "/" : url.substr(slash);
+    result.host = hostPort;
+    if (hostPort.find(':') == std::string::npos) {
+        hostPort += ":80";
+    }
+    return parseSocketAddress("tcp://" + hostPort, result.address);
+}
+
+HttpClient::HttpClient(const HttpUrl& url, int timeoutMs) : url(url), timeoutMs(timeoutMs), fd(-1) {
+}
+
+HttpClient::~HttpClient() {
+    close();
+}
+
+void HttpClient::close() {
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+    input.clear();
+}
+
+bool HttpClient::ensureConnected() {
+    if (fd >= 0) return true;
+
+    fd = connectSocket(url.address);
+    if (fd < 0) return false;
+
+    timeval timeout;
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_usec = (timeoutMs % 1000) * 1000;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    return true;
+}
+
+bool HttpClient::request(const std::string& method, const std::vector<std::pair<std::string, std::string>>& headers,
+                         const void* body, size_t bodySize, HttpClientResponse& response) {
+    // 서버가 이미 닫은 keep-alive 연결에는 보내지 않는다
+    if (fd >= 0 && peerClosed(fd)) close();
+    bool reused = fd >= 0;
+    bool requestSent = false;
+    if (exchange(method, headers, body, bodySize, response, requestSent)) {
+        return true;
+    }
+    close();
+
+    // 요청이 한 바이트도 나가지 않았을 때만 새 연결로 한 번 더 (나갔으면 서버가 처리했을 수 있다: POST 중복)
+    if (reused && !requestSent) {
+        return exchange(method, headers, body, bodySize, response, requestSent) || (close(), false);
+    }
+    return false;
+}
+
+bool HttpClient::exchange(const std::string& method, const std::vector<std::pair<std::string, std::string>>& headers,
+                          const void* body, size_t bodySize, HttpClientResponse& response, bool& requestSent) {
+    if (!ensureConnected()) return false;
+
+    header.clear();
+    header += method + " " + url.target + " HTTP/1.1\r\n";
+    header += "Host: " + url.host + "\r\n";
+    header += "Content-Length: " + std::to_string(bodySize) + "\r\n";
+    for (const auto& entry : headers) {
+        header += entry.first + ": " + entry.second + "\r\n";
+    }
+    header += "\r\n";
+
+    size_t written = 0;
+    bool sent = sendAll(fd, reinterpret_cast<const uint8_t*>(header.data()), header.size(), &written);
+    requestSent = written > 0;
+    if (!sent || (bodySize > 0 && !sendAll(fd, static_cast<const uint8_t*>(body), bodySize))) {
+        return false;
+    }
+
+    // 응답 헤더
+    input.clear();
+    size_t headerEnd;
+    char buffer[kReadChunk];
+    while ((headerEnd = input.find("\r\n\r\n")) == std::string::npos) {
+        ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) continue;
+            return false;
+        }
+        input.append(buffer, n);
+        if (input.size() > kMaxHeaderBytes) return false;
+    }
+
+    size_t space = input.find(' ');
+    if (space == std::string::npos || space > headerEnd) return false;
+    response.status = std::atoi(input.c_str() + space + 1);
+
+    std::string lowerHeaders = toLower(input.substr(0, headerEnd));
+    bool closeConnection = lowerHeaders.find("\r\nconnection: close") != std::string::npos;
+    size_t contentLength = 0;
+    bool hasLength = false;
+    size_t lengthPos = lowerHeaders.find("\r\ncontent-length:");
+    if (lengthPos != std::string::npos) {
+        contentLength = std::strtoull(lowerHeaders.c_str() + lengthPos + 17, nullptr, 10);
+        hasLength = true;
+    }
+    if (response.status == 204 || response.status == 304) {
+        hasLength = true;
+        contentLength = 0;
+    }
+    if (contentLength > kMaxBodyBytes) return false;
+
+    // 본문 (길이가 없으면 연결이 닫힐 때까지)
+    response.body = input.substr(headerEnd + 4);
+    while (!hasLength || response.body.size() < contentLength) {
+        ssize_t n = recv(fd, buffer, sizeof(buffer), 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            if (hasLength) return false;
+            closeConnection = true;
+            break;
+        }
+        response.body.append(buffer, n);
+        if (response.body.size() > kMaxBodyBytes) return false;
+    }
+    if (hasLength) {
+        response.body.resize(contentLength);
+    }
+
+    if (closeConnection) {
+        close();
+    }
+    return true;
+}
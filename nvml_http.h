@@ -0,0 +1,139 @@
+#ifndef NVML_HTTP_H
+#define NVML_HTTP_H
+
+#include "nvml_socket.h"
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// HTTP 요청 (헤더 이름은 소문자로 정규화)
+struct HttpRequest {
+    std::string method;
+    std::string path;
+    std::string query;
+    std::map<std::string, std::string> headers;
+    std::string body;
+
+    // 쿼리 파라미터 (퍼센트 디코딩, 없으면 defaultValue)
+    std::string queryParam(const std::string& name, const std::string& defaultValue = "") const;
+    std::string header(const std::string& name) const;
+};
+
+// 스트리밍 본문 생성기: 호출마다 다음 조각을 out에 덧붙이고, 마지막 조각이면 false
+using HttpBodyStream = std::function<bool(std::string& out)>;
+
+struct HttpResponse {
+    int status = 200;
+    std::string contentType = "text/plain; charset=utf-8";
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string body;
+    HttpBodyStream stream; // 설정되면 body 대신 chunked 전송 (소켓이 쓰기 가능할 때마다 한 조각)
+};
+
+using HttpHandler = std::function<void(const HttpRequest&, HttpResponse&)>;
+
+// 프로토콜 업그레이드 핸들러 (WebSocket 등). 소켓 소유권과 아직 처리하지 않은 입력을 넘겨받는다
+// false를 반환하면 서버가 소켓을 닫는다
+using HttpUpgradeHandler = std::function<bool(const HttpRequest&, int fd, const std::string& pendingInput)>;
+
+// 최소 HTTP/1.1 서버 (epoll 단일 스레드, keep-alive 지원)
+// 핸들러는 서버 스레드에서 호출되므로 오래 걸리는 작업을 하면 안 된다
+class HttpServer {
+private:
+    struct Connection {
+        int fd;
+        std::string input;
+        std::string output;
+        size_t outputPos = 0;
+        bool closeAfterWrite = false;
+        bool detached = false; // 업그레이드 핸들러로 넘어간 소켓
+        HttpBodyStream stream;
+        std::string chunk;
+    };
+
+    SocketAddress address;
+    int listenFd;
+    int epollFd;
+    std::atomic<bool> running;
+    std::thread serverThread;
+    std::unordered_map<int, std::unique_ptr<Connection>> connections;
+
+    std::mutex routeMutex;
+    std::map<std::string, HttpHandler> routes; // 정확한 경로 일치
+    std::map<std::string, HttpUpgradeHandler> upgradeRoutes;
+
+public:
+    HttpServer();
+    ~HttpServer();
+
+    // 시작 전후 모두 등록 가능
+    void route(const std::string& path, HttpHandler handler);
+    // "Upgrade" 헤더가 있는 요청만 전달된다
+    void upgrade(const std::string& path, HttpUpgradeHandler handler);
+
+    // "tcp://host:port" 또는 "unix:///path"
+    bool start(const std::string& addressText);
+    void stop();
+    uint16_t port() const;
+
+private:
+    void serverLoop();
+    void acceptConnections();
+    bool readConnection(Connection& conn);
+    bool writeConnection(Connection& conn);
+    bool processRequests(Connection& conn);
+    void dispatch(const HttpRequest& request, HttpResponse& response);
+    void updateEvents(Connection& conn);
+    void closeConnection(int fd);
+};
+
+// "http://host[:port]/path?query"
+struct HttpUrl {
+    SocketAddress address;
+    std::string host;   // Host 헤더
+    std::string target; // 경로 + 쿼리
+};
+
+bool parseHttpUrl(const std::string& url, HttpUrl& result);
+
+struct HttpClientResponse {
+    int status = 0;
+    std::string body;
+};
+
+// 블로킹 HTTP/1.1 클라이언트 (keep-alive 연결 재사용, 송수신 타임아웃)
+class HttpClient {
+private:
+    HttpUrl url;
+    int timeoutMs;
+    int fd;
+    std::string header;
+    std::string input;
+
+public:
+    HttpClient(const HttpUrl& url, int timeoutMs = 5000);
+    ~HttpClient();
+
+    // 요청 전송 후 응답 수신 (연결/전송/수신 실패 시 false)
+    bool request(const std::string& method, const std::vector<std::pair<std::string, std::string>>& headers,
+                 const void* body, size_t bodySize, HttpClientResponse& response);
+    void close();
+
+private:
+    bool ensureConnected();
+    bool exchange(const std::string& method, const std::vector<std::pair<std::string, std::string>>& headers,
+                  const void* body, size_t bodySize, HttpClientResponse& response, bool& requestSent);
+};
+
+const char* httpStatusText(int status);
+
+// URL 퍼센트 디코딩 ('+'는 공백)
+std::string urlDecode(const std::string& text);
+
+#endif // NVML_HTTP_H
@@ -0,0 +1,342 @@
+#include "nvml_influx.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+// "00" "01" ... "99"
+struct DigitPairs {
+    char pairs[200];
+
+    DigitPairs() {
+        for (int i = 0; i < 100; i++) {
+            pairs[i * 2] = static_cast<char>('0' + i / 10);
+            pairs[i * 2 + 1] = static_cast<char>('0' + i % 10);
+        }
+    }
+};
+
+const DigitPairs kDigits;
+
+// 한 줄의 최대 필드 길이 (이름 + '=' + 20자리 + 'i' + ',')
+const size_t kMaxFieldBytes = 48;
+
+template <size_t N>
+char* putLiteral(char* out, const char (&text)[N]) {
+    std::memcpy(out, text, N - 1);
+    return out + N - 1;
+}
+
+char* putField(char* out, const char* name, size_t nameLength, unsigned long long value) {
+    std::memcpy(out, name, nameLength);
+    out += nameLength;
+    out = formatUInt(value, out);
+    *out++ = 'i';
+    return out;
+}
+
+#define PUT_FIELD(out, literal, value) putField(out, literal, sizeof(literal) - 1, value)
+
+// 문자열 필드: 큰따옴표와 역슬래시를 이스케이프
+char* putStringField(char* out, const std::string& value) {
+    *out++ = '"';
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            *out++ = '\\';
+        }
+        *out++ = c == '\n' ? ' ' : c;
+    }
+    *out++ = '"';
+    return out;
+}
+
+unsigned long long toNanos(std::chrono::system_clock::time_point time) {
+    return static_cast<unsigned long long>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count());
+}
+
+} // namespace
+
+char* formatUInt(unsigned long long value, char* out) {
+    // 뒤에서부터 두 자리씩 채운 뒤 앞으로 복사
+    char scratch[20];
+    char* end = scratch + sizeof(scratch);
+    char* p = end;
+    while (value >= 100) {
+        unsigned int pair = static_cast<unsigned int>(value % 100) * 2;
+        value /= 100;
+        *--p = kDigits.pairs[pair + 1];
+        *--p = kDigits.pairs[pair];
+    }
+    if (value >= 10) {
+        unsigned int pair = static_cast<unsigned int>(value) * 2;
+        *--p = kDigits.pairs[pair + 1];
+        *--p = kDigits.pairs[pair];
+    } else {
+        *--p = static_cast<char>('0' + value);
+    }
+
+    size_t count = end - p;
+    std::memcpy(out, p, count);
+    return out + count;
+}
+
+LineProtocolWriter::LineProtocolWriter(const std::vector<GPUInfo>& gpus) : length(0) {
+    for (const auto& gpu : gpus) {
+        if (gpu.index >= deviceTags.size()) {
+            deviceTags.resize(gpu.index + 1);
+        }
+        std::string& tag = deviceTags[gpu.index];
+        tag = "nvml_gpu,gpu=" + std::to_string(gpu.index);
+        if (!gpu.uuid.empty()) {
+            tag += ",uuid=";
+            appendTagValue(gpu.uuid, TagSyntax::Influx, tag);
+        }
+        if (!gpu.name.empty()) {
+            tag += ",name=";
+            appendTagValue(gpu.name, TagSyntax::Influx, tag);
+        }
+        tag.push_back(' ');
+    }
+    buffer.resize(64 * 1024);
+}
+
+const std::string& LineProtocolWriter::deviceTag(unsigned int index) {
+    // 초기화 이후 나타난 디바이스는 인덱스 태그만
+    if (index >= deviceTags.size()) {
+        deviceTags.resize(index + 1);
+    }
+    if (deviceTags[index].empty()) {
+        deviceTags[index] = "nvml_gpu,gpu=" + std::to_string(index) + " ";
+    }
+    return deviceTags[index];
+}
+
+char* LineProtocolWriter::ensure(size_t bytes) {
+    if (length + bytes > buffer.size()) {
+        buffer.resize(std::max(buffer.size() * 2, length + bytes));
+    }
+    return buffer.data() + length;
+}
+
+void LineProtocolWriter::consume(size_t count) {
+    count = std::min(count, length);
+    std::memmove(buffer.data(), buffer.data() + count, length - count);
+    length -= count;
+}
+
+void LineProtocolWriter::append(const MetricsSnapshot& snapshot) {
+    char timestamp[24];
+    timestamp[0] = ' ';
+    char* timestampEnd = formatUInt(toNanos(snapshot.timestamp), timestamp + 1);
+    *timestampEnd++ = '\n';
+    size_t timestampLength = timestampEnd - timestamp;
+
+    for (const auto& m : snapshot.devices) {
+        const std::string& tag = deviceTag(m.deviceIndex);
+        char* out = ensure(tag.size() + 15 * kMaxFieldBytes + timestampLength);
+
+        std::memcpy(out, tag.data(), tag.size());
+        out += tag.size();
+        out = PUT_FIELD(out, "gpu_utilization=", m.gpuUtilization);
+        out = PUT_FIELD(out, ",memory_utilization=", m.memoryUtilization);
+        out = PUT_FIELD(out, ",encoder_utilization=", m.encoderUtilization);
+        out = PUT_FIELD(out, ",decoder_utilization=", m.decoderUtilization);
+        out = PUT_FIELD(out, ",memory_used=", m.memoryUsed);
+        out = PUT_FIELD(out, ",memory_total=", m.memoryTotal);
+        out = PUT_FIELD(out, ",temperature=", m.temperature);
+        out = PUT_FIELD(out, ",fan_speed=", m.fanSpeed);
+        out = PUT_FIELD(out, ",power_usage=", m.powerUsage);
+        out = PUT_FIELD(out, ",power_limit=", m.powerLimit);
+        out = PUT_FIELD(out, ",sm_clock=", m.smClock);
+        out = PUT_FIELD(out, ",memory_clock=", m.memoryClock);
+        out = PUT_FIELD(out, ",graphics_clock=", m.graphicsClock);
+        out = PUT_FIELD(out, ",ecc_single_bit=", m.eccSingleBit);
+        out = PUT_FIELD(out, ",ecc_double_bit=", m.eccDoubleBit);
+        std::memcpy(out, timestamp, timestampLength);
+        out += timestampLength;
+
+        length = out - buffer.data();
+    }
+
+    for (const auto& p : snapshot.processes) {
+        const std::string& name = internedString(p.nameId);
+        char* out = ensure(64 + kMaxFieldBytes * 2 + name.size() * 2 + timestampLength);
+
+        out = putLiteral(out, "nvml_process,gpu=");
+        out = formatUInt(p.deviceIndex, out);
+        out = putLiteral(out, ",pid=");
+        out = formatUInt(p.pid, out);
+        out = putLiteral(out, ",type=");
+        out = p.type == NVML_PROCESS_TYPE_COMPUTE ? putLiteral(out, "compute") : putLiteral(out, "graphics");
+        out = PUT_FIELD(out, " used_memory=", p.usedGpuMemory);
+        out = putLiteral(out, ",name=");
+        out = putStringField(out, name);
+        std::memcpy(out, timestamp, timestampLength);
+        out += timestampLength;
+
+        length = out - buffer.data();
+    }
+}
+
+InfluxSink::InfluxSink(const InfluxConfig& config, const std::vector<GPUInfo>& gpus)
+    : config(config), writer(gpus), lastFlush(std::chrono::steady_clock::now()), stats() {
+    this->config.maxBatchBytes = std::max<size_t>(this->config.maxBatchBytes, 4096);
+#ifdef NVML_HAVE_ZLIB
+    deflaterReady = false;
+#endif
+}
+
+InfluxSink::~InfluxSink() {
+    close();
+#ifdef NVML_HAVE_ZLIB
+    if (deflaterReady) {
+        deflateEnd(&deflater);
+    }
+#endif
+}
+
+bool InfluxSink::open() {
+    if (client) return true;
+
+    if (!parseHttpUrl(config.url, url)) {
+        std::cerr << "Invalid InfluxDB URL: " << config.url << std::endl;
+        return false;
+    }
+    client = std::make_unique<HttpClient>(url, config.timeoutMs);
+
+    headers.clear();
+    headers.emplace_back("Content-Type", "text/plain; charset=utf-8");
+    if (!config.token.empty()) {
+        headers.emplace_back("Authorization", "Token " + config.token);
+    }
+
+    if (config.gzip) {
+#ifdef NVML_HAVE_ZLIB
+        // windowBits 15 + 16: gzip 헤더. 반복이 많은 텍스트라 레벨 1로도 충분히 줄어든다
+        // 스트림은 요청마다 reset해서 재사용
+        std::memset(&deflater, 0, sizeof(deflater));
+        if (deflateInit2(&deflater, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK) {
+            deflaterReady = true;
+            headers.emplace_back("Content-Encoding", "gzip");
+        } else {
+            std::cerr << "Failed to initialize gzip, sending uncompressed" << std::endl;
+        }
+#else
+        std::cerr << "Built without zlib, sending InfluxDB writes uncompressed" << std::endl;
+#endif
+    }
+    return true;
+}
+
+void InfluxSink::close() {
+    // 종료 시 남은 줄을 한 번 보낸다
+    if (client) {
+        flush();
+        client->close();
+    }
+}
+
+bool InfluxSink::exportBatch(const std::vector<SnapshotPtr>& batch) {
+    if (!client && !open()) return false;
+
+    // 재시도로 같은 배치가 다시 오면 이미 포맷한 스냅샷은 건너뛴다
+    for (const auto& snapshot : batch) {
+        if (snapshot->timestamp <= lastFormatted) continue;
+        lastFormatted = snapshot->timestamp;
+
+        std::lock_guard<std::mutex> lock(statsMutex);
+        if (writer.size() >= config.maxBufferBytes) {
+            stats.snapshotsDropped++;
+            continue;
+        }
+        size_t before = writer.size();
+        writer.append(*snapshot);
+        stats.snapshotsFormatted++;
+        stats.bytesFormatted += writer.size() - before;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (writer.size() < config.maxBatchBytes && now - lastFlush < std::chrono::milliseconds(config.flushIntervalMs)) {
+        return true;
+    }
+    return flush();
+}
+
+bool InfluxSink::flush() {
+    while (!writer.empty()) {
+        // 줄 경계에서 자른다
+        size_t size = writer.size();
+        if (size > config.maxBatchBytes) {
+            const char* data = writer.data();
+            size_t cut = config.maxBatchBytes;
+            while (cut > 0 && data[cut - 1] != '\n') cut--;
+            if (cut == 0) {
+                // 한 줄이 maxBatchBytes보다 길면 그 줄만 보낸다
+                cut = static_cast<const char*>(std::memchr(data, '\n', size)) - data + 1;
+            }
+            size = cut;
+        }
+
+        if (!post(writer.data(), size)) {
+            return false;
+        }
+        writer.consume(size);
+    }
+    lastFlush = std::chrono::steady_clock::now();
+    return true;
+}
+
+bool InfluxSink::post(const char* body, size_t size) {
+    const void* payload = body;
+    size_t payloadSize = size;
+
+#ifdef NVML_HAVE_ZLIB
+    if (deflaterReady) {
+        compressed.resize(deflateBound(&deflater, size));
+        deflater.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(body));
+        deflater.avail_in = static_cast<uInt>(size);
+        deflater.next_out = compressed.data();
+        deflater.avail_out = static_cast<uInt>(compressed.size());
+        int result = deflate(&deflater, Z_FINISH);
+        payloadSize = compressed.size() - deflater.avail_out;
+        deflateReset(&deflater);
+        if (result != Z_STREAM_END) {
+            std::cerr << "gzip compression failed" << std::endl;
+            return false;
+        }
+        payload = compressed.data();
+    }
+#endif
+
+    HttpClientResponse response;
+    bool sent = client->request("POST", headers, payload, payloadSize, response);
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    stats.requests++;
+    if (!sent) {
+        stats.failures++;
+        std::cerr << "InfluxDB write to " << config.url << " failed" << std::endl;
+        return false;
+    }
+    if (response.status >= 200 && response.status < 300) {
+        stats.bytesSent += payloadSize;
+        return true;
+    }
+
+    stats.failures++;
+    std::cerr << "InfluxDB write returned " << response.status << ": " << response.body.substr(0, 200) << std::endl;
+    if (response.status >= 400 && response.status < 500 && response.status != 429) {
+        // 다시 보내도 같은 결과이므로 버린다 (잘못된 토큰/버킷 등)
+        stats.linesRejected += std::count(body, body + size, '\n');
+        return true;
+    }
+    return false;
+}
+
+InfluxStats InfluxSink::getStats() {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return stats;
+}
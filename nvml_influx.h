@@ -0,0 +1,102 @@
+#ifndef NVML_INFLUX_H
+#define NVML_INFLUX_H
+
+#include "nvml_exporter.h"
+#include "nvml_http.h"
+#include <mutex>
+#include <vector>
+
+#ifdef NVML_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+// 부호 없는 정수를 10진수로 out에 쓰고 끝 위치를 반환 (out은 20바이트 이상)
+char* formatUInt(unsigned long long value, char* out);
+
+// InfluxDB 라인 프로토콜 포맷터
+// 태그 문자열은 디바이스마다 미리 이스케이프해 두고, 값은 미리 늘려 둔 버퍼에 바로 쓴다
+//   nvml_gpu,gpu=0,uuid=GPU-..,name=.. gpu_utilization=87i,...,ecc_double_bit=0i 1700000000000000000
+//   nvml_process,gpu=0,pid=1234 used_memory=1048576i,name="python" 1700000000000000000
+class LineProtocolWriter {
+private:
+    std::vector<std::string> deviceTags; // "nvml_gpu,gpu=0,uuid=...,name=... " (인덱스별)
+    std::vector<char> buffer;
+    size_t length;
+
+public:
+    explicit LineProtocolWriter(const std::vector<GPUInfo>& gpus);
+
+    void append(const MetricsSnapshot& snapshot);
+
+    const char* data() const { return buffer.data(); }
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    // 앞의 count 바이트를 버린다 (전송 완료분)
+    void consume(size_t count);
+    void clear() { length = 0; }
+
+private:
+    char* ensure(size_t bytes);
+    const std::string& deviceTag(unsigned int index);
+};
+
+struct InfluxConfig {
+    std::string url;                     // 예: http://localhost:8086/api/v2/write?org=o&bucket=b
+    std::string token;                   // Authorization: Token <token> (비어 있으면 생략)
+    size_t maxBatchBytes = 1024 * 1024;  // 요청 하나의 최대 본문 크기 (압축 전)
+    int flushIntervalMs = 10000;         // 이 시간이 지나면 크기와 관계없이 보냄
+    size_t maxBufferBytes = 64 * 1024 * 1024; // 전송 실패 중 쌓아 둘 최대 크기
+    bool gzip = true;                    // zlib이 없으면 무시
+    int timeoutMs = 5000;
+};
+
+struct InfluxStats {
+    uint64_t snapshotsFormatted;
+    uint64_t snapshotsDropped;  // 버퍼 초과
+    uint64_t linesRejected;     // 서버가 4xx로 거부해 버린 줄
+    uint64_t bytesFormatted;
+    uint64_t bytesSent;         // 압축 후
+    uint64_t requests;
+    uint64_t failures;
+};
+
+// InfluxDB /write 싱크. 스냅샷을 라인 프로토콜로 쌓아 두었다가 크기/시간 기준으로 POST한다
+// 실패하면 버퍼를 유지하고 false를 반환해 파이프라인의 백오프를 따른다
+class InfluxSink : public MetricsSink {
+private:
+    InfluxConfig config;
+    HttpUrl url;
+    std::unique_ptr<HttpClient> client;
+    LineProtocolWriter writer;
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::chrono::system_clock::time_point lastFormatted;
+    std::chrono::steady_clock::time_point lastFlush;
+
+#ifdef NVML_HAVE_ZLIB
+    z_stream deflater;
+    bool deflaterReady;
+    std::vector<unsigned char> compressed;
+#endif
+
+    std::mutex statsMutex;
+    InfluxStats stats;
+
+public:
+    InfluxSink(const InfluxConfig& config, const std::vector<GPUInfo>& gpus);
+    ~InfluxSink() override;
+
+    std::string name() const override { return "influx"; }
+    bool open() override;
+    void close() override;
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override;
+
+    InfluxStats getStats();
+
+private:
+    // 버퍼를 maxBatchBytes 단위(줄 경계)로 나눠 모두 보낸다
+    bool flush();
+    bool post(const char* body, size_t size);
+};
+
+#endif // NVML_INFLUX_H
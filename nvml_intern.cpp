@@ -0,0 +1,73 @@
+#include "nvml_intern.h"
+#include <iostream>
+
+namespace {
+
+const std::string kEmptyString;
+
+} // namespace
+
+StringInterner::StringInterner() : count(0) {
+    for (auto& chunk : chunks) {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
+    // id 0은 빈 문자열
+    std::string* first = new std::string[kChunkSize];
+    chunks[0].store(first, std::memory_order_relaxed);
+    ids.emplace(std::string_view(first[0]), kEmptyIntern);
+    count.store(1, std::memory_order_release);
+}
+
+StringInterner::~StringInterner() {
+    for (auto& chunk : chunks) {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+bool StringInterner::find(std::string_view value, InternId& id) const {
+    if (value.empty()) {
+        id = kEmptyIntern;
+        return true;
+    }
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = ids.find(value);
+    if (it == ids.end()) return false;
+    id = it->second;
+    return true;
+}
+
+InternId StringInterner::intern(std::string_view value) {
+    InternId id;
+    if (find(value, id)) return id;
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = ids.find(value);   // 잠금을 바꾸는 사이 다른 스레드가 넣었을 수 있다
+    if (it != ids.end()) return it->second;
+
+    id = count.load(std::memory_order_relaxed);
+    unsigned int chunkIndex = id >> kChunkBits;
+    if (chunkIndex >= kMaxChunks) {
+        std::cerr << "String intern table full" << std::endl;
+        return kEmptyIntern;
+    }
+    std::string* chunk = chunks[chunkIndex].load(std::memory_order_relaxed);
+    if (!chunk) {
+        chunk = new std::string[kChunkSize];
+        chunks[chunkIndex].store(chunk, std::memory_order_release);
+    }
+    std::string& slot = chunk[id & (kChunkSize - 1)];
+    slot.assign(value.data(), value.size());
+    ids.emplace(std::string_view(slot), id);
+    count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+const std::string& StringInterner::str(InternId id) const {
+    if (id >= count.load(std::memory_order_acquire)) return kEmptyString;
+    return chunks[id >> kChunkBits].load(std::memory_order_acquire)[id & (kChunkSize - 1)];
+}
+
+StringInterner& internTable() {
+    static StringInterner table;
+    return table;
+}
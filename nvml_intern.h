@@ -0,0 +1,59 @@
+#ifndef NVML_INTERN_H
+#define NVML_INTERN_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// 인터닝된 문자열 id (프로세스 이름, UUID, 레이블). 0은 빈 문자열
+// id는 프로세스 안에서만 유효하다 (실행마다 달라지므로 파일/체크포인트에는 문자열로 쓴다)
+typedef uint32_t InternId;
+const InternId kEmptyIntern = 0;
+
+// 전역 문자열 인터닝 테이블
+// 한 번 들어간 문자열은 지우지 않으므로 종류가 한정된 문자열만 넣는다 (GPU 이름/UUID, 지표/레이블 이름,
+// 프로세스 이름). pid 같은 숫자 레이블 값은 SeriesKey가 인터닝하지 않는다. 프로세스 이름은 호스트에서
+// 실행된 서로 다른 이름 수만큼 자라며, 항목마다 문자열 하나와 해시 항목 하나를 쓴다.
+// 문자열은 고정 크기 청크에 넣어 주소가 바뀌지 않으므로 id -> 문자열 조회는 잠금 없이
+// 청크 포인터 하나를 읽는다. 문자열 -> id는 읽기 잠금으로 찾고 없을 때만 쓰기 잠금
+class StringInterner {
+private:
+    static const unsigned int kChunkBits = 10;
+    static const unsigned int kChunkSize = 1u << kChunkBits;
+    static const unsigned int kMaxChunks = 4096;   // 최대 400만 개
+
+    std::atomic<std::string*> chunks[kMaxChunks];
+    std::atomic<uint32_t> count;
+
+    mutable std::shared_mutex mutex;
+    std::unordered_map<std::string_view, InternId> ids;   // 키는 청크 안 문자열을 가리킨다
+
+public:
+    StringInterner();
+    ~StringInterner();
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    InternId intern(std::string_view value);
+    // 없으면 false (새로 넣지 않는다)
+    bool find(std::string_view value, InternId& id) const;
+    // 이 테이블이 돌려준 id만 넘긴다. 범위 밖이면 빈 문자열
+    const std::string& str(InternId id) const;
+    size_t size() const { return count.load(std::memory_order_acquire); }
+};
+
+StringInterner& internTable();
+
+inline InternId internString(std::string_view value) {
+    return internTable().intern(value);
+}
+
+inline const std::string& internedString(InternId id) {
+    return internTable().str(id);
+}
+
+#endif // NVML_INTERN_H
@@ -0,0 +1,307 @@
+#include "nvml_leak.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+const double kBytesPerMiB = 1024.0 * 1024.0;
+const double kMsPerHour = 3600.0 * 1000.0;
+const unsigned long long kMemoryNotAvailable = ~0ULL; // NVML_VALUE_NOT_AVAILABLE (WDDM 등)
+
+uint64_t trendKey(unsigned int deviceIndex, unsigned int pid) {
+    return static_cast<uint64_t>(deviceIndex) << 32 | pid;
+}
+
+} // namespace
+
+LeakDetector::LeakDetector(const LeakConfig& config) : config(config), warnings(0), expired(0) {
+    this->config.halfLifeMs = std::max<int64_t>(this->config.halfLifeMs, 1000);
+}
+
+void LeakDetector::setWarningCallback(std::function<void(const LeakReport&)> callback) {
+    std::lock_guard<std::mutex> lock(mutex);
+    warningCallback = std::move(callback);
+}
+
+void LeakDetector::Fit::advance(double dtHours, double decay) {
+    // 오래된 샘플 가중치를 줄이고, 원점을 새 샘플 시각으로 옮긴다 (x' = x - dt)
+    w *= decay;
+    sx *= decay;
+    sy *= decay;
+    sxx *= decay;
+    sxy *= decay;
+    syy *= decay;
+    sxx += -2 * dtHours * sx + dtHours * dtHours * w;
+    sxy -= dtHours * sy;
+    sx -= dtHours * w;
+}
+
+void LeakDetector::Fit::add(double y) {
+    w += 1;
+    sy += y;
+    syy += y * y;
+}
+
+bool LeakDetector::Fit::solve(double& slope, double& r2) const {
+    // 가중 최소제곱: slope = cov(x, y) / var(x), r2 = cov^2 / (var(x) var(y))
+    double varX = w * sxx - sx * sx;
+    double varY = w * syy - sy * sy;
+    double cov = w * sxy - sx * sy;
+    slope = 0;
+    r2 = 0;
+    if (varX <= 1e-12) return false;
+    slope = cov / varX;
+    if (varY > 1e-12) r2 = std::min(1.0, cov * cov / (varX * varY));
+    return true;
+}
+
+void LeakDetector::observe(Trend& trend, int64_t timestampMs, unsigned long long value) {
+    int64_t elapsed = std::max<int64_t>(timestampMs - trend.lastSeen, 0);
+    if (elapsed > 0) {
+        trend.fit.advance(elapsed / kMsPerHour, std::exp2(-static_cast<double>(elapsed) / config.halfLifeMs));
+    }
+    trend.fit.add(value / kBytesPerMiB - trend.baseMiB);
+    if (value > trend.highWater) {
+        trend.highWater = value;
+        trend.highWaterMs = timestampMs;
+    }
+    trend.lastSeen = std::max(trend.lastSeen, timestampMs);
+    trend.lastValue = value;
+}
+
+void LeakDetector::add(const MetricsSnapshot& snapshot) {
+    int64_t ts = std::chrono::duration_cast<std::chrono::milliseconds>(snapshot.timestamp.time_since_epoch()).count();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    deviceFree.assign(deviceFree.size(), -1);
+    for (const auto& m : snapshot.devices) {
+        if (m.deviceIndex >= deviceFree.size()) deviceFree.resize(m.deviceIndex + 1, -1);
+        deviceFree[m.deviceIndex] = m.memoryTotal > m.memoryUsed ? static_cast<double>(m.memoryTotal - m.memoryUsed) : 0;
+    }
+
+    for (const auto& p : snapshot.processes) {
+        if (p.usedGpuMemory == kMemoryNotAvailable) continue;
+        auto it = trends.find(trendKey(p.deviceIndex, p.pid));
+        if (it != trends.end() && it->second.name != p.nameId) {
+            trends.erase(it); // PID 재사용
+            it = trends.end();
+        }
+        if (it == trends.end()) {
+            Trend trend{};
+            trend.name = p.nameId;
+            trend.firstSeen = ts;
+            trend.lastSeen = ts;
+            trend.baseMiB = p.usedGpuMemory / kBytesPerMiB;
+            trend.highWater = p.usedGpuMemory;
+            trend.highWaterMs = ts;
+            it = trends.emplace(trendKey(p.deviceIndex, p.pid), std::move(trend)).first;
+        }
+        observe(it->second, ts, p.usedGpuMemory);
+    }
+
+    // 만료, 디바이스별 증가 속도 합
+    deviceGrowth.assign(deviceFree.size(), 0);
+    for (auto it = trends.begin(); it != trends.end();) {
+        if (it->second.lastSeen < ts - config.expiryMs) {
+            it = trends.erase(it);
+            expired++;
+            continue;
+        }
+        LeakReport report = makeReport(it->first, it->second);
+        if (report.growing && report.deviceIndex < deviceGrowth.size()) {
+            deviceGrowth[report.deviceIndex] += report.growthBytesPerHour;
+        }
+        ++it;
+    }
+
+    pending.clear();
+    for (auto& entry : trends) {
+        Trend& trend = entry.second;
+        if (trend.lastSeen != ts) continue;
+        LeakReport report = makeReport(entry.first, trend);
+        bool warn = report.growing && report.exhaustionMs >= 0 && report.exhaustionMs <= config.warnHorizonMs;
+        if (warn && !trend.warned) {
+            trend.warned = true;
+            warnings++;
+            pending.push_back(std::move(report));
+        } else if (trend.warned && (report.growthBytesPerHour < config.minGrowthBytesPerHour / 2 ||
+                                    report.r2 < config.minR2 / 2 || report.exhaustionMs > 2 * config.warnHorizonMs)) {
+            // 판정 경계에서 경고가 반복되지 않도록 기준보다 확실히 멀어졌을 때만 다시 무장한다
+            trend.warned = false;
+        }
+    }
+
+    if (pending.empty() || !warningCallback) return;
+    std::vector<LeakReport> fired;
+    fired.swap(pending);
+    auto callback = warningCallback;
+    lock.unlock();
+    for (const auto& report : fired) {
+        callback(report);
+    }
+    lock.lock();
+    pending.swap(fired);
+}
+
+LeakReport LeakDetector::makeReport(uint64_t key, const Trend& trend) const {
+    LeakReport report;
+    report.deviceIndex = static_cast<unsigned int>(key >> 32);
+    report.pid = static_cast<unsigned int>(key & 0xFFFFFFFF);
+    report.name = internedString(trend.name);
+    report.usedGpuMemory = trend.lastValue;
+    report.observedMs = trend.lastSeen - trend.firstSeen;
+    report.exhaustionMs = -1;
+
+    report.highWaterAgeMs = trend.lastSeen - trend.highWaterMs;
+
+    double slope;
+    trend.fit.solve(slope, report.r2);
+    report.growthBytesPerHour = slope * kBytesPerMiB;
+    report.growing = report.observedMs >= config.minObservationMs &&
+                     report.growthBytesPerHour >= config.minGrowthBytesPerHour && report.r2 >= config.minR2 &&
+                     report.highWaterAgeMs <= config.maxHighWaterAgeMs;
+    if (report.growing && report.deviceIndex < deviceFree.size() && deviceFree[report.deviceIndex] >= 0) {
+        double growth = report.deviceIndex < deviceGrowth.size() ? deviceGrowth[report.deviceIndex] : 0;
+        growth = std::max(growth, report.growthBytesPerHour);
+        report.exhaustionMs = static_cast<int64_t>(deviceFree[report.deviceIndex] / growth * kMsPerHour);
+    }
+    return report;
+}
+
+std::vector<LeakReport> LeakDetector::report(bool growingOnly) const {
+    std::vector<LeakReport> reports;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& entry : trends) {
+            LeakReport report = makeReport(entry.first, entry.second);
+            if (!growingOnly || report.growing) reports.push_back(std::move(report));
+        }
+    }
+    std::sort(reports.begin(), reports.end(), [](const LeakReport& a, const LeakReport& b) {
+        if ((a.exhaustionMs >= 0) != (b.exhaustionMs >= 0)) return a.exhaustionMs >= 0;
+        if (a.exhaustionMs != b.exhaustionMs) return a.exhaustionMs < b.exhaustionMs;
+        return a.growthBytesPerHour > b.growthBytesPerHour;
+    });
+    return reports;
+}
+
+LeakStats LeakDetector::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    LeakStats stats{};
+    stats.tracked = trends.size();
+    for (const auto& entry : trends) {
+        if (makeReport(entry.first, entry.second).growing) stats.growing++;
+    }
+    stats.warnings = warnings;
+    stats.expired = expired;
+    return stats;
+}
+
+std::vector<double> LeakDetector::deviceGrowthRates() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return deviceGrowth;
+}
+
+void LeakDetector::saveCheckpoint(CheckpointWriter& writer) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    writer.put<uint32_t>(static_cast<uint32_t>(trends.size()));
+    for (const auto& entry : trends) {
+        const Trend& trend = entry.second;
+        writer.put<uint64_t>(entry.first);
+        writer.putString(internedString(trend.name));
+        writer.put<int64_t>(trend.firstSeen);
+        writer.put<int64_t>(trend.lastSeen);
+        writer.put<uint64_t>(trend.lastValue);
+        writer.put<double>(trend.baseMiB);
+        writer.put<uint64_t>(trend.highWater);
+        writer.put<int64_t>(trend.highWaterMs);
+        writer.put<double>(trend.fit.w);
+        writer.put<double>(trend.fit.sx);
+        writer.put<double>(trend.fit.sy);
+        writer.put<double>(trend.fit.sxx);
+        writer.put<double>(trend.fit.sxy);
+        writer.put<double>(trend.fit.syy);
+        writer.put<uint8_t>(trend.warned ? 1 : 0);
+    }
+}
+
+bool LeakDetector::restoreCheckpoint(CheckpointReader& reader) {
+    uint32_t count = reader.get<uint32_t>();
+    if (!reader.good()) return false;
+
+    std::unordered_map<uint64_t, Trend> restored;
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t key = reader.get<uint64_t>();
+        Trend trend;
+        trend.name = internString(reader.getString());
+        trend.firstSeen = reader.get<int64_t>();
+        trend.lastSeen = reader.get<int64_t>();
+        trend.lastValue = reader.get<uint64_t>();
+        trend.baseMiB = reader.get<double>();
+        trend.highWater = reader.get<uint64_t>();
+        trend.highWaterMs = reader.get<int64_t>();
+        trend.fit.w = reader.get<double>();
+        trend.fit.sx = reader.get<double>();
+        trend.fit.sy = reader.get<double>();
+        trend.fit.sxx = reader.get<double>();
+        trend.fit.sxy = reader.get<double>();
+        trend.fit.syy = reader.get<double>();
+        trend.warned = reader.get<uint8_t>() != 0;
+        if (!reader.good()) return false;
+        restored[key] = std::move(trend);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    trends = std::move(restored);
+    return true;
+}
+
+void registerLeakApi(HttpServer& server, const LeakDetector& detector, const std::string& path) {
+    server.route(path, [&detector](const HttpRequest& request, HttpResponse& response) {
+        bool all = request.queryParam("all") == "1";
+        LeakStats stats = detector.getStats();
+
+        std::string& out = response.body;
+        out = "{\"tracked\":";
+        appendNumber(static_cast<double>(stats.tracked), out);
+        out += ",\"growing\":";
+        appendNumber(static_cast<double>(stats.growing), out);
+        out += ",\"warnings\":";
+        appendNumber(static_cast<double>(stats.warnings), out);
+        out += ",\"processes\":[";
+        bool first = true;
+        for (const auto& report : detector.report(!all)) {
+            if (!first) out.push_back(',');
+            first = false;
+            out += "{\"gpu\":";
+            appendNumber(report.deviceIndex, out);
+            out += ",\"pid\":";
+            appendNumber(report.pid, out);
+            out += ",\"name\":";
+            appendJsonString(report.name, out);
+            out += ",\"memory\":";
+            appendNumber(static_cast<double>(report.usedGpuMemory), out);
+            out += ",\"growthBytesPerHour\":";
+            appendNumber(std::round(report.growthBytesPerHour), out);
+            out += ",\"r2\":";
+            appendNumber(report.r2, out, 6);
+            out += ",\"highWaterAgeSeconds\":";
+            appendNumber(static_cast<double>(report.highWaterAgeMs / 1000), out);
+            out += ",\"observedSeconds\":";
+            appendNumber(static_cast<double>(report.observedMs / 1000), out);
+            out += ",\"growing\":";
+            out += report.growing ? "true" : "false";
+            out += ",\"exhaustionSeconds\":";
+            if (report.exhaustionMs >= 0) {
+                appendNumber(static_cast<double>(report.exhaustionMs / 1000), out);
+            } else {
+                out += "null";
+            }
+            out.push_back('}');
+        }
+        out += "]}\n";
+        response.contentType = "application/json";
+    });
+}
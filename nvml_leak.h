@@ -0,0 +1,121 @@
+#ifndef NVML_LEAK_H
+#define NVML_LEAK_H
+
+#include "nvml_history.h"
+#include <functional>
+
+struct LeakConfig {
+    int64_t halfLifeMs = 60 * 60 * 1000;         // 회귀 가중치 반감기 (오래된 샘플일수록 덜 반영)
+    int64_t minObservationMs = 30 * 60 * 1000;   // 이보다 짧게 본 프로세스는 판정하지 않는다
+    double minGrowthBytesPerHour = 16.0 * 1024 * 1024;
+    double minR2 = 0.7;                          // 증가가 꾸준해야 한다
+    int64_t maxHighWaterAgeMs = 15 * 60 * 1000;  // 이 안에 최고치를 새로 갱신해야 아직 증가 중 (계단식 할당 한 번은 제외)
+    int64_t warnHorizonMs = 12 * 60 * 60 * 1000; // 디바이스 메모리 소진 예상이 이 안이면 경고
+    int64_t expiryMs = 2 * 60 * 1000;            // 이만큼 안 보인 프로세스는 잊는다
+};
+
+// 프로세스 하나의 추세
+struct LeakReport {
+    unsigned int deviceIndex;
+    unsigned int pid;
+    std::string name;
+    unsigned long long usedGpuMemory;   // 마지막 샘플
+    double growthBytesPerHour;          // 감쇠 가중 회귀 기울기
+    int64_t highWaterAgeMs;             // 최고치를 마지막으로 갱신한 뒤 지난 시간
+    double r2;
+    int64_t observedMs;
+    bool growing;                       // 꾸준한 증가로 판정
+    // 디바이스 메모리 소진까지 남은 시간 (같은 디바이스에서 증가 중인 프로세스들의 기울기 합 기준, -1이면 해당 없음)
+    int64_t exhaustionMs;
+};
+
+struct LeakStats {
+    size_t tracked;
+    size_t growing;
+    uint64_t warnings;
+    uint64_t expired;
+};
+
+// 프로세스별 GPU 메모리 누수 감지
+// (디바이스, PID)마다 지수 감쇠 가중 선형 회귀의 합(W, Sx, Sy, Sxx, Sxy, Syy)만 들고 있어 상태 크기가 일정하다.
+// x는 가장 최근 샘플을 0으로 하는 시간(h)이라 매 샘플 원점을 옮기고, y는 처음 본 값 기준(MiB)이다.
+// 감쇠 회귀는 계단식 할당 한 번에도 한동안 큰 기울기를 보이므로, 최고치를 계속 새로 갱신하고 있어야 누수로 본다
+class LeakDetector {
+private:
+    struct Fit {
+        double w, sx, sy, sxx, sxy, syy;
+
+        void advance(double dtHours, double decay);
+        void add(double y);
+        bool solve(double& slope, double& r2) const; // slope: MiB/h
+    };
+
+    struct Trend {
+        InternId name;
+        int64_t firstSeen;
+        int64_t lastSeen;
+        unsigned long long lastValue;
+        double baseMiB;
+        unsigned long long highWater;
+        int64_t highWaterMs;
+        Fit fit;
+        bool warned;
+    };
+
+    LeakConfig config;
+    mutable std::mutex mutex;
+    std::unordered_map<uint64_t, Trend> trends;   // deviceIndex << 32 | pid
+    std::function<void(const LeakReport&)> warningCallback;
+    uint64_t warnings;
+    uint64_t expired;
+
+    // 틱마다 재사용
+    std::vector<double> deviceFree;     // bytes
+    std::vector<double> deviceGrowth;   // bytes/h
+    std::vector<LeakReport> pending;
+
+public:
+    explicit LeakDetector(const LeakConfig& config = LeakConfig());
+
+    // 경고는 프로세스마다 한 번 (증가가 멈추거나 소진 예상이 경고 범위의 두 배 밖으로 멀어지면 다시 무장)
+    void setWarningCallback(std::function<void(const LeakReport&)> callback);
+
+    void add(const MetricsSnapshot& snapshot);
+
+    // growingOnly면 증가 중으로 판정된 프로세스만. 소진 시각이 가까운 순
+    std::vector<LeakReport> report(bool growingOnly) const;
+    LeakStats getStats() const;
+    // 마지막 틱 기준 디바이스별 증가 중인 프로세스들의 기울기 합 (bytes/h)
+    std::vector<double> deviceGrowthRates() const;
+
+    // 체크포인트 (PID는 부팅 범위이므로 bootScoped 섹션으로 등록한다)
+    void saveCheckpoint(CheckpointWriter& writer) const;
+    bool restoreCheckpoint(CheckpointReader& reader);
+
+private:
+    void observe(Trend& trend, int64_t timestampMs, unsigned long long value);
+    LeakReport makeReport(uint64_t key, const Trend& trend) const;
+};
+
+// HTTP API (/api/leaks)
+//   all=1이면 추적 중인 모든 프로세스 (기본은 증가 중인 프로세스만)
+void registerLeakApi(HttpServer& server, const LeakDetector& detector, const std::string& path = "/api/leaks");
+
+// 파이프라인 싱크
+class LeakSink : public MetricsSink {
+private:
+    LeakDetector& detector;
+
+public:
+    explicit LeakSink(LeakDetector& detector) : detector(detector) {}
+
+    std::string name() const override { return "leak"; }
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override {
+        for (const auto& snapshot : batch) {
+            detector.add(*snapshot);
+        }
+        return true;
+    }
+};
+
+#endif // NVML_LEAK_H
@@ -0,0 +1,541 @@
+#include "nvml_live.h"
+#include "nvml_influx.h"
+#include "nvml_util.h"
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+const size_t kReadChunk = 4096;
+const size_t kMaxMessageBytes = 64 * 1024;
+const int kMaxEvents = 64;
+
+enum WebSocketOpcode : uint8_t {
+    WS_CONTINUATION = 0x0,
+    WS_TEXT = 0x1,
+    WS_BINARY = 0x2,
+    WS_CLOSE = 0x8,
+    WS_PING = 0x9,
+    WS_PONG = 0xA
+};
+
+// 구독 가능한 GPU 지표 (이름, 값)
+struct LiveMetric {
+    const char* name;
+    unsigned long long (*value)(const GPUMetrics&);
+};
+
+const LiveMetric kMetrics[] = {
+    {"gpu_utilization", [](const GPUMetrics& m) -> unsigned long long { return m.gpuUtilization; }},
+    {"memory_utilization", [](const GPUMetrics& m) -> unsigned long long { return m.memoryUtilization; }},
+    {"encoder_utilization", [](const GPUMetrics& m) -> unsigned long long { return m.encoderUtilization; }},
+    {"decoder_utilization", [](const GPUMetrics& m) -> unsigned long long { return m.decoderUtilization; }},
+    {"memory_used", [](const GPUMetrics& m) -> unsigned long long { return m.memoryUsed; }},
+    {"memory_total", [](const GPUMetrics& m) -> unsigned long long { return m.memoryTotal; }},
+    {"temperature", [](const GPUMetrics& m) -> unsigned long long { return m.temperature; }},
+    {"fan_speed", [](const GPUMetrics& m) -> unsigned long long { return m.fanSpeed; }},
+    {"power_usage", [](const GPUMetrics& m) -> unsigned long long { return m.powerUsage; }},
+    {"power_limit", [](const GPUMetrics& m) -> unsigned long long { return m.powerLimit; }},
+    {"sm_clock", [](const GPUMetrics& m) -> unsigned long long { return m.smClock; }},
+    {"memory_clock", [](const GPUMetrics& m) -> unsigned long long { return m.memoryClock; }},
+    {"graphics_clock", [](const GPUMetrics& m) -> unsigned long long { return m.graphicsClock; }},
+    {"ecc_single_bit", [](const GPUMetrics& m) -> unsigned long long { return m.eccSingleBit; }},
+    {"ecc_double_bit", [](const GPUMetrics& m) -> unsigned long long { return m.eccDoubleBit; }},
+};
+
+const size_t kMetricCount = sizeof(kMetrics) / sizeof(kMetrics[0]);
+
+uint32_t rotl(uint32_t value, int bits) {
+    return (value << bits) | (value >> (32 - bits));
+}
+
+// SHA-1 (핸드셰이크 전용)
+void sha1(const std::string& input, uint8_t digest[20]) {
+    uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+
+    std::string message = input;
+    uint64_t bitLength = static_cast<uint64_t>(input.size()) * 8;
+    message.push_back(static_cast<char>(0x80));
+    while (message.size() % 64 != 56) {
+        message.push_back(0);
+    }
+    for (int i = 7; i >= 0; i--) {
+        message.push_back(static_cast<char>(bitLength >> (i * 8)));
+    }
+
+    for (size_t chunk = 0; chunk < message.size(); chunk += 64) {
+        uint32_t w[80];
+        for (int i = 0; i < 16; i++) {
+            const uint8_t* p = reinterpret_cast<const uint8_t*>(message.data() + chunk + i * 4);
+            w[i] = (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+        }
+        for (int i = 16; i < 80; i++) {
+            w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+        }
+
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i = 0; i < 80; i++) {
+            uint32_t f, k;
+            if (i < 20) {
+                f = (b & c) | (~b & d);
+                k = 0x5A827999;
+            } else if (i < 40) {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1;
+            } else if (i < 60) {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDC;
+            } else {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6;
+            }
+            uint32_t temp = rotl(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = rotl(b, 30);
+            b = a;
+            a = temp;
+        }
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    }
+
+    for (int i = 0; i < 5; i++) {
+        digest[i * 4] = static_cast<uint8_t>(h[i] >> 24);
+        digest[i * 4 + 1] = static_cast<uint8_t>(h[i] >> 16);
+        digest[i * 4 + 2] = static_cast<uint8_t>(h[i] >> 8);
+        digest[i * 4 + 3] = static_cast<uint8_t>(h[i]);
+    }
+}
+
+std::string base64(const uint8_t* data, size_t size) {
+    static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string result;
+    for (size_t i = 0; i < size; i += 3) {
+        uint32_t value = uint32_t(data[i]) << 16;
+        if (i + 1 < size) value |= uint32_t(data[i + 1]) << 8;
+        if (i + 2 < size) value |= data[i + 2];
+        result.push_back(table[(value >> 18) & 0x3F]);
+        result.push_back(table[(value >> 12) & 0x3F]);
+        result.push_back(i + 1 < size ? table[(value >> 6) & 0x3F] : '=');
+        result.push_back(i + 2 < size ? table[value & 0x3F] : '=');
+    }
+    return result;
+}
+
+// 서버 -> 클라이언트 프레임 헤더 (마스크 없음)
+void appendFrameHeader(uint8_t opcode, size_t length, std::string& out) {
+    out.push_back(static_cast<char>(0x80 | opcode));
+    if (length < 126) {
+        out.push_back(static_cast<char>(length));
+    } else if (length <= 0xFFFF) {
+        out.push_back(126);
+        out.push_back(static_cast<char>(length >> 8));
+        out.push_back(static_cast<char>(length));
+    } else {
+        out.push_back(127);
+        for (int i = 7; i >= 0; i--) {
+            out.push_back(static_cast<char>(static_cast<uint64_t>(length) >> (i * 8)));
+        }
+    }
+}
+
+void appendFrame(uint8_t opcode, const std::string& payload, std::string& out) {
+    appendFrameHeader(opcode, payload.size(), out);
+    out += payload;
+}
+
+void appendUInt(unsigned long long value, std::string& out) {
+    char digits[24];
+    out.append(digits, formatUInt(value, digits) - digits);
+}
+
+} // namespace
+
+const std::vector<std::string>& liveMetricNames() {
+    static const std::vector<std::string> names = [] {
+        std::vector<std::string> result;
+        for (const auto& metric : kMetrics) result.push_back(metric.name);
+        return result;
+    }();
+    return names;
+}
+
+bool parseLiveSubscription(const std::string& query, LiveSubscription& subscription) {
+    HttpRequest request;
+    request.query = query;
+    LiveSubscription result = subscription;
+
+    std::string devices = request.queryParam("devices", "*");
+    if (devices == "*" || devices.empty()) {
+        result.deviceMask = ~0ULL;
+    } else {
+        result.deviceMask = 0;
+        for (const auto& item : splitList(devices)) {
+            char* end = nullptr;
+            unsigned long index = std::strtoul(item.c_str(), &end, 10);
+            if (*end != '\0' || index >= 64) return false;
+            result.deviceMask |= 1ULL << index;
+        }
+    }
+
+    std::string metrics = request.queryParam("metrics", "*");
+    if (metrics == "*" || metrics.empty()) {
+        result.metricMask = ~0U;
+    } else {
+        result.metricMask = 0;
+        for (const auto& item : splitList(metrics)) {
+            size_t i = 0;
+            while (i < kMetricCount && item != kMetrics[i].name) i++;
+            if (i == kMetricCount) return false;
+            result.metricMask |= 1U << i;
+        }
+    }
+
+    std::string rate = request.queryParam("rate");
+    if (!rate.empty()) {
+        char* end = nullptr;
+        double value = std::strtod(rate.c_str(), &end);
+        if (*end != '\0' || value < 0) return false;
+        result.maxRate = value;
+    }
+
+    subscription = result;
+    return true;
+}
+
+std::string webSocketAcceptKey(const std::string& clientKey) {
+    uint8_t digest[20];
+    sha1(clientKey + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11", digest);
+    return base64(digest, sizeof(digest));
+}
+
+LiveStreamHub::LiveStreamHub() : epollFd(-1), running(false), stats() {
+}
+
+LiveStreamHub::~LiveStreamHub() {
+    stop();
+}
+
+bool LiveStreamHub::start() {
+    if (running) return false;
+
+    epollFd = epoll_create1(0);
+    if (epollFd < 0) {
+        std::cerr << "epoll_create1 failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    running = true;
+    hubThread = std::thread(&LiveStreamHub::hubLoop, this);
+    return true;
+}
+
+void LiveStreamHub::stop() {
+    if (!running) return;
+
+    running = false;
+    if (hubThread.joinable()) {
+        hubThread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& entry : clients) {
+        close(entry.first);
+    }
+    clients.clear();
+    close(epollFd);
+    epollFd = -1;
+}
+
+bool LiveStreamHub::accept(const HttpRequest& request, int fd, const std::string& pendingInput) {
+    if (!running) return false;
+
+    auto client = std::make_unique<Client>();
+    client->fd = fd;
+    client->input = pendingInput;
+
+    std::string key = request.header("sec-websocket-key");
+    bool valid = request.method == "GET" && !key.empty() &&
+                 request.header("sec-websocket-version") == "13" &&
+                 parseLiveSubscription(request.query, client->subscription);
+
+    if (valid) {
+        client->control = "HTTP/1.1 101 Switching Protocols\r\n"
+                          "Upgrade: websocket\r\n"
+                          "Connection: Upgrade\r\n"
+                          "Sec-WebSocket-Accept: " + webSocketAcceptKey(key) + "\r\n\r\n";
+    } else {
+        std::string body = "invalid websocket request or subscription\n";
+        client->control = "HTTP/1.1 400 Bad Request\r\nContent-Type: text/plain\r\nContent-Length: " +
+                          std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+        client->closeAfterWrite = true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    epoll_event event = {};
+    event.events = EPOLLIN | EPOLLOUT;
+    event.data.fd = fd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+        return false;
+    }
+    client->wantWrite = true;
+    clients[fd] = std::move(client);
+    return true;
+}
+
+void LiveStreamHub::hubLoop() {
+    epoll_event events[kMaxEvents];
+
+    while (running) {
+        int count = epoll_wait(epollFd, events, kMaxEvents, 200);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "epoll_wait failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (int i = 0; i < count; i++) {
+            int fd = events[i].data.fd;
+            auto it = clients.find(fd);
+            if (it == clients.end()) continue;
+            Client& client = *it->second;
+
+            bool ok = !(events[i].events & (EPOLLHUP | EPOLLERR));
+            if (ok && (events[i].events & EPOLLIN)) ok = readClient(client);
+            if (ok && (events[i].events & EPOLLOUT)) ok = writeClient(client);
+            if (!ok) {
+                closeClient(fd);
+            }
+        }
+    }
+}
+
+bool LiveStreamHub::readClient(Client& client) {
+    char buffer[kReadChunk];
+    while (true) {
+        ssize_t n = recv(client.fd, buffer, sizeof(buffer), 0);
+        if (n > 0) {
+            client.input.append(buffer, n);
+            if (client.input.size() > kMaxMessageBytes + 14) return false;
+            continue;
+        }
+        if (n == 0) return false;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        if (errno == EINTR) continue;
+        return false;
+    }
+    return handleFrames(client) && writeClient(client);
+}
+
+bool LiveStreamHub::handleFrames(Client& client) {
+    // 핸드셰이크 실패로 닫는 중이면 입력은 무시
+    if (client.closeAfterWrite) {
+        client.input.clear();
+        return true;
+    }
+
+    while (client.input.size() >= 2) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(client.input.data());
+        bool fin = data[0] & 0x80;
+        uint8_t opcode = data[0] & 0x0F;
+        bool masked = data[1] & 0x80;
+        uint64_t length = data[1] & 0x7F;
+        size_t pos = 2;
+
+        if (length == 126) {
+            if (client.input.size() < 4) return true;
+            length = (uint64_t(data[2]) << 8) | data[3];
+            pos = 4;
+        } else if (length == 127) {
+            if (client.input.size() < 10) return true;
+            length = 0;
+            for (int i = 0; i < 8; i++) length = (length << 8) | data[2 + i];
+            pos = 10;
+        }
+
+        // 클라이언트 프레임은 반드시 마스크되어야 한다. 조각난 메시지는 지원하지 않는다
+        if (!masked || !fin || length > kMaxMessageBytes) return false;
+        if (client.input.size() < pos + 4 + length) return true;
+
+        const uint8_t* mask = data + pos;
+        std::string payload(client.input, pos + 4, length);
+        for (size_t i = 0; i < payload.size(); i++) {
+            payload[i] = static_cast<char>(payload[i] ^ mask[i % 4]);
+        }
+        client.input.erase(0, pos + 4 + length);
+
+        switch (opcode) {
+            case WS_TEXT:
+                // 구독 변경 (쿼리 문자열 형식)
+                if (!parseLiveSubscription(payload, client.subscription)) {
+                    appendFrame(WS_TEXT, "{\"error\":\"invalid subscription\"}", client.control);
+                }
+                break;
+            case WS_PING:
+                appendFrame(WS_PONG, payload, client.control);
+                break;
+            case WS_PONG:
+                break;
+            case WS_CLOSE:
+                appendFrame(WS_CLOSE, payload.substr(0, 2), client.control);
+                client.closeAfterWrite = true;
+                client.pending.reset();
+                return true;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+bool LiveStreamHub::writeClient(Client& client) {
+    while (true) {
+        const char* data;
+        size_t remaining;
+        size_t* position;
+
+        // 프레임 도중에 제어 프레임을 끼워 넣지 않는다
+        if (client.sending && client.sendPos < client.sending->size()) {
+            data = client.sending->data() + client.sendPos;
+            remaining = client.sending->size() - client.sendPos;
+            position = &client.sendPos;
+        } else if (client.controlPos < client.control.size()) {
+            client.sending.reset();
+            data = client.control.data() + client.controlPos;
+            remaining = client.control.size() - client.controlPos;
+            position = &client.controlPos;
+        } else if (client.pending && !client.closeAfterWrite) {
+            client.control.clear();
+            client.controlPos = 0;
+            client.sending = std::move(client.pending);
+            client.sendPos = 0;
+            continue;
+        } else {
+            client.sending.reset();
+            client.control.clear();
+            client.controlPos = 0;
+            if (client.closeAfterWrite) return false;
+            break;
+        }
+
+        ssize_t n = send(client.fd, data, remaining, MSG_NOSIGNAL);
+        if (n > 0) {
+            *position += n;
+            stats.bytesSent += n;
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        if (n < 0 && errno == EINTR) continue;
+        return false;
+    }
+
+    updateEvents(client);
+    return true;
+}
+
+void LiveStreamHub::updateEvents(Client& client) {
+    bool wantWrite = (client.sending && client.sendPos < client.sending->size()) ||
+                     client.controlPos < client.control.size() || client.pending;
+    if (wantWrite == client.wantWrite) return;
+
+    client.wantWrite = wantWrite;
+    epoll_event event = {};
+    event.events = wantWrite ? EPOLLIN | EPOLLOUT : EPOLLIN;
+    event.data.fd = client.fd;
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, client.fd, &event);
+}
+
+void LiveStreamHub::closeClient(int fd) {
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    clients.erase(fd);
+}
+
+void LiveStreamHub::publish(const MetricsSnapshot& snapshot) {
+    auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    shapeFrames.clear();
+
+    std::vector<int> failed;
+    for (auto& entry : clients) {
+        Client& client = *entry.second;
+        if (client.closeAfterWrite) continue;
+
+        const LiveSubscription& subscription = client.subscription;
+        if (subscription.maxRate > 0 &&
+            now - client.lastFrame < std::chrono::duration<double>(1.0 / subscription.maxRate)) {
+            continue;
+        }
+
+        // 같은 구독 형태끼리는 인코딩한 프레임을 공유한다
+        FramePtr& frame = shapeFrames[{subscription.deviceMask, subscription.metricMask}];
+        if (!frame) {
+            payload.clear();
+            encode(snapshot, subscription, payload);
+            auto encoded = std::make_shared<std::string>();
+            encoded->reserve(payload.size() + 10);
+            appendFrame(WS_TEXT, payload, *encoded);
+            frame = std::move(encoded);
+            stats.framesEncoded++;
+        }
+
+        if (client.pending) {
+            stats.framesDropped++; // 아직 보내지 못한 이전 프레임을 덮어쓴다
+        }
+        client.pending = frame;
+        client.lastFrame = now;
+        stats.framesQueued++;
+
+        if (!writeClient(client)) {
+            failed.push_back(entry.first);
+        }
+    }
+
+    for (int fd : failed) {
+        closeClient(fd);
+    }
+}
+
+void LiveStreamHub::encode(const MetricsSnapshot& snapshot, const LiveSubscription& subscription,
+                           std::string& out) {
+    out += "{\"timestamp\":";
+    appendUInt(static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                   snapshot.timestamp.time_since_epoch()).count()), out);
+    out += ",\"devices\":[";
+
+    bool first = true;
+    for (const auto& m : snapshot.devices) {
+        if (m.deviceIndex < 64 && !(subscription.deviceMask & (1ULL << m.deviceIndex))) continue;
+
+        if (!first) out.push_back(',');
+        first = false;
+        out += "{\"gpu\":";
+        appendUInt(m.deviceIndex, out);
+        for (size_t i = 0; i < kMetricCount; i++) {
+            if (!(subscription.metricMask & (1U << i))) continue;
+            out += ",\"";
+            out += kMetrics[i].name;
+            out += "\":";
+            appendUInt(kMetrics[i].value(m), out);
+        }
+        out.push_back('}');
+    }
+    out += "]}";
+}
+
+LiveStats LiveStreamHub::getStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    LiveStats result = stats;
+    result.clients = clients.size();
+    return result;
+}
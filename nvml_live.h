@@ -0,0 +1,106 @@
+#ifndef NVML_LIVE_H
+#define NVML_LIVE_H
+
+#include "nvml_exporter.h"
+#include "nvml_http.h"
+#include <map>
+#include <unordered_map>
+
+// 실시간 스트림 구독 조건
+// 업그레이드 URL 쿼리 또는 클라이언트 텍스트 메시지로 지정한다
+//   devices=0,2&metrics=gpu_utilization,temperature&rate=2
+struct LiveSubscription {
+    uint64_t deviceMask = ~0ULL; // 비트 i = GPU i (64개 초과 인덱스는 항상 포함)
+    uint32_t metricMask = ~0U;   // liveMetricNames 순서
+    double maxRate = 1.0;        // 초당 최대 프레임 수 (0이면 스냅샷마다)
+};
+
+// 쿼리 문자열 파싱. 모르는 지표 이름이나 잘못된 값이면 false (subscription은 바뀌지 않음)
+bool parseLiveSubscription(const std::string& query, LiveSubscription& subscription);
+
+// 구독할 수 있는 지표 이름 (JSON 키와 같다)
+const std::vector<std::string>& liveMetricNames();
+
+struct LiveStats {
+    size_t clients;
+    uint64_t framesEncoded;  // 구독 형태별 인코딩 횟수
+    uint64_t framesQueued;   // 클라이언트별 전달 횟수
+    uint64_t framesDropped;  // 느린 클라이언트에서 덮어쓴 중간 프레임
+    uint64_t bytesSent;
+};
+
+// WebSocket 실시간 스트림 허브
+// 스냅샷마다 구독 형태(디바이스/지표 집합)별로 프레임을 한 번만 인코딩해 해당 클라이언트들에 나눠 준다
+// 클라이언트마다 전송 중 프레임 하나와 대기 프레임 하나만 두고, 대기 중에 새 프레임이 오면 덮어쓴다
+class LiveStreamHub {
+private:
+    using FramePtr = std::shared_ptr<const std::string>;
+
+    struct Client {
+        int fd;
+        std::string input;
+        LiveSubscription subscription;
+        std::chrono::steady_clock::time_point lastFrame;
+        std::string control;   // 핸드셰이크/pong/close (프레임 사이에만 보낸다)
+        size_t controlPos = 0;
+        FramePtr sending;
+        size_t sendPos = 0;
+        FramePtr pending;
+        bool closeAfterWrite = false;
+        bool wantWrite = false;
+    };
+
+    int epollFd;
+    std::atomic<bool> running;
+    std::thread hubThread;
+
+    std::mutex mutex;
+    std::unordered_map<int, std::unique_ptr<Client>> clients;
+    std::map<std::pair<uint64_t, uint32_t>, FramePtr> shapeFrames; // publish 중 재사용
+    std::string payload;
+    LiveStats stats;
+
+public:
+    LiveStreamHub();
+    ~LiveStreamHub();
+
+    bool start();
+    void stop();
+
+    // HttpServer::upgrade에 등록하는 핸들러
+    bool accept(const HttpRequest& request, int fd, const std::string& pendingInput);
+
+    // 싱크 스레드에서 호출
+    void publish(const MetricsSnapshot& snapshot);
+
+    LiveStats getStats();
+
+private:
+    void hubLoop();
+    bool readClient(Client& client);
+    bool handleFrames(Client& client);
+    bool writeClient(Client& client);
+    void updateEvents(Client& client);
+    void closeClient(int fd);
+    void encode(const MetricsSnapshot& snapshot, const LiveSubscription& subscription, std::string& out);
+};
+
+// 파이프라인 싱크: 배치의 마지막 스냅샷만 허브로 넘긴다
+class LiveSink : public MetricsSink {
+private:
+    LiveStreamHub& hub;
+
+public:
+    explicit LiveSink(LiveStreamHub& hub) : hub(hub) {}
+
+    std::string name() const override { return "live"; }
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override {
+        hub.publish(*batch.back());
+        return true;
+    }
+};
+
+// Sec-WebSocket-Accept 값 계산 (RFC 6455)
+std::string webSocketAcceptKey(const std::string& clientKey);
+
+#endif // NVML_LIVE_H
@@ -33,6 +33,12 @@ bool NVMLManager::initialize() {
         std::cerr << "Warning: Failed to initialize events" << std::endl;
     }
     
+    // vGPU 호스트 모드인 GPU만 실제로 수집된다
+    vgpuCollector = std::make_unique<VGPUCollector>(gpuDevices);
+    
+    mediaCollector = std::make_unique<MediaCollector>(gpuDevices);
+    latestMediaStats.assign(gpuDevices.size(), MediaStats());
+    
     initialized = true;
     return true;
 }
@@ -47,6 +53,10 @@ void NVMLManager::shutdown() {
         eventSet = nullptr;
     }
     
+    vgpuCollector.reset();
+    mediaCollector.reset();
+    hostCollector.reset();
+    
     nvmlShutdown();
     initialized = false;
 }
@@ -72,12 +82,14 @@ bool NVMLManager::initializeDevices() {
         char name[NVML_DEVICE_NAME_BUFFER_SIZE];
         if (nvmlDeviceGetName(gpu.device, name, sizeof(name)) == NVML_SUCCESS) {
             gpu.name = name;
+            gpu.nameId = internString(gpu.name);
         }
         
         // UUID
         char uuid[NVML_DEVICE_UUID_BUFFER_SIZE];
         if (nvmlDeviceGetUUID(gpu.device, uuid, sizeof(uuid)) == NVML_SUCCESS) {
             gpu.uuid = uuid;
+            gpu.uuidId = internString(gpu.uuid);
         }
         
         // 시리얼 번호
@@ -104,6 +116,12 @@ bool NVMLManager::initializeDevices() {
             gpu.totalMemory = memInfo.total;
         }
         
+        // 온도 임계값 (바뀌지 않으므로 한 번만 읽는다)
+        gpu.slowdownTemperature = 0;
+        gpu.shutdownTemperature = 0;
+        nvmlDeviceGetTemperatureThreshold(gpu.device, NVML_TEMPERATURE_THRESHOLD_SLOWDOWN, &gpu.slowdownTemperature);
+        nvmlDeviceGetTemperatureThreshold(gpu.device, NVML_TEMPERATURE_THRESHOLD_SHUTDOWN, &gpu.shutdownTemperature);
+        
         gpuDevices.push_back(gpu);
     }
     
@@ -119,9 +137,12 @@ bool NVMLManager::initializeUnits() {
     
     unitDevices.clear();
     unitDevices.reserve(unitCount);
+    unitSupport.clear();
+    unitSupport.reserve(unitCount);
     
     for (unsigned int i = 0; i < unitCount; i++) {
-        UnitInfo unit;
+        UnitInfo unit = {};
+        unit.index = i;
         
         result = nvmlUnitGetHandleByIndex(i, &unit.unit);
         if (result != NVML_SUCCESS) continue;
@@ -143,24 +164,118 @@ bool NVMLManager::initializeUnits() {
             nvmlUnitGetDevices(unit.unit, &deviceCount, unit.devices.data());
         }
         
-        // 팬 속도
-        nvmlUnitFanSpeeds_t fanSpeeds;
-        if (nvmlUnitGetFanSpeedInfo(unit.unit, &fanSpeeds) == NVML_SUCCESS) {
-            unit.fanSpeed = fanSpeeds.fans[0].speed; // 첫 번째 팬
-        }
-        
-        // 온도
-        nvmlUnitGetTemperature(unit.unit, 0, &unit.temperature);
-        
-        // PSU 정보
-        nvmlUnitGetPsuInfo(unit.unit, &unit.psuInfo);
+        // 팬, 온도, PSU, LED 초기값
+        UnitSensorSupport support;
+        refreshUnitTelemetry(unit, support);
         
+        unitSupport.push_back(support);
         unitDevices.push_back(unit);
     }
     
+    lastUnitRefresh = std::chrono::steady_clock::now();
+    return true;
+}
+
+// 값이 바뀌었을 때만 갱신하고 true 반환
+template <typename T>
+static bool updateIfChanged(T& target, const T& value) {
+    if (target == value) return false;
+    target = value;
     return true;
 }
 
+bool NVMLManager::refreshUnitTelemetry(UnitInfo& unit, UnitSensorSupport& support) {
+    bool changed = false;
+    
+    // 모든 팬
+    if (support.fans) {
+        nvmlUnitFanSpeeds_t fanSpeeds;
+        nvmlReturn_t result = nvmlUnitGetFanSpeedInfo(unit.unit, &fanSpeeds);
+        if (result == NVML_SUCCESS) {
+            if (unit.fans.size() != fanSpeeds.count) {
+                unit.fans.resize(fanSpeeds.count);
+                changed = true;
+            }
+            for (unsigned int f = 0; f < fanSpeeds.count; f++) {
+                changed |= updateIfChanged(unit.fans[f].speed, fanSpeeds.fans[f].speed);
+                changed |= updateIfChanged(unit.fans[f].state, fanSpeeds.fans[f].state);
+            }
+            unit.fanSpeed = unit.fans.empty() ? 0 : unit.fans[0].speed;
+        } else if (result == NVML_ERROR_NOT_SUPPORTED) {
+            support.fans = false; // 지원되지 않는 센서는 이후 조회하지 않음 (일시적 오류는 다음 틱에 다시 시도)
+        }
+    }
+    
+    // 모든 온도 센서
+    for (unsigned int t = 0; t < UNIT_TEMPERATURE_COUNT; t++) {
+        if (!support.temperatures[t]) continue;
+        
+        unsigned int temperature = 0;
+        nvmlReturn_t result = nvmlUnitGetTemperature(unit.unit, t, &temperature);
+        if (result == NVML_SUCCESS) {
+            changed |= updateIfChanged(unit.temperatures[t], temperature);
+        } else if (result == NVML_ERROR_NOT_SUPPORTED) {
+            support.temperatures[t] = false;
+        }
+    }
+    unit.temperature = unit.temperatures[UNIT_TEMPERATURE_INTAKE];
+    
+    // PSU 전류/전압/전력
+    if (support.psu) {
+        nvmlPSUInfo_t psuInfo;
+        nvmlReturn_t result = nvmlUnitGetPsuInfo(unit.unit, &psuInfo);
+        if (result == NVML_SUCCESS) {
+            if (psuInfo.current != unit.psuInfo.current ||
+                psuInfo.voltage != unit.psuInfo.voltage ||
+                psuInfo.power != unit.psuInfo.power ||
+                strncmp(psuInfo.state, unit.psuInfo.state, sizeof(psuInfo.state)) != 0) {
+                unit.psuInfo = psuInfo;
+                changed = true;
+            }
+        } else if (result == NVML_ERROR_NOT_SUPPORTED) {
+            support.psu = false;
+        }
+    }
+    
+    // LED 상태
+    if (support.led) {
+        nvmlLedState_t ledState;
+        nvmlReturn_t result = nvmlUnitGetLedState(unit.unit, &ledState);
+        if (result == NVML_SUCCESS) {
+            if (ledState.color != unit.ledState.color ||
+                strncmp(ledState.cause, unit.ledState.cause, sizeof(ledState.cause)) != 0) {
+                unit.ledState = ledState;
+                changed = true;
+            }
+        } else if (result == NVML_ERROR_NOT_SUPPORTED) {
+            support.led = false;
+        }
+    }
+    
+    if (changed) {
+        unit.timestamp = std::chrono::system_clock::now();
+    }
+    return changed;
+}
+
+void NVMLManager::refreshUnits() {
+    std::vector<UnitInfo> changedUnits;
+    
+    {
+        std::lock_guard<std::mutex> lock(unitMutex);
+        for (size_t i = 0; i < unitDevices.size(); i++) {
+            if (refreshUnitTelemetry(unitDevices[i], unitSupport[i]) && unitCallback) {
+                changedUnits.push_back(unitDevices[i]);
+            }
+        }
+    }
+    
+    // 콜백은 락 밖에서 호출
+    for (const auto& unit : changedUnits) {
+        unitCallback(unit);
+    }
+}
+
 bool NVMLManager::initializeEvents() {
     nvmlReturn_t result = nvmlEventSetCreate(&eventSet);
     if (result != NVML_SUCCESS) {
@@ -181,8 +296,9 @@ bool NVMLManager::initializeEvents() {
     return true;
 }
 
-GPUMetrics NVMLManager::collectDeviceMetrics(const GPUInfo& gpu) {
+GPUMetrics NVMLManager::collectDeviceMetrics(const GPUInfo& gpu, const MediaStats* media) {
     GPUMetrics metrics = {};
+    metrics.deviceIndex = gpu.index;
     metrics.timestamp = std::chrono::system_clock::now();
     
     // 사용률 정보
@@ -192,10 +308,16 @@ GPUMetrics NVMLManager::collectDeviceMetrics(const GPUInfo& gpu) {
         metrics.memoryUtilization = utilization.memory;
     }
     
-    // 인코더/디코더 사용률
-    unsigned int samplingPeriod;
-    nvmlDeviceGetEncoderUtilization(gpu.device, &metrics.encoderUtilization, &samplingPeriod);
-    nvmlDeviceGetDecoderUtilization(gpu.device, &metrics.decoderUtilization, &samplingPeriod);
+    // 인코더/디코더 사용률 (이번 틱에 미디어 수집기가 읽었으면 그 값)
+    if (media) {
+        metrics.encoderUtilization = media->encoderUtilization;
+        metrics.encoderSamplingPeriod = media->encoderSamplingPeriod;
+        metrics.decoderUtilization = media->decoderUtilization;
+        metrics.decoderSamplingPeriod = media->decoderSamplingPeriod;
+    } else {
+        nvmlDeviceGetEncoderUtilization(gpu.device, &metrics.encoderUtilization, &metrics.encoderSamplingPeriod);
+        nvmlDeviceGetDecoderUtilization(gpu.device, &metrics.decoderUtilization, &metrics.decoderSamplingPeriod);
+    }
     
     // 메모리 정보
     nvmlMemory_t memInfo;
@@ -220,6 +342,7 @@ GPUMetrics NVMLManager::collectDeviceMetrics(const GPUInfo& gpu) {
     nvmlDeviceGetClockInfo(gpu.device, NVML_CLOCK_GRAPHICS, &metrics.graphicsClock);
     nvmlDeviceGetClockInfo(gpu.device, NVML_CLOCK_MEM, &metrics.memoryClock);
     nvmlDeviceGetClockInfo(gpu.device, NVML_CLOCK_SM, &metrics.smClock);
+    nvmlDeviceGetCurrentClocksThrottleReasons(gpu.device, &metrics.clocksThrottleReasons);
     
     // ECC 에러
     nvmlEccErrorCounts_t eccCounts;
@@ -233,7 +356,8 @@ GPUMetrics NVMLManager::collectDeviceMetrics(const GPUInfo& gpu) {
     return metrics;
 }
 
-std::vector<ProcessInfo> NVMLManager::collectProcessInfo(nvmlDevice_t device) {
+std::vector<ProcessInfo> NVMLManager::collectProcessInfo(const GPUInfo& gpu) {
+    nvmlDevice_t device = gpu.device;
     std::vector<ProcessInfo> processes;
     
     // Compute 프로세스
@@ -244,15 +368,11 @@ std::vector<ProcessInfo> NVMLManager::collectProcessInfo(nvmlDevice_t device) {
         if (nvmlDeviceGetComputeRunningProcesses(device, &infoCount, nvmlProcs.data()) == NVML_SUCCESS) {
             for (const auto& proc : nvmlProcs) {
                 ProcessInfo info;
+                info.deviceIndex = gpu.index;
                 info.pid = proc.pid;
                 info.usedGpuMemory = proc.usedGpuMemory;
                 info.type = NVML_PROCESS_TYPE_COMPUTE;
-                
-                // 프로세스 이름 가져오기 (시스템 의존적)
-                char processName[1024];
-                if (nvmlSystemGetProcessName(proc.pid, processName, sizeof(processName)) == NVML_SUCCESS) {
-                    info.name = processName;
-                }
+                info.nameId = processNameId(proc.pid);
                 
                 processes.push_back(info);
             }
@@ -267,14 +387,11 @@ std::vector<ProcessInfo> NVMLManager::collectProcessInfo(nvmlDevice_t device) {
         if (nvmlDeviceGetGraphicsRunningProcesses(device, &infoCount, nvmlProcs.data()) == NVML_SUCCESS) {
             for (const auto& proc : nvmlProcs) {
                 ProcessInfo info;
+                info.deviceIndex = gpu.index;
                 info.pid = proc.pid;
                 info.usedGpuMemory = proc.usedGpuMemory;
                 info.type = NVML_PROCESS_TYPE_GRAPHICS;
-                
-                char processName[1024];
-                if (nvmlSystemGetProcessName(proc.pid, processName, sizeof(processName)) == NVML_SUCCESS) {
-                    info.name = processName;
-                }
+                info.nameId = processNameId(proc.pid);
                 
                 processes.push_back(info);
             }
@@ -284,6 +401,70 @@ std::vector<ProcessInfo> NVMLManager::collectProcessInfo(nvmlDevice_t device) {
     return processes;
 }
 
+void NVMLManager::collectMigSlices(const GPUInfo& gpu, std::vector<MigSliceMemory>& slices) {
+    unsigned int currentMode, pendingMode;
+    if (nvmlDeviceGetMigMode(gpu.device, &currentMode, &pendingMode) != NVML_SUCCESS ||
+        currentMode != NVML_DEVICE_MIG_ENABLE) {
+        return;
+    }
+    unsigned int maxCount = 0;
+    if (nvmlDeviceGetMaxMigDeviceCount(gpu.device, &maxCount) != NVML_SUCCESS) {
+        return;
+    }
+    
+    // 빈 인덱스(만들지 않은 슬라이스)는 NOT_FOUND를 돌려주므로 건너뛴다
+    for (unsigned int i = 0; i < maxCount; i++) {
+        nvmlDevice_t migDevice;
+        if (nvmlDeviceGetMigDeviceHandleByIndex(gpu.device, i, &migDevice) != NVML_SUCCESS) {
+            continue;
+        }
+        nvmlMemory_t memory;
+        char uuid[NVML_DEVICE_UUID_BUFFER_SIZE];
+        if (nvmlDeviceGetMemoryInfo(migDevice, &memory) != NVML_SUCCESS ||
+            nvmlDeviceGetUUID(migDevice, uuid, sizeof(uuid)) != NVML_SUCCESS) {
+            continue;
+        }
+        
+        MigSliceMemory slice;
+        slice.deviceIndex = gpu.index;
+        slice.sliceIndex = i;
+        slice.uuidId = internString(uuid);
+        slice.usedBytes = memory.used;
+        slice.totalBytes = memory.total;
+        slices.push_back(slice);
+    }
+}
+
+InternId NVMLManager::processNameId(unsigned int pid) {
+    std::lock_guard<std::mutex> lock(processNameMutex);
+    auto it = processNames.find(pid);
+    if (it != processNames.end()) {
+        it->second.lastTick = processTick;
+        return it->second.nameId;
+    }
+    
+    // 프로세스 이름 가져오기 (시스템 의존적). 이미 인터닝된 이름이면 할당 없음
+    InternId nameId = kEmptyIntern;
+    char processName[1024];
+    if (nvmlSystemGetProcessName(pid, processName, sizeof(processName)) == NVML_SUCCESS) {
+        nameId = internString(processName);
+    }
+    processNames[pid] = {nameId, processTick};
+    return nameId;
+}
+
+void NVMLManager::sweepProcessNames() {
+    std::lock_guard<std::mutex> lock(processNameMutex);
+    for (auto it = processNames.begin(); it != processNames.end();) {
+        if (it->second.lastTick != processTick) {
+            it = processNames.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    processTick++;
+}
+
 void NVMLManager::startMonitoring() {
     if (running || !initialized) return;
     
@@ -313,20 +494,80 @@ void NVMLManager::monitoringLoop() {
     while (running) {
         auto start = std::chrono::steady_clock::now();
         
+        if (snapshotCallback) {
+            snapshot.timestamp = std::chrono::system_clock::now();
+            snapshot.devices.clear();
+            snapshot.processes.clear();
+            snapshot.migSlices.clear();
+        }
+        
         // 모든 GPU 메트릭 수집
         for (const auto& gpu : gpuDevices) {
-            GPUMetrics metrics = collectDeviceMetrics(gpu);
+            // 인코더/디코더/FBC 통계 (세션 버퍼는 틱 간 재사용)
+            // 디바이스 지표보다 먼저 읽어 인코더/디코더 사용률 NVML 호출을 틱마다 한 번만 한다
+            bool polled = false;
+            if (enableMediaMonitoring && mediaCollector) {
+                {
+                    std::lock_guard<std::mutex> lock(mediaMutex);
+                    polled = mediaCollector->poll(gpu.index, latestMediaStats[gpu.index]);
+                    if (polled && mediaCallback) {
+                        mediaCallbackStats = latestMediaStats[gpu.index];
+                    }
+                }
+                // 콜백이 getMediaStats를 불러도 되도록 잠금 밖에서 (복사본 버퍼는 틱 간 재사용)
+                if (polled && mediaCallback) {
+                    mediaCallback(mediaCallbackStats);
+                }
+            }
+            
+            // latestMediaStats는 이 스레드만 쓰므로 잠금 없이 읽어도 된다
+            GPUMetrics metrics = collectDeviceMetrics(gpu, polled ? &latestMediaStats[gpu.index] : nullptr);
             if (metricsCallback) {
                 metricsCallback(metrics);
             }
             
             // 프로세스 정보 수집
-            if (enableProcessMonitoring && processCallback) {
-                auto processes = collectProcessInfo(gpu.device);
-                if (!processes.empty()) {
+            if (enableProcessMonitoring && (processCallback || snapshotCallback)) {
+                auto processes = collectProcessInfo(gpu);
+                if (processCallback && !processes.empty()) {
                     processCallback(processes);
                 }
+                if (snapshotCallback) {
+                    snapshot.processes.insert(snapshot.processes.end(), processes.begin(), processes.end());
+                }
+            }
+            
+            if (snapshotCallback) {
+                snapshot.devices.push_back(metrics);
+                // MIG 슬라이스별 메모리 (입장 판정이 슬라이스 단위로 헤드룸을 본다)
+                collectMigSlices(gpu, snapshot.migSlices);
+            }
+            
+            // vGPU 변경 사항 및 새 샘플
+            if (enableVGPUMonitoring && vgpuCallback && vgpuCollector) {
+                if (vgpuCollector->poll(gpu.index, vgpuUpdate) && !vgpuUpdate.empty()) {
+                    vgpuCallback(vgpuUpdate);
+                }
+            }
+        }
+        
+        // getRunningProcesses처럼 루프 밖에서 채운 항목도 있으므로 수집 설정과 관계없이 매 틱 쓴다
+        sweepProcessNames();
+        
+        // 틱 전체 스냅샷 (디바이스 전체를 한 번에 소비하는 내보내기 경로)
+        if (snapshotCallback) {
+            // 호스트 지표는 같은 틱에 읽어 GPU 대기와 호스트 포화를 나란히 비교할 수 있게 한다
+            if (hostCollector) {
+                hostCollector->sample(snapshot.processes, snapshot.host);
             }
+            snapshotCallback(snapshot);
+        }
+        
+        // Unit 텔레메트리는 별도 주기로 갱신 (변경 시에만 콜백)
+        if (!unitDevices.empty() &&
+            start - lastUnitRefresh >= std::chrono::milliseconds(unitMonitoringInterval)) {
+            refreshUnits();
+            lastUnitRefresh = start;
         }
         
         // 모니터링 간격 대기
@@ -394,7 +635,74 @@ std::vector<ProcessInfo> NVMLManager::getRunningProcesses(unsigned int deviceInd
     if (deviceIndex >= gpuDevices.size()) {
         return {};
     }
-    return collectProcessInfo(gpuDevices[deviceIndex].device);
+    return collectProcessInfo(gpuDevices[deviceIndex]);
+}
+
+std::vector<VGPUInfo> NVMLManager::getVGPUInfo(unsigned int deviceIndex) {
+    if (deviceIndex >= gpuDevices.size() || !vgpuCollector) {
+        return {};
+    }
+    return vgpuCollector->getInstances(deviceIndex);
+}
+
+MediaStats NVMLManager::getMediaStats(unsigned int deviceIndex) {
+    if (deviceIndex >= gpuDevices.size() || !mediaCollector) {
+        return {};
+    }
+    
+    std::lock_guard<std::mutex> lock(mediaMutex);
+    
+    // 모니터링 중에는 샘플 커서를 소비하지 않도록 최신 값을 반환
+    if (!running || !enableMediaMonitoring) {
+        mediaCollector->poll(deviceIndex, latestMediaStats[deviceIndex]);
+    }
+    return latestMediaStats[deviceIndex];
+}
+
+void NVMLManager::registerCheckpoint(CheckpointManager& checkpoint) {
+    CheckpointSection section;
+    section.name = "collector-cursors";
+    section.version = 1;
+    section.bootScoped = true;
+    section.save = [this](CheckpointWriter& writer) {
+        vgpuCollector->saveCursors(writer);
+        mediaCollector->saveCursors(writer);
+    };
+    section.restore = [this](CheckpointReader& reader) {
+        return vgpuCollector->restoreCursors(reader) && mediaCollector->restoreCursors(reader);
+    };
+    if (vgpuCollector && mediaCollector) {
+        checkpoint.addSection(section);
+    }
+    
+    // pid -> 프로세스 이름 캐시. 인터닝 id는 실행마다 다르므로 이름 문자열로 저장한다 (PID는 부팅 안에서만 유효)
+    CheckpointSection names;
+    names.name = "process-names";
+    names.version = 1;
+    names.bootScoped = true;
+    names.save = [this](CheckpointWriter& writer) {
+        std::lock_guard<std::mutex> lock(processNameMutex);
+        writer.put<uint32_t>(static_cast<uint32_t>(processNames.size()));
+        for (const auto& entry : processNames) {
+            writer.put<uint32_t>(entry.first);
+            writer.putString(internedString(entry.second.nameId));
+        }
+    };
+    names.restore = [this](CheckpointReader& reader) {
+        uint32_t count = reader.get<uint32_t>();
+        std::vector<std::pair<unsigned int, std::string>> entries;
+        for (uint32_t i = 0; i < count && reader.good(); i++) {
+            unsigned int pid = reader.get<uint32_t>();
+            entries.emplace_back(pid, reader.getString());
+        }
+        if (!reader.done()) return false;
+        std::lock_guard<std::mutex> lock(processNameMutex);
+        for (const auto& entry : entries) {
+            processNames[entry.first] = {internString(entry.second), processTick};
+        }
+        return true;
+    };
+    checkpoint.addSection(names);
 }
 
 BAR1MemoryInfo NVMLManager::getBAR1MemoryInfo(unsigned int deviceIndex) {
@@ -447,11 +755,12 @@ bool NVMLManager::isDeviceValid(unsigned int deviceIndex) {
     return deviceIndex < gpuDevices.size();
 }
 
-std::vector<GPUInfo> NVMLManager::getGPUInfo() {
+const std::vector<GPUInfo>& NVMLManager::getGPUInfo() const {
     return gpuDevices;
 }
 
 std::vector<UnitInfo> NVMLManager::getUnitInfo() {
+    std::lock_guard<std::mutex> lock(unitMutex);
     return unitDevices;
 }
 
@@ -467,6 +776,42 @@ void NVMLManager::setProcessCallback(std::function<void(const std::vector<Proces
     processCallback = callback;
 }
 
+void NVMLManager::setVGPUCallback(std::function<void(const VGPUUpdate&)> callback) {
+    vgpuCallback = callback;
+}
+
+void NVMLManager::setUnitCallback(std::function<void(const UnitInfo&)> callback) {
+    unitCallback = callback;
+}
+
+void NVMLManager::setMediaCallback(std::function<void(const MediaStats&)> callback) {
+    mediaCallback = callback;
+}
+
+void NVMLManager::setSnapshotCallback(std::function<void(const MetricsSnapshot&)> callback) {
+    snapshotCallback = callback;
+}
+
 void NVMLManager::setMonitoringInterval(int intervalMs) {
     monitoringInterval = intervalMs;
+}
+
+void NVMLManager::setUnitMonitoringInterval(int intervalMs) {
+    unitMonitoringInterval = intervalMs;
+}
+
+bool NVMLManager::setHostMonitoring(bool enable) {
+    if (running) return false;
+    if (!enable) {
+        hostCollector.reset();
+        snapshot.host = HostMetrics();
+        return true;
+    }
+    if (hostCollector) return true;
+    auto collector = std::make_unique<HostCollector>();
+    if (!collector->open()) {
+        return false;
+    }
+    hostCollector = std::move(collector);
+    return true;
 }
\ No newline at end of file
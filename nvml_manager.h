@@ -2,12 +2,16 @@
 #define NVML_MANAGER_H
 
 #include "nvml_types.h"
+#include "nvml_vgpu.h"
+#include "nvml_media.h"
+#include "nvml_host.h"
 #include <thread>
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
 #include <queue>
 #include <functional>
+#include <unordered_map>
 
 class NVMLManager {
 private:
@@ -24,6 +28,44 @@ private:
     std::function<void(const GPUMetrics&)> metricsCallback;
     std::function<void(const EventInfo&)> eventCallback;
     std::function<void(const std::vector<ProcessInfo>&)> processCallback;
+    std::function<void(const VGPUUpdate&)> vgpuCallback;
+    std::function<void(const UnitInfo&)> unitCallback;
+    std::function<void(const MediaStats&)> mediaCallback;
+    std::function<void(const MetricsSnapshot&)> snapshotCallback;
+    MetricsSnapshot snapshot; // 틱마다 재사용
+    
+    // Unit 텔레메트리 (S-class), 자체 주기로 갱신
+    struct UnitSensorSupport {
+        bool fans = true;
+        bool temperatures[UNIT_TEMPERATURE_COUNT] = {true, true, true};
+        bool psu = true;
+        bool led = true;
+    };
+    std::vector<UnitSensorSupport> unitSupport;
+    std::mutex unitMutex;
+    std::chrono::steady_clock::time_point lastUnitRefresh;
+    
+    // vGPU 수집
+    std::unique_ptr<VGPUCollector> vgpuCollector;
+    VGPUUpdate vgpuUpdate; // 틱마다 재사용
+    
+    // 인코더/디코더/FBC 수집 (디바이스별 최신 값 유지)
+    std::unique_ptr<MediaCollector> mediaCollector;
+    std::vector<MediaStats> latestMediaStats;
+    std::mutex mediaMutex;
+    MediaStats mediaCallbackStats; // 콜백에 넘기는 복사본 (모니터링 스레드만 사용)
+    
+    // 프로세스 이름 캐시 (pid -> 인터닝 id). 틱 동안 보이지 않은 pid는 틱 끝에 지운다 (PID 재사용)
+    struct ProcessNameEntry {
+        InternId nameId;
+        uint64_t lastTick;
+    };
+    std::unordered_map<unsigned int, ProcessNameEntry> processNames;
+    uint64_t processTick = 0;
+    std::mutex processNameMutex;
+    
+    // 호스트 지표 (선택, 스냅샷 틱에 함께 수집)
+    std::unique_ptr<HostCollector> hostCollector;
     
     // 이벤트 처리
     nvmlEventSet_t eventSet;
@@ -33,8 +75,11 @@ private:
     
     // 설정
     int monitoringInterval = 1000; // ms
+    int unitMonitoringInterval = 10000; // ms
     bool enableEventMonitoring = true;
     bool enableProcessMonitoring = true;
+    bool enableVGPUMonitoring = true;
+    bool enableMediaMonitoring = true;
 
 public:
     NVMLManager();
@@ -45,7 +90,8 @@ public:
     void shutdown();
     
     // GPU 정보 조회
-    std::vector<GPUInfo> getGPUInfo();
+    // 초기화 이후 바뀌지 않으므로 복사하지 않고 참조로 돌려준다
+    const std::vector<GPUInfo>& getGPUInfo() const;
     std::vector<UnitInfo> getUnitInfo();
     
     // 메트릭 조회
@@ -62,15 +108,29 @@ public:
     // vGPU 정보
     std::vector<VGPUInfo> getVGPUInfo(unsigned int deviceIndex);
     
+    // 인코더/디코더/FBC 통계
+    MediaStats getMediaStats(unsigned int deviceIndex);
+    
+    // 체크포인트 섹션 등록 (vGPU/미디어 샘플 커서, pid -> 프로세스 이름 캐시. 같은 부팅에서만 복원)
+    // initialize 이후에 부른다
+    void registerCheckpoint(CheckpointManager& checkpoint);
+    
     // 모니터링 제어
     void startMonitoring();
     void stopMonitoring();
     void setMonitoringInterval(int intervalMs);
+    void setUnitMonitoringInterval(int intervalMs);
+    // 스냅샷에 호스트 CPU/메모리/PSI와 GPU 프로세스의 CPU 시간을 함께 싣는다 (startMonitoring 전에 부른다)
+    bool setHostMonitoring(bool enable);
     
     // 콜백 설정
     void setMetricsCallback(std::function<void(const GPUMetrics&)> callback);
     void setEventCallback(std::function<void(const EventInfo&)> callback);
     void setProcessCallback(std::function<void(const std::vector<ProcessInfo>&)> callback);
+    void setVGPUCallback(std::function<void(const VGPUUpdate&)> callback);
+    void setUnitCallback(std::function<void(const UnitInfo&)> callback);
+    void setMediaCallback(std::function<void(const MediaStats&)> callback);
+    void setSnapshotCallback(std::function<void(const MetricsSnapshot&)> callback);
     
     // 이벤트 등록
     bool registerEvents(unsigned int deviceIndex, unsigned long long eventTypes);
@@ -88,11 +148,17 @@ private:
     bool initializeDevices();
     bool initializeUnits();
     bool initializeEvents();
+    bool refreshUnitTelemetry(UnitInfo& unit, UnitSensorSupport& support);
+    void refreshUnits();
     void monitoringLoop();
     void eventLoop();
     void processEvents();
-    GPUMetrics collectDeviceMetrics(const GPUInfo& gpu);
-    std::vector<ProcessInfo> collectProcessInfo(nvmlDevice_t device);
+    // media가 있으면 인코더/디코더 사용률을 NVML에서 다시 읽지 않고 가져온다
+    GPUMetrics collectDeviceMetrics(const GPUInfo& gpu, const MediaStats* media = nullptr);
+    std::vector<ProcessInfo> collectProcessInfo(const GPUInfo& gpu);
+    void collectMigSlices(const GPUInfo& gpu, std::vector<MigSliceMemory>& slices);
+    InternId processNameId(unsigned int pid);
+    void sweepProcessNames();
     void handleEvent(const nvmlEventData_t& eventData);
     std::string eventTypeToString(unsigned long long eventType);
 };
@@ -0,0 +1,251 @@
+#include "nvml_media.h"
+#include <algorithm>
+
+namespace {
+
+const nvmlEncoderType_t kEncoderTypes[MEDIA_CODEC_COUNT] = {
+    NVML_ENCODER_QUERY_H264,
+    NVML_ENCODER_QUERY_HEVC
+};
+
+// 한 번에 읽는 샘플 버퍼 크기 (NVML 내부 링 버퍼보다 크게)
+const size_t kSampleBufferSize = 128;
+
+// 지원되지 않는 기능인지 (이후 재조회 불필요)
+bool isUnsupported(nvmlReturn_t result) {
+    return result == NVML_ERROR_NOT_SUPPORTED;
+}
+
+} // namespace
+
+MediaCollector::MediaCollector(const std::vector<GPUInfo>& gpus) {
+    states.resize(gpus.size());
+
+    for (size_t i = 0; i < gpus.size(); i++) {
+        DeviceState& state = states[i];
+        state.device = gpus[i].device;
+        state.encoderStatsSupported = true;
+        state.encoderSessionsSupported = true;
+        for (unsigned int c = 0; c < MEDIA_CODEC_COUNT; c++) {
+            state.encoderCapacitySupported[c] = true;
+        }
+        state.fbcSupported = true;
+        state.encoderSamplesSupported = true;
+        state.decoderSamplesSupported = true;
+        state.lastEncoderSample = 0;
+        state.lastDecoderSample = 0;
+        state.generation = 0;
+        state.sampleBuffer.resize(kSampleBufferSize);
+    }
+}
+
+bool MediaCollector::poll(unsigned int deviceIndex, MediaStats& stats) {
+    if (deviceIndex >= states.size()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    DeviceState& state = states[deviceIndex];
+    state.generation++;
+
+    stats.deviceIndex = deviceIndex;
+    stats.timestamp = std::chrono::system_clock::now();
+
+    // 사용률과 샘플링 주기
+    nvmlDeviceGetEncoderUtilization(state.device, &stats.encoderUtilization, &stats.encoderSamplingPeriod);
+    nvmlDeviceGetDecoderUtilization(state.device, &stats.decoderUtilization, &stats.decoderSamplingPeriod);
+
+    collectEncoder(state, stats);
+    collectEncoderSessions(state, stats);
+    collectFBC(state, stats);
+
+    stats.encoderSamples.clear();
+    stats.decoderSamples.clear();
+    if (state.encoderSamplesSupported) {
+        collectSamples(state, NVML_ENC_UTILIZATION_SAMPLES, state.encoderSamplesSupported, state.lastEncoderSample,
+                       stats.encoderSamples);
+    }
+    if (state.decoderSamplesSupported) {
+        collectSamples(state, NVML_DEC_UTILIZATION_SAMPLES, state.decoderSamplesSupported, state.lastDecoderSample,
+                       stats.decoderSamples);
+    }
+
+    return true;
+}
+
+void MediaCollector::saveCursors(CheckpointWriter& writer) {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    writer.put<uint32_t>(static_cast<uint32_t>(states.size()));
+    for (const auto& state : states) {
+        writer.put<uint64_t>(state.lastEncoderSample);
+        writer.put<uint64_t>(state.lastDecoderSample);
+    }
+}
+
+bool MediaCollector::restoreCursors(CheckpointReader& reader) {
+    uint32_t count = reader.get<uint32_t>();
+    if (!reader.good() || count != states.size()) return false;
+    std::vector<uint64_t> cursors(count * 2);
+    for (auto& cursor : cursors) {
+        cursor = reader.get<uint64_t>();
+    }
+    if (!reader.good()) return false;
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    for (size_t i = 0; i < states.size(); i++) {
+        states[i].lastEncoderSample = cursors[i * 2];
+        states[i].lastDecoderSample = cursors[i * 2 + 1];
+    }
+    return true;
+}
+
+void MediaCollector::collectEncoder(DeviceState& state, MediaStats& stats) {
+    if (state.encoderStatsSupported) {
+        nvmlReturn_t result = nvmlDeviceGetEncoderStats(state.device, &stats.encoderSessionCount,
+                                                        &stats.encoderAverageFps, &stats.encoderAverageLatency);
+        if (isUnsupported(result)) {
+            state.encoderStatsSupported = false;
+        }
+    }
+
+    // 코덱별 남은 인코더 용량 (스트림 배치 시 실제 여유분)
+    for (unsigned int c = 0; c < MEDIA_CODEC_COUNT; c++) {
+        if (!state.encoderCapacitySupported[c]) continue;
+
+        nvmlReturn_t result = nvmlDeviceGetEncoderCapacity(state.device, kEncoderTypes[c], &stats.encoderCapacity[c]);
+        if (isUnsupported(result)) {
+            state.encoderCapacitySupported[c] = false;
+        }
+    }
+}
+
+void MediaCollector::collectEncoderSessions(DeviceState& state, MediaStats& stats) {
+    stats.encoderSessions.clear();
+    if (!state.encoderSessionsSupported) return;
+
+    // 세션 수만큼 버퍼를 유지하고 부족할 때만 늘린다
+    unsigned int count = static_cast<unsigned int>(state.encoderSessionBuffer.size());
+    nvmlReturn_t result = nvmlDeviceGetEncoderSessions(state.device, &count,
+                                                       state.encoderSessionBuffer.empty() ? nullptr : state.encoderSessionBuffer.data());
+    if (result == NVML_ERROR_INSUFFICIENT_SIZE || (result == NVML_SUCCESS && count > state.encoderSessionBuffer.size())) {
+        state.encoderSessionBuffer.resize(count);
+        result = nvmlDeviceGetEncoderSessions(state.device, &count, state.encoderSessionBuffer.data());
+    }
+    if (isUnsupported(result)) {
+        state.encoderSessionsSupported = false;
+        return;
+    }
+    if (result != NVML_SUCCESS) return;
+
+    for (unsigned int i = 0; i < count; i++) {
+        const auto& raw = state.encoderSessionBuffer[i];
+        auto& cached = state.encoderSessions[raw.sessionId];
+
+        // 기존 세션은 제자리 갱신
+        cached.generation = state.generation;
+        cached.info.sessionId = raw.sessionId;
+        cached.info.pid = raw.pid;
+        cached.info.vgpuInstance = raw.vgpuInstance;
+        cached.info.codecType = raw.codecType;
+        cached.info.hResolution = raw.hResolution;
+        cached.info.vResolution = raw.vResolution;
+        cached.info.averageFps = raw.averageFps;
+        cached.info.averageLatency = raw.averageLatency;
+    }
+
+    for (auto it = state.encoderSessions.begin(); it != state.encoderSessions.end();) {
+        if (it->second.generation != state.generation) {
+            it = state.encoderSessions.erase(it);
+        } else {
+            stats.encoderSessions.push_back(it->second.info);
+            ++it;
+        }
+    }
+}
+
+void MediaCollector::collectFBC(DeviceState& state, MediaStats& stats) {
+    stats.fbcSessions.clear();
+    if (!state.fbcSupported) return;
+
+    nvmlFBCStats_t fbcStats;
+    nvmlReturn_t result = nvmlDeviceGetFBCStats(state.device, &fbcStats);
+    if (isUnsupported(result)) {
+        state.fbcSupported = false;
+        return;
+    }
+    if (result != NVML_SUCCESS) return;
+
+    stats.fbcSessionCount = fbcStats.sessionsCount;
+    stats.fbcAverageFps = fbcStats.averageFPS;
+    stats.fbcAverageLatency = fbcStats.averageLatency;
+
+    // 활성 세션이 없으면 세션 목록 조회 생략
+    if (fbcStats.sessionsCount == 0) {
+        state.fbcSessions.clear();
+        return;
+    }
+
+    if (state.fbcSessionBuffer.size() < fbcStats.sessionsCount) {
+        state.fbcSessionBuffer.resize(fbcStats.sessionsCount);
+    }
+    unsigned int count = static_cast<unsigned int>(state.fbcSessionBuffer.size());
+    result = nvmlDeviceGetFBCSessions(state.device, &count, state.fbcSessionBuffer.data());
+    if (result == NVML_ERROR_INSUFFICIENT_SIZE) {
+        state.fbcSessionBuffer.resize(count);
+        result = nvmlDeviceGetFBCSessions(state.device, &count, state.fbcSessionBuffer.data());
+    }
+    if (result != NVML_SUCCESS) return;
+
+    for (unsigned int i = 0; i < count; i++) {
+        const auto& raw = state.fbcSessionBuffer[i];
+        auto& cached = state.fbcSessions[raw.sessionId];
+
+        cached.generation = state.generation;
+        cached.info.sessionId = raw.sessionId;
+        cached.info.pid = raw.pid;
+        cached.info.vgpuInstance = raw.vgpuInstance;
+        cached.info.displayOrdinal = raw.displayOrdinal;
+        cached.info.sessionType = raw.sessionType;
+        cached.info.hResolution = raw.hResolution;
+        cached.info.vResolution = raw.vResolution;
+        cached.info.averageFps = raw.averageFPS;
+        cached.info.averageLatency = raw.averageLatency;
+    }
+
+    for (auto it = state.fbcSessions.begin(); it != state.fbcSessions.end();) {
+        if (it->second.generation != state.generation) {
+            it = state.fbcSessions.erase(it);
+        } else {
+            stats.fbcSessions.push_back(it->second.info);
+            ++it;
+        }
+    }
+}
+
+void MediaCollector::collectSamples(DeviceState& state, nvmlSamplingType_t type, bool& supported,
+                                    unsigned long long& lastSeen, std::vector<UtilizationSample>& out) {
+    nvmlValueType_t valueType;
+    unsigned int count = static_cast<unsigned int>(state.sampleBuffer.size());
+    nvmlReturn_t result = nvmlDeviceGetSamples(state.device, type, lastSeen, &valueType,
+                                               &count, state.sampleBuffer.data());
+    if (result == NVML_ERROR_INSUFFICIENT_SIZE) {
+        state.sampleBuffer.resize(count);
+        result = nvmlDeviceGetSamples(state.device, type, lastSeen, &valueType,
+                                      &count, state.sampleBuffer.data());
+    }
+    if (isUnsupported(result)) {
+        supported = false;
+        return;
+    }
+    if (result != NVML_SUCCESS) return;
+
+    unsigned long long newest = lastSeen;
+    for (unsigned int i = 0; i < count; i++) {
+        const auto& raw = state.sampleBuffer[i];
+        if (raw.timeStamp <= lastSeen) continue;
+
+        out.push_back({raw.timeStamp, sampleValueToUInt(valueType, raw.sampleValue)});
+        newest = std::max(newest, raw.timeStamp);
+    }
+    lastSeen = newest;
+}
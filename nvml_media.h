@@ -0,0 +1,67 @@
+#ifndef NVML_MEDIA_H
+#define NVML_MEDIA_H
+
+#include "nvml_checkpoint.h"
+#include "nvml_types.h"
+#include <mutex>
+#include <unordered_map>
+
+// NVENC/NVDEC/FBC 수집기
+// 세션 정보는 sessionId 기준으로 제자리 갱신하고, 사용률 샘플은 lastSeenTimeStamp 커서로
+// 새 샘플만 읽는다. 지원하지 않는 쿼리는 첫 실패 이후 건너뛴다.
+class MediaCollector {
+private:
+    template <typename T>
+    struct CachedSession {
+        T info;
+        unsigned long long generation;
+    };
+
+    struct DeviceState {
+        nvmlDevice_t device;
+
+        // 지원 여부 (NOT_SUPPORTED 이후 재조회하지 않음)
+        bool encoderStatsSupported;
+        bool encoderSessionsSupported;
+        bool encoderCapacitySupported[MEDIA_CODEC_COUNT];
+        bool fbcSupported;
+        bool encoderSamplesSupported;   // ENC/DEC 샘플은 따로 지원 여부가 갈린다
+        bool decoderSamplesSupported;
+
+        // 샘플 커서
+        unsigned long long lastEncoderSample;
+        unsigned long long lastDecoderSample;
+
+        // 세션 캐시 (sessionId -> 세션), generation으로 사라진 세션 판별
+        unsigned long long generation;
+        std::unordered_map<unsigned int, CachedSession<EncoderSessionInfo>> encoderSessions;
+        std::unordered_map<unsigned int, CachedSession<FBCSessionInfo>> fbcSessions;
+
+        // 틱마다 재사용하는 NVML 버퍼
+        std::vector<nvmlEncoderSessionInfo_t> encoderSessionBuffer;
+        std::vector<nvmlFBCSessionInfo_t> fbcSessionBuffer;
+        std::vector<nvmlSample_t> sampleBuffer;
+    };
+
+    std::vector<DeviceState> states;
+    std::mutex stateMutex;
+
+public:
+    explicit MediaCollector(const std::vector<GPUInfo>& gpus);
+
+    // 한 주기 수집 (stats의 벡터 용량은 재사용된다)
+    bool poll(unsigned int deviceIndex, MediaStats& stats);
+
+    // 체크포인트: 디바이스별 인코더/디코더 샘플 커서
+    void saveCursors(CheckpointWriter& writer);
+    bool restoreCursors(CheckpointReader& reader); // 디바이스 수가 다르면 false
+
+private:
+    void collectEncoder(DeviceState& state, MediaStats& stats);
+    void collectEncoderSessions(DeviceState& state, MediaStats& stats);
+    void collectFBC(DeviceState& state, MediaStats& stats);
+    void collectSamples(DeviceState& state, nvmlSamplingType_t type, bool& supported, unsigned long long& lastSeen,
+                        std::vector<UtilizationSample>& out);
+};
+
+#endif // NVML_MEDIA_H
@@ -92,6 +92,7 @@ struct MIGDeviceInfo {
     unsigned int computeInstanceId;
     nvmlDeviceAttributes_t attributes;
     std::string uuid;
+    InternId uuidId = kEmptyIntern;     // uuid의 인터닝 id
     unsigned long long memorySize;
     unsigned int multiprocessorCount;
     unsigned int maxComputeInstances;
@@ -276,6 +277,7 @@ public:
                                     char uuid[NVML_DEVICE_UUID_BUFFER_SIZE];
                                     if (nvmlDeviceGetUUID(migDevice, uuid, NVML_DEVICE_UUID_BUFFER_SIZE) == NVML_SUCCESS) {
                                         migInfo.uuid = uuid;
+                                        migInfo.uuidId = internString(migInfo.uuid);
                                     }
                                     
                                     // Get memory info
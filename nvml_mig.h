@@ -6,6 +6,7 @@
 #include <map>
 #include <string>
 #include <chrono>
+#include "nvml_intern.h"
 
 // GPU metrics structure
 struct GPUMetrics {
@@ -25,6 +26,7 @@ struct MIGDeviceInfo {
     unsigned int computeInstanceId;
     nvmlDeviceAttributes_t attributes;
     std::string uuid;
+    InternId uuidId = kEmptyIntern;     // uuid의 인터닝 id
     unsigned long long memorySize;
     unsigned int multiprocessorCount;
     unsigned int maxComputeInstances;
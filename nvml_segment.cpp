@@ -0,0 +1,792 @@
+#include "nvml_segment.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+const char kHeaderMagic[8] = {'N', 'V', 'S', 'E', 'G', '0', '0', '1'};
+const char kTrailerMagic[8] = {'N', 'V', 'S', 'E', 'G', 'E', 'N', 'D'};
+const uint32_t kSegmentVersion = 1;
+const size_t kTrailerBytes = 8 + 4 + 4 + 8;
+
+size_t align8(size_t n) {
+    return (n + 7) & ~static_cast<size_t>(7);
+}
+
+size_t columnCount(HistoryTable table) {
+    return table == HistoryTable::Device ? HM_DEVICE_METRIC_COUNT : HM_METRIC_COUNT - HM_DEVICE_METRIC_COUNT;
+}
+
+// 블록 하나의 열 데이터 크기
+size_t blockBytes(HistoryTable table, size_t rows, uint32_t flags) {
+    size_t bytes = rows * 8 + align8(rows * 4);
+    if (table == HistoryTable::Process) bytes += 2 * align8(rows * 4);
+    bytes += rows * 8 * columnCount(table);
+    if (flags & kSegmentBlockRollup) bytes += align8(rows * 4) + 3 * rows * 8 * columnCount(table);
+    return bytes;
+}
+
+void putColumn(const void* data, size_t bytes, std::string& out) {
+    out.append(static_cast<const char*>(data), bytes);
+    out.append(align8(bytes) - bytes, '\0');
+}
+
+void putString(const std::string& value, std::string& out) {
+    putLE<uint32_t>(static_cast<uint32_t>(value.size()), out);
+    out += value;
+}
+
+// 경계 검사하는 푸터 읽기
+struct FooterReader {
+    const uint8_t* pos;
+    const uint8_t* end;
+    bool ok = true;
+
+    template <typename T>
+    T get() {
+        T value = T();
+        if (static_cast<size_t>(end - pos) < sizeof(T)) {
+            ok = false;
+            return value;
+        }
+        std::memcpy(&value, pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    std::string string() {
+        uint32_t length = get<uint32_t>();
+        if (!ok || static_cast<size_t>(end - pos) < length) {
+            ok = false;
+            return "";
+        }
+        std::string value(reinterpret_cast<const char*>(pos), length);
+        pos += length;
+        return value;
+    }
+};
+
+// 부분 상태를 합칠 때 세그먼트마다 다른 이름 id를 결과 사전 id로 바꾼다
+struct ScanNames {
+    std::vector<std::string> names;
+    std::unordered_map<std::string, uint32_t> ids;
+
+    uint32_t intern(const std::string& name) {
+        auto it = ids.find(name);
+        if (it != ids.end()) return it->second;
+        uint32_t id = static_cast<uint32_t>(names.size());
+        names.push_back(name);
+        ids.emplace(name, id);
+        return id;
+    }
+};
+
+} // namespace
+
+SegmentFile::SegmentFile() : fd(-1), data(nullptr), size(0) {
+}
+
+SegmentFile::~SegmentFile() {
+    close();
+}
+
+void SegmentFile::close() {
+    if (data) {
+        munmap(const_cast<uint8_t*>(data), size);
+        data = nullptr;
+    }
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+    size = 0;
+    info = SegmentInfo();
+}
+
+bool SegmentFile::open(const std::string& path, std::string& error) {
+    close();
+    this->path = path;
+
+    fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        error = path + ": " + std::strerror(errno);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(kHeaderMagic) + kTrailerBytes) {
+        error = path + ": truncated segment";
+        close();
+        return false;
+    }
+    size = static_cast<size_t>(st.st_size);
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+        error = path + ": mmap failed: " + std::strerror(errno);
+        size = 0;
+        close();
+        return false;
+    }
+    data = static_cast<const uint8_t*>(mapped);
+
+    // 트레일러
+    const uint8_t* trailer = data + size - kTrailerBytes;
+    uint64_t footerOffset;
+    uint32_t footerLength;
+    uint32_t version;
+    std::memcpy(&footerOffset, trailer, 8);
+    std::memcpy(&footerLength, trailer + 8, 4);
+    std::memcpy(&version, trailer + 12, 4);
+    if (std::memcmp(data, kHeaderMagic, 8) != 0 || std::memcmp(trailer + 16, kTrailerMagic, 8) != 0) {
+        error = path + ": not a segment file";
+        close();
+        return false;
+    }
+    if (version != kSegmentVersion) {
+        error = path + ": unsupported segment version " + std::to_string(version);
+        close();
+        return false;
+    }
+    if (footerOffset < sizeof(kHeaderMagic) || footerOffset + footerLength != size - kTrailerBytes) {
+        error = path + ": corrupt trailer";
+        close();
+        return false;
+    }
+
+    // 푸터
+    FooterReader reader = {data + footerOffset, data + footerOffset + footerLength};
+    uint32_t table = reader.get<uint32_t>();
+    uint32_t blockCount = reader.get<uint32_t>();
+    info.table = table == 0 ? HistoryTable::Device : HistoryTable::Process;
+    info.minTimestamp = reader.get<int64_t>();
+    info.maxTimestamp = reader.get<int64_t>();
+    info.deviceMask = reader.get<uint64_t>();
+    info.rows = reader.get<uint64_t>();
+    for (uint32_t i = 0; i < blockCount && reader.ok; i++) {
+        SegmentBlockInfo block;
+        block.offset = reader.get<uint64_t>();
+        block.rows = reader.get<uint32_t>();
+        block.flags = reader.get<uint32_t>();
+        block.minTimestamp = reader.get<int64_t>();
+        block.maxTimestamp = reader.get<int64_t>();
+        block.deviceMask = reader.get<uint64_t>();
+        if (block.offset % 8 != 0 || block.offset < sizeof(kHeaderMagic) ||
+            block.offset + blockBytes(info.table, block.rows, block.flags) > footerOffset) {
+            reader.ok = false;
+        }
+        info.blocks.push_back(block);
+    }
+    uint32_t uuidCount = reader.get<uint32_t>();
+    for (uint32_t i = 0; i < uuidCount && reader.ok; i++) {
+        info.uuids.push_back(reader.string());
+    }
+    uint32_t nameCount = reader.get<uint32_t>();
+    for (uint32_t i = 0; i < nameCount && reader.ok; i++) {
+        uint32_t id = reader.get<uint32_t>();
+        info.names.emplace_back(id, reader.string());
+    }
+    if (!reader.ok || table > 1) {
+        error = path + ": corrupt footer";
+        close();
+        return false;
+    }
+
+    // 열은 순서대로 한 번씩 읽는다
+    madvise(mapped, size, MADV_SEQUENTIAL);
+    return true;
+}
+
+SegmentBlockView SegmentFile::block(size_t index) const {
+    const SegmentBlockInfo& block = info.blocks[index];
+    size_t rows = block.rows;
+    const uint8_t* base = data + block.offset;
+
+    SegmentBlockView view;
+    view.rows = rows;
+    view.timestamps = reinterpret_cast<const int64_t*>(base);
+    base += rows * 8;
+    view.devices = reinterpret_cast<const uint32_t*>(base);
+    base += align8(rows * 4);
+    view.pids = nullptr;
+    view.names = nullptr;
+    if (info.table == HistoryTable::Process) {
+        view.pids = reinterpret_cast<const uint32_t*>(base);
+        base += align8(rows * 4);
+        view.names = reinterpret_cast<const uint32_t*>(base);
+        base += align8(rows * 4);
+    }
+    view.values = reinterpret_cast<const double*>(base);
+    base += rows * 8 * columnCount(info.table);
+    view.counts = nullptr;
+    view.sums = nullptr;
+    view.mins = nullptr;
+    view.maxs = nullptr;
+    if (block.flags & kSegmentBlockRollup) {
+        size_t columnBytes = rows * 8 * columnCount(info.table);
+        view.counts = reinterpret_cast<const uint32_t*>(base);
+        base += align8(rows * 4);
+        view.sums = reinterpret_cast<const double*>(base);
+        view.mins = reinterpret_cast<const double*>(base + columnBytes);
+        view.maxs = reinterpret_cast<const double*>(base + 2 * columnBytes);
+    }
+    return view;
+}
+
+bool writeHistorySegment(const std::string& path, HistoryTable table, const std::vector<HistoryBlockPtr>& blocks,
+                         const std::vector<std::string>& uuids, const std::vector<std::string>& names,
+                         std::string& error, RateLimiter* limiter) {
+    std::string out;
+    size_t total = sizeof(kHeaderMagic);
+    for (const auto& block : blocks) {
+        total += blockBytes(table, block->rows(), block->rollup() ? kSegmentBlockRollup : 0);
+    }
+    out.reserve(total + 4096);
+    out.append(kHeaderMagic, sizeof(kHeaderMagic));
+
+    std::string footer;
+    SegmentInfo info;
+    std::vector<uint32_t> nameIds;
+    for (const auto& block : blocks) {
+        size_t rows = block->rows();
+        putLE<uint64_t>(out.size(), footer);
+        putLE<uint32_t>(static_cast<uint32_t>(rows), footer);
+        putLE<uint32_t>(block->rollup() ? kSegmentBlockRollup : 0, footer);
+        putLE<int64_t>(block->minTimestamp, footer);
+        putLE<int64_t>(block->maxTimestamp, footer);
+        putLE<uint64_t>(block->deviceMask, footer);
+
+        putColumn(block->timestamps.data(), rows * 8, out);
+        putColumn(block->devices.data(), rows * 4, out);
+        if (table == HistoryTable::Process) {
+            putColumn(block->pids.data(), rows * 4, out);
+            putColumn(block->names.data(), rows * 4, out);
+            nameIds.insert(nameIds.end(), block->names.begin(), block->names.end());
+        }
+        for (const auto& column : block->values) {
+            putColumn(column.data(), rows * 8, out);
+        }
+        if (block->rollup()) {
+            putColumn(block->counts.data(), rows * 4, out);
+            for (const auto* rollupColumns : {&block->sums, &block->mins, &block->maxs}) {
+                for (const auto& column : *rollupColumns) {
+                    putColumn(column.data(), rows * 8, out);
+                }
+            }
+        }
+
+        info.minTimestamp = std::min(info.minTimestamp, block->minTimestamp);
+        info.maxTimestamp = std::max(info.maxTimestamp, block->maxTimestamp);
+        info.deviceMask |= block->deviceMask;
+        info.rows += rows;
+    }
+
+    std::sort(nameIds.begin(), nameIds.end());
+    nameIds.erase(std::unique(nameIds.begin(), nameIds.end()), nameIds.end());
+
+    uint64_t footerOffset = out.size();
+    putLE<uint32_t>(table == HistoryTable::Device ? 0 : 1, out);
+    putLE<uint32_t>(static_cast<uint32_t>(blocks.size()), out);
+    putLE<int64_t>(info.minTimestamp, out);
+    putLE<int64_t>(info.maxTimestamp, out);
+    putLE<uint64_t>(info.deviceMask, out);
+    putLE<uint64_t>(info.rows, out);
+    out += footer;
+    putLE<uint32_t>(static_cast<uint32_t>(uuids.size()), out);
+    for (const auto& uuid : uuids) {
+        putString(uuid, out);
+    }
+    putLE<uint32_t>(static_cast<uint32_t>(nameIds.size()), out);
+    for (uint32_t id : nameIds) {
+        putLE<uint32_t>(id, out);
+        putString(id < names.size() ? names[id] : "", out);
+    }
+    putLE<uint64_t>(footerOffset, out);
+    putLE<uint32_t>(static_cast<uint32_t>(out.size() - footerOffset - 8), out);
+    putLE<uint32_t>(kSegmentVersion, out);
+    out.append(kTrailerMagic, sizeof(kTrailerMagic));
+
+    // 임시 파일에 다 쓰고 fsync 후 rename (스캐너는 완성된 세그먼트만 본다)
+    std::string temporary = path + ".tmp";
+    int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        error = temporary + ": " + std::strerror(errno);
+        return false;
+    }
+    const size_t kWriteChunk = 1024 * 1024;
+    size_t written = 0;
+    while (written < out.size()) {
+        size_t chunk = std::min(out.size() - written, kWriteChunk);
+        if (limiter) limiter->acquire(chunk);
+        ssize_t n = ::write(fd, out.data() + written, chunk);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        written += static_cast<size_t>(n);
+    }
+    bool ok = written == out.size() && fsync(fd) == 0;
+    if (!ok) error = temporary + ": " + std::strerror(errno);
+    ::close(fd);
+    if (ok && std::rename(temporary.c_str(), path.c_str()) != 0) {
+        error = path + ": " + std::strerror(errno);
+        ok = false;
+    }
+    if (!ok) ::unlink(temporary.c_str());
+    return ok;
+}
+
+SegmentStore::SegmentStore(const MetricHistory& history, const SegmentStoreConfig& config)
+    : config(config), history(history), sequence(0), stats{} {
+    this->config.blocksPerSegment = std::max<size_t>(this->config.blocksPerSegment, 1);
+}
+
+bool describeSegment(const std::string& directory, const std::string& file, uint32_t tier, SegmentEntry& entry,
+                     std::string& error) {
+    SegmentFile segment;
+    if (!segment.open(directory + "/" + file, error)) return false;
+    const SegmentInfo& info = segment.getInfo();
+    entry.file = file;
+    entry.tier = tier;
+    entry.table = info.table;
+    entry.minTimestamp = info.minTimestamp;
+    entry.maxTimestamp = info.maxTimestamp;
+    entry.rows = info.rows;
+    entry.bytes = segment.bytes();
+    return true;
+}
+
+bool SegmentStore::open() {
+    if (mkdir(config.directory.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::cerr << "Failed to create segment directory " << config.directory << ": " << std::strerror(errno)
+                  << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    bool found = false;
+    if (!loadManifest(found)) {
+        std::cerr << "Ignoring corrupt segment manifest in " << config.directory << std::endl;
+        entries.clear();
+        found = false;
+    }
+
+    // 매니페스트와 디렉터리 맞추기
+    std::vector<std::string> files;
+    if (DIR* dir = opendir(config.directory.c_str())) {
+        while (dirent* entry = readdir(dir)) {
+            files.push_back(entry->d_name);
+        }
+        closedir(dir);
+    }
+    std::sort(files.begin(), files.end());
+
+    // 교체되어 지울 차례였던 파일 (진행 중인 스캔이 없으니 바로 지운다)
+    bool changed = !found || !obsolete.empty();
+    for (const auto& entry : obsolete) {
+        ::unlink(path(entry.file).c_str());
+    }
+    obsolete.clear();
+    size_t listedCount = entries.size();
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [&files](const SegmentEntry& entry) {
+                                     return !std::binary_search(files.begin(), files.end(), entry.file);
+                                 }),
+                  entries.end());
+    changed = changed || entries.size() != listedCount;
+
+    for (const auto& file : files) {
+        bool temporary = file.size() > 4 && file.compare(file.size() - 4, 4, ".tmp") == 0;
+        bool segment = file.size() > 4 && file.compare(file.size() - 4, 4, ".seg") == 0;
+        if (temporary) {
+            ::unlink(path(file).c_str());
+            continue;
+        }
+        if (!segment) continue;
+        bool listed = std::any_of(entries.begin(), entries.end(),
+                                  [&file](const SegmentEntry& entry) { return entry.file == file; });
+        if (listed) continue;
+
+        // 압축 결과가 목록에 없으면 입력이 아직 목록에 있으므로 중복이다.
+        // 원본 세그먼트는 파일을 쓰고 목록에 넣기 전에 죽은 경우이므로 살린다
+        if (found && file.compare(0, 8, "compact-") == 0) {
+            ::unlink(path(file).c_str());
+            continue;
+        }
+        SegmentEntry entry;
+        std::string error;
+        if (!describeSegment(config.directory, file, 0, entry, error)) {
+            std::cerr << "Ignoring segment: " << error << std::endl;
+            continue;
+        }
+        entries.push_back(entry);
+        changed = true;
+    }
+    if (changed) saveManifest();
+    return true;
+}
+
+bool SegmentStore::loadManifest(bool& found) {
+    found = false;
+    std::FILE* file = std::fopen(path("MANIFEST").c_str(), "r");
+    if (!file) return errno == ENOENT;
+    found = true;
+
+    // nvml-segments 1
+    // sequence <n>
+    // <파일> <tier> <table> <min> <max> <rows> <bytes>
+    // - <파일>   (목록에서 빠졌고 아직 지우지 않은 파일)
+    char line[512];
+    int version = 0;
+    unsigned long long nextSequence = 0;
+    bool ok = std::fgets(line, sizeof(line), file) && std::sscanf(line, "nvml-segments %d", &version) == 1 &&
+              version == 1 && std::fgets(line, sizeof(line), file) &&
+              std::sscanf(line, "sequence %llu", &nextSequence) == 1;
+    while (ok && std::fgets(line, sizeof(line), file)) {
+        char name[256];
+        if (std::sscanf(line, "- %255s", name) == 1) {
+            obsolete.push_back({name, std::chrono::steady_clock::now()});
+            continue;
+        }
+        SegmentEntry entry;
+        unsigned int table;
+        long long minTimestamp, maxTimestamp;
+        unsigned long long rows, bytes;
+        if (std::sscanf(line, "%255s %u %u %lld %lld %llu %llu", name, &entry.tier, &table, &minTimestamp,
+                        &maxTimestamp, &rows, &bytes) != 7 || table > 1) {
+            ok = false;
+            break;
+        }
+        entry.file = name;
+        entry.table = table == 0 ? HistoryTable::Device : HistoryTable::Process;
+        entry.minTimestamp = minTimestamp;
+        entry.maxTimestamp = maxTimestamp;
+        entry.rows = rows;
+        entry.bytes = bytes;
+        entries.push_back(entry);
+    }
+    std::fclose(file);
+    sequence = std::max<uint64_t>(sequence, nextSequence);
+    return ok;
+}
+
+bool SegmentStore::saveManifest() {
+    std::string out = "nvml-segments 1\nsequence " + std::to_string(sequence) + "\n";
+    for (const auto& entry : entries) {
+        char line[512];
+        std::snprintf(line, sizeof(line), "%s %u %u %lld %lld %llu %llu\n", entry.file.c_str(), entry.tier,
+                      entry.table == HistoryTable::Device ? 0u : 1u, static_cast<long long>(entry.minTimestamp),
+                      static_cast<long long>(entry.maxTimestamp), static_cast<unsigned long long>(entry.rows),
+                      static_cast<unsigned long long>(entry.bytes));
+        out += line;
+    }
+    for (const auto& entry : obsolete) {
+        out += "- " + entry.file + "\n";
+    }
+
+    std::string temporary = path("MANIFEST.tmp");
+    int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    bool ok = fd >= 0 && ::write(fd, out.data(), out.size()) == static_cast<ssize_t>(out.size()) && fsync(fd) == 0;
+    if (fd >= 0) ::close(fd);
+    ok = ok && std::rename(temporary.c_str(), path("MANIFEST").c_str()) == 0;
+    if (!ok) {
+        std::cerr << "Failed to write segment manifest: " << std::strerror(errno) << std::endl;
+        ::unlink(temporary.c_str());
+        return false;
+    }
+    // rename을 디스크에 남긴다
+    int dirFd = ::open(config.directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd >= 0) {
+        fsync(dirFd);
+        ::close(dirFd);
+    }
+    stats.manifestSwaps++;
+    return true;
+}
+
+void SegmentStore::add(const HistoryBlockPtr& block) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& blocks = pending[static_cast<int>(block->table)];
+    blocks.push_back(block);
+    if (blocks.size() >= config.blocksPerSegment) writeSegment(block->table);
+}
+
+void SegmentStore::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    writeSegment(HistoryTable::Device);
+    writeSegment(HistoryTable::Process);
+}
+
+std::string SegmentStore::nextFile(const std::string& prefix, HistoryTable table, int64_t minTimestamp) {
+    // <접두어><테이블>-<첫 시각>-<순번>.seg: 이름 순이 대략 시간 순
+    char name[128];
+    std::snprintf(name, sizeof(name), "%s%s-%013lld-%06llu.seg", prefix.c_str(),
+                  table == HistoryTable::Device ? "device" : "process", static_cast<long long>(minTimestamp),
+                  static_cast<unsigned long long>(sequence++));
+    return name;
+}
+
+std::string SegmentStore::reserveFile(const std::string& prefix, HistoryTable table, int64_t minTimestamp) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return nextFile(prefix, table, minTimestamp);
+}
+
+void SegmentStore::writeSegment(HistoryTable table) {
+    auto& blocks = pending[static_cast<int>(table)];
+    if (blocks.empty()) return;
+
+    std::string file = nextFile("", table, blocks.front()->minTimestamp);
+    std::string error;
+    SegmentEntry entry;
+    if (writeHistorySegment(path(file), table, blocks, history.deviceUuids(), history.processNames(), error) &&
+        describeSegment(config.directory, file, 0, entry, error)) {
+        entries.push_back(entry);
+        saveManifest();
+        stats.segmentsWritten++;
+        stats.blocksWritten += blocks.size();
+        stats.bytesWritten += entry.bytes;
+    } else {
+        std::cerr << "Failed to write history segment: " << error << std::endl;
+        stats.writeErrors++;
+    }
+    blocks.clear();
+}
+
+bool SegmentStore::replace(const std::vector<std::string>& removed, const std::vector<SegmentEntry>& added) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& file : removed) {
+        if (std::none_of(entries.begin(), entries.end(),
+                         [&file](const SegmentEntry& entry) { return entry.file == file; })) {
+            return false;
+        }
+    }
+
+    std::vector<SegmentEntry> previous = entries;
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [&removed](const SegmentEntry& entry) {
+                                     return std::find(removed.begin(), removed.end(), entry.file) != removed.end();
+                                 }),
+                  entries.end());
+    entries.insert(entries.end(), added.begin(), added.end());
+    std::stable_sort(entries.begin(), entries.end(), [](const SegmentEntry& a, const SegmentEntry& b) {
+        return a.minTimestamp < b.minTimestamp;
+    });
+    size_t obsoleteCount = obsolete.size();
+    auto now = std::chrono::steady_clock::now();
+    for (const auto& file : removed) {
+        obsolete.push_back({file, now});
+    }
+    if (!saveManifest()) {
+        entries.swap(previous);
+        obsolete.resize(obsoleteCount);
+        return false;
+    }
+    return true;
+}
+
+void SegmentStore::deleteObsolete(int64_t delayMs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto cutoff = std::chrono::steady_clock::now() - std::chrono::milliseconds(delayMs);
+    size_t deleted = 0;
+    auto it = obsolete.begin();
+    while (it != obsolete.end()) {
+        if (it->since > cutoff) {
+            ++it;
+            continue;
+        }
+        ::unlink(path(it->file).c_str());
+        stats.segmentsDeleted++;
+        deleted++;
+        it = obsolete.erase(it);
+    }
+    // 지운 파일을 매니페스트에서도 뺀다 (실패해도 다음 open에서 없는 파일로 넘어간다)
+    if (deleted > 0) saveManifest();
+}
+
+std::vector<std::string> SegmentStore::segments() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::string> paths;
+    for (const auto& entry : entries) {
+        paths.push_back(path(entry.file));
+    }
+    return paths;
+}
+
+std::vector<SegmentEntry> SegmentStore::manifest() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries;
+}
+
+int64_t SegmentStore::persistedUntil(HistoryTable table) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    int64_t until = INT64_MIN;
+    for (const auto& entry : entries) {
+        if (entry.table == table) until = std::max(until, entry.maxTimestamp);
+    }
+    return until;
+}
+
+SegmentStoreStats SegmentStore::getStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+SegmentScanner::SegmentScanner(unsigned int threads) : threads(threads) {
+    if (this->threads == 0) this->threads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+bool SegmentScanner::scan(const std::vector<std::string>& paths, const HistoryQuery& query,
+                          SegmentScanResult& result, std::string& error) const {
+    auto started = std::chrono::steady_clock::now();
+    result = SegmentScanResult();
+    SegmentScanStats& stats = result.stats;
+
+    HistoryAccumulator prototype;
+    if (!prototype.init(query, error)) return false;
+    HistoryTable table = prototype.getTable();
+    int column = prototype.getColumn();
+
+    // 1) 푸터만 읽어 세그먼트를 거른다 (테이블, 시각 범위, 디바이스)
+    std::vector<std::unique_ptr<SegmentFile>> files;
+    stats.segments = paths.size();
+    for (const auto& path : paths) {
+        auto file = std::make_unique<SegmentFile>();
+        std::string openError;
+        if (!file->open(path, openError)) {
+            std::cerr << "Skipping segment: " << openError << std::endl;
+            stats.segmentsCorrupt++;
+            continue;
+        }
+        const SegmentInfo& info = file->getInfo();
+        if (info.table != table || info.maxTimestamp < query.start || info.minTimestamp >= query.end ||
+            !(info.deviceMask & query.deviceMask)) {
+            stats.segmentsPruned++;
+            continue;
+        }
+        files.push_back(std::move(file));
+    }
+
+    // 2) 블록 단위 작업 목록과 세그먼트별 이름 id 변환표
+    struct WorkItem {
+        size_t file;
+        size_t block;
+    };
+    std::vector<WorkItem> work;
+    std::vector<std::vector<uint32_t>> nameMaps(files.size());
+    ScanNames names;
+    for (size_t f = 0; f < files.size(); f++) {
+        const SegmentInfo& info = files[f]->getInfo();
+        stats.bytesMapped += files[f]->bytes();
+        for (const auto& entry : info.names) {
+            std::vector<uint32_t>& map = nameMaps[f];
+            if (entry.first >= map.size()) map.resize(entry.first + 1, 0);
+            map[entry.first] = names.intern(entry.second);
+        }
+        for (size_t b = 0; b < info.blocks.size(); b++) {
+            const SegmentBlockInfo& block = info.blocks[b];
+            if (block.maxTimestamp < query.start || block.minTimestamp >= query.end ||
+                !(block.deviceMask & query.deviceMask)) {
+                stats.blocksPruned++;
+                continue;
+            }
+            work.push_back({f, b});
+        }
+        // 가장 최근 세그먼트의 UUID 사전
+        if (info.uuids.size() >= result.uuids.size()) result.uuids = info.uuids;
+    }
+    stats.blocksScanned = work.size();
+
+    // 3) 스레드별 부분 상태. 블록은 원자 카운터로 나눠 가져간다 (크기가 달라도 균형이 맞도록)
+    unsigned int threadCount = static_cast<unsigned int>(std::min<size_t>(threads, std::max<size_t>(work.size(), 1)));
+    stats.threads = threadCount;
+    std::vector<HistoryAccumulator> partials(threadCount);
+    std::vector<uint64_t> rowCounts(threadCount, 0);
+    std::atomic<size_t> nextItem(0);
+    std::atomic<size_t> corruptBlocks(0);
+
+    auto worker = [&](unsigned int id) {
+        HistoryAccumulator& accumulator = partials[id];
+        std::string ignored;
+        accumulator.init(query, ignored);
+        while (true) {
+            size_t index = nextItem.fetch_add(1, std::memory_order_relaxed);
+            if (index >= work.size()) break;
+            const WorkItem& item = work[index];
+            SegmentBlockView view = files[item.file]->block(item.block);
+            const std::vector<uint32_t>& nameMap = nameMaps[item.file];
+
+            HistoryRows rows;
+            rows.count = view.rows;
+            rows.timestamps = view.timestamps;
+            rows.devices = view.devices;
+            rows.pids = view.pids;
+            rows.names = view.names;
+            rows.values = view.values + static_cast<size_t>(column) * view.rows;
+            if (view.counts) {
+                rows.counts = view.counts;
+                rows.sums = view.sums + static_cast<size_t>(column) * view.rows;
+                rows.mins = view.mins + static_cast<size_t>(column) * view.rows;
+                rows.maxs = view.maxs + static_cast<size_t>(column) * view.rows;
+            }
+            if (table == HistoryTable::Process) {
+                // 사전에 없는 이름 id가 있으면 손상된 블록
+                uint32_t maxName = 0;
+                for (size_t i = 0; i < view.rows; i++) maxName = std::max(maxName, view.names[i]);
+                if (maxName >= nameMap.size()) {
+                    corruptBlocks++;
+                    continue;
+                }
+                rows.nameMap = nameMap.data();
+            }
+            accumulator.add(rows);
+            rowCounts[id] += view.rows;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned int i = 1; i < threadCount; i++) {
+        pool.emplace_back(worker, i);
+    }
+    worker(0);
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    // 4) 병합
+    for (unsigned int i = 1; i < threadCount; i++) {
+        partials[0].merge(partials[i]);
+    }
+    for (uint64_t rows : rowCounts) {
+        stats.rowsScanned += rows;
+    }
+    stats.blocksCorrupt = corruptBlocks;
+    if (!partials[0].finish(result.series, error)) return false;
+    result.names = std::move(names.names);
+
+    stats.elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+    return true;
+}
+
+void registerSegmentScanApi(HttpServer& server, const MetricHistory& history, const SegmentStore& store,
+                            const std::string& path) {
+    server.route(path, [&history, &store](const HttpRequest& request, HttpResponse& response) {
+        HistoryQuery query;
+        std::string error;
+        SegmentScanResult result;
+        response.contentType = "application/json";
+        if (!parseHistoryQuery(request, history, query, error) ||
+            !SegmentScanner().scan(store.segments(), query, result, error)) {
+            response.status = 400;
+            response.body = errorJson(error);
+            return;
+        }
+        appendHistoryJson(query, result.series, result.uuids, result.names, response.body);
+    });
+}
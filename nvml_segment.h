@@ -0,0 +1,204 @@
+#ifndef NVML_SEGMENT_H
+#define NVML_SEGMENT_H
+
+#include "nvml_history.h"
+#include "nvml_spool.h"
+
+// 히스토리 세그먼트 파일: 봉인된 HistoryBlock 여러 개를 열 단위 그대로 담은 불변 파일
+//   헤더     "NVSEG001"
+//   블록들   timestamps i64[rows], devices u32[rows], (Process: pids u32[rows], names u32[rows]),
+//            values f64[rows] x 열 수. 열마다 8바이트 정렬
+//            다운샘플 블록(플래그 rollup)은 뒤에 counts u32[rows], sums/mins/maxs f64[rows] x 열 수가 더 붙는다
+//   푸터     테이블, 세그먼트/블록별 시각 min/max와 디바이스 마스크, UUID 사전, 이름 사전
+//   트레일러 u64 footerOffset, u32 footerLength, u32 version, "NVSEGEND"
+// 스캐너는 트레일러와 푸터만 읽어 세그먼트/블록을 거르고 남은 열을 mmap 그대로 읽는다
+
+const uint32_t kSegmentBlockRollup = 1;   // 블록 플래그: 버킷별 count/sum/min/max 열이 있다
+
+struct SegmentBlockInfo {
+    uint64_t offset;  // 파일 안에서 열 데이터 시작
+    uint32_t rows;
+    uint32_t flags;
+    int64_t minTimestamp;
+    int64_t maxTimestamp;
+    uint64_t deviceMask;
+};
+
+struct SegmentInfo {
+    HistoryTable table = HistoryTable::Device;
+    int64_t minTimestamp = INT64_MAX;
+    int64_t maxTimestamp = INT64_MIN;
+    uint64_t deviceMask = 0;
+    uint64_t rows = 0;
+    std::vector<SegmentBlockInfo> blocks;
+    std::vector<std::string> uuids;                              // 디바이스 인덱스 -> UUID
+    std::vector<std::pair<uint32_t, std::string>> names;         // 이름 id -> 프로세스 이름 (id 순)
+};
+
+// 블록 열 포인터 (mmap 영역을 가리킨다)
+struct SegmentBlockView {
+    size_t rows;
+    const int64_t* timestamps;
+    const uint32_t* devices;
+    const uint32_t* pids;   // Process
+    const uint32_t* names;  // Process
+    const double* values;   // 열 c는 values + c * rows
+    const uint32_t* counts; // 다운샘플 블록만 (아니면 nullptr), 아래 세 열도 열 c는 + c * rows
+    const double* sums;
+    const double* mins;
+    const double* maxs;
+};
+
+// 읽기 전용 mmap 세그먼트
+class SegmentFile {
+private:
+    std::string path;
+    int fd;
+    const uint8_t* data;
+    size_t size;
+    SegmentInfo info;
+
+public:
+    SegmentFile();
+    ~SegmentFile();
+    SegmentFile(const SegmentFile&) = delete;
+    SegmentFile& operator=(const SegmentFile&) = delete;
+
+    // 트레일러/푸터를 검증하고 읽는다. 잘린 파일이나 다른 버전이면 false
+    bool open(const std::string& path, std::string& error);
+    void close();
+
+    const std::string& getPath() const { return path; }
+    const SegmentInfo& getInfo() const { return info; }
+    size_t bytes() const { return size; }
+    SegmentBlockView block(size_t index) const;
+};
+
+// 블록들을 세그먼트 파일로 쓴다 (임시 파일 + fsync + rename)
+// names는 MetricHistory 이름 사전 전체이고, 블록이 참조하는 id만 푸터에 들어간다
+// limiter가 있으면 1MB씩 나눠 쓰며 쓰기 속도를 제한한다
+bool writeHistorySegment(const std::string& path, HistoryTable table, const std::vector<HistoryBlockPtr>& blocks,
+                         const std::vector<std::string>& uuids, const std::vector<std::string>& names,
+                         std::string& error, RateLimiter* limiter = nullptr);
+
+struct SegmentStoreConfig {
+    std::string directory;
+    size_t blocksPerSegment = 8;
+};
+
+struct SegmentStoreStats {
+    uint64_t segmentsWritten;
+    uint64_t blocksWritten;
+    uint64_t bytesWritten;
+    uint64_t writeErrors;
+    uint64_t manifestSwaps;
+    uint64_t segmentsDeleted;
+};
+
+// 매니페스트 항목 (살아 있는 세그먼트)
+struct SegmentEntry {
+    std::string file;             // 디렉터리 안 파일 이름
+    uint32_t tier = 0;            // 0 = 원본, 1.. = 다운샘플 단계
+    HistoryTable table = HistoryTable::Device;
+    int64_t minTimestamp = 0;
+    int64_t maxTimestamp = 0;
+    uint64_t rows = 0;
+    uint64_t bytes = 0;
+};
+
+// 봉인된 히스토리 블록을 세그먼트 파일로 모은다 (MetricHistory::setSealCallback에 연결)
+// 살아 있는 세그먼트 목록은 디렉터리의 MANIFEST가 정한다. 매니페스트는 임시 파일 + rename으로 통째로 바꾸므로
+// 중간에 죽어도 이전 목록이나 새 목록 중 하나만 보인다. 목록에서 빠진 파일은 진행 중인 스캔이 끝나도록
+// 잠시 뒤에 지운다
+class SegmentStore {
+private:
+    struct Obsolete {
+        std::string file;
+        std::chrono::steady_clock::time_point since;
+    };
+
+    SegmentStoreConfig config;
+    const MetricHistory& history;
+
+    mutable std::mutex mutex;
+    std::vector<HistoryBlockPtr> pending[2]; // 테이블별
+    std::vector<SegmentEntry> entries;       // 매니페스트
+    std::vector<Obsolete> obsolete;
+    uint64_t sequence;
+    SegmentStoreStats stats;
+
+public:
+    SegmentStore(const MetricHistory& history, const SegmentStoreConfig& config);
+
+    // 디렉터리 생성, 매니페스트 읽기. 매니페스트에 없는 원본 세그먼트는 목록에 넣고
+    // (목록에 넣기 전에 죽은 경우), 없는 압축 결과와 임시 파일은 지운다
+    bool open();
+    void add(const HistoryBlockPtr& block);
+    void flush();                       // 모자란 블록도 세그먼트로 쓴다
+
+    std::vector<std::string> segments() const;   // 살아 있는 세그먼트 경로
+    std::vector<SegmentEntry> manifest() const;
+    // 세그먼트 파일에 들어간 행의 최대 시각 (없으면 INT64_MIN). 블록은 틱 경계에서 봉인되므로
+    // 이 시각 이하의 행은 모두 파일에 있다
+    int64_t persistedUntil(HistoryTable table) const;
+    std::string path(const std::string& file) const { return config.directory + "/" + file; }
+    const std::string& directory() const { return config.directory; }
+
+    // 압축기용: 새 파일 이름 예약, 목록 교체 (removed는 모두 목록에 있어야 한다)
+    std::string reserveFile(const std::string& prefix, HistoryTable table, int64_t minTimestamp);
+    bool replace(const std::vector<std::string>& removed, const std::vector<SegmentEntry>& added);
+    // 목록에서 빠진 지 delayMs가 지난 파일 삭제
+    void deleteObsolete(int64_t delayMs);
+
+    SegmentStoreStats getStats();
+
+private:
+    void writeSegment(HistoryTable table);
+    bool loadManifest(bool& found);
+    bool saveManifest();
+    std::string nextFile(const std::string& prefix, HistoryTable table, int64_t minTimestamp);
+};
+
+// 파일 푸터로 매니페스트 항목을 만든다
+bool describeSegment(const std::string& directory, const std::string& file, uint32_t tier, SegmentEntry& entry,
+                     std::string& error);
+
+struct SegmentScanStats {
+    size_t segments;
+    size_t segmentsPruned;
+    size_t segmentsCorrupt;
+    size_t blocksScanned;
+    size_t blocksPruned;
+    size_t blocksCorrupt;
+    uint64_t rowsScanned;
+    uint64_t bytesMapped;
+    unsigned int threads;
+    double elapsedMs;
+};
+
+struct SegmentScanResult {
+    std::vector<HistorySeries> series;  // nameId는 names 인덱스
+    std::vector<std::string> uuids;
+    std::vector<std::string> names;
+    SegmentScanStats stats;
+};
+
+// 병렬 세그먼트 스캐너
+// 푸터의 시각/디바이스 범위로 세그먼트와 블록을 거르고, 남은 블록을 스레드들이 나눠 집계한 뒤
+// 스레드별 부분 상태(버킷별 sum/count/min/max/last, 분위수는 표본)를 마지막에 합친다
+class SegmentScanner {
+private:
+    unsigned int threads;
+
+public:
+    explicit SegmentScanner(unsigned int threads = 0); // 0이면 코어 수
+
+    bool scan(const std::vector<std::string>& paths, const HistoryQuery& query, SegmentScanResult& result,
+              std::string& error) const;
+};
+
+// HTTP API (/api/scan). 파라미터와 JSON 형식은 /api/query와 같다
+void registerSegmentScanApi(HttpServer& server, const MetricHistory& history, const SegmentStore& store,
+                            const std::string& path = "/api/scan");
+
+#endif // NVML_SEGMENT_H
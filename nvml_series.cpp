@@ -0,0 +1,469 @@
+#include "nvml_series.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+const uintptr_t kTombstone = 1;     // 색인에서 지운 칸 (탐색은 계속한다)
+const unsigned int kMaxShards = 256;
+const uint32_t kGenerationMask = 0xFFFFFF;
+
+uint64_t mix(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+template <typename T>
+bool isTombstone(T* pointer) {
+    return reinterpret_cast<uintptr_t>(pointer) == kTombstone;
+}
+
+size_t tableCapacity(size_t live) {
+    size_t capacity = 16;
+    while (capacity < live * 4) capacity <<= 1;
+    return capacity;
+}
+
+void appendLabelValue(const std::string& value, std::string& out) {
+    for (char c : value) {
+        if (c == '\\' || c == '"') {
+            out.push_back('\\');
+            out.push_back(c);
+        } else if (c == '\n') {
+            out += "\\n";
+        } else {
+            out.push_back(c);
+        }
+    }
+}
+
+// 레이블 이름순 자리에 넣는다 (같은 이름이 있으면 값만 바꾼다)
+void putLabel(std::vector<SeriesLabel>& labels, const SeriesLabel& entry) {
+    auto it = std::lower_bound(labels.begin(), labels.end(), entry,
+                               [](const SeriesLabel& a, const SeriesLabel& b) { return a.name < b.name; });
+    if (it != labels.end() && it->name == entry.name) {
+        *it = entry;
+    } else {
+        labels.insert(it, entry);
+    }
+}
+
+} // namespace
+
+SeriesKey::SeriesKey(std::string_view metric) : metric(internString(metric)) {}
+
+SeriesKey& SeriesKey::label(std::string_view name, std::string_view value) {
+    SeriesLabel entry;
+    entry.name = internString(name);
+    entry.value = internString(value);
+    putLabel(labels, entry);
+    return *this;
+}
+
+SeriesKey& SeriesKey::label(std::string_view name, unsigned long long value) {
+    SeriesLabel entry;
+    entry.name = internString(name);
+    entry.numeric = true;
+    entry.number = value;
+    putLabel(labels, entry);
+    return *this;
+}
+
+uint64_t SeriesKey::hash() const {
+    uint64_t h = mix(metric);
+    for (const auto& entry : labels) {
+        h = mix(h ^ ((static_cast<uint64_t>(entry.name) << 32) | entry.value));
+        if (entry.numeric) h = mix(h ^ entry.number);
+    }
+    return h;
+}
+
+bool SeriesKey::operator==(const SeriesKey& other) const {
+    if (metric != other.metric || labels.size() != other.labels.size()) return false;
+    for (size_t i = 0; i < labels.size(); i++) {
+        const SeriesLabel& a = labels[i];
+        const SeriesLabel& b = other.labels[i];
+        if (a.name != b.name || a.value != b.value || a.numeric != b.numeric || a.number != b.number) return false;
+    }
+    return true;
+}
+
+SeriesRegistry::Shard::Shard() {
+    for (auto& chunk : chunks) {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+SeriesRegistry::SeriesRegistry(const SeriesRegistryConfig& config)
+    : config(config), shardBits(0), created(0), swept(0), removed(0), running(false) {
+    unsigned int count = 1;
+    while (count < std::min(std::max(config.shards, 1u), kMaxShards)) {
+        count <<= 1;
+        shardBits++;
+    }
+    shards.reset(new Shard[count]);
+}
+
+SeriesRegistry::~SeriesRegistry() {
+    stop();
+    for (unsigned int i = 0; i < (1u << shardBits); i++) {
+        Shard& shard = shards[i];
+        for (uint32_t slot = 0; slot < shard.nextSlot; slot++) {
+            std::atomic<Series*>* chunk = shard.chunks[slot >> kChunkBits].load(std::memory_order_relaxed);
+            if (chunk) delete chunk[slot & (kChunkSize - 1)].load(std::memory_order_relaxed);
+        }
+        for (auto& chunk : shard.chunks) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+        for (Series* series : shard.retired) delete series;
+        for (Table* table : shard.retiredTables) delete table;
+        delete shard.table.load(std::memory_order_relaxed);
+    }
+}
+
+SeriesRegistry::Shard* SeriesRegistry::shardFor(SeriesId id) const {
+    unsigned int index = static_cast<unsigned int>(id & 0xFF);
+    if (id == kInvalidSeriesId || index >= (1u << shardBits)) return nullptr;
+    return &shards[index];
+}
+
+SeriesRegistry::Series* SeriesRegistry::lookup(Shard& shard, const SeriesKey& key, uint64_t hash) const {
+    Table* table = shard.table.load(std::memory_order_acquire);
+    if (!table) return nullptr;
+    size_t index = hash & table->mask;
+    for (size_t probes = 0; probes <= table->mask; probes++) {
+        Series* series = table->slots[index].load(std::memory_order_acquire);
+        if (!series) return nullptr;
+        if (!isTombstone(series) && series->hash == hash && series->key == key) return series;
+        index = (index + 1) & table->mask;
+    }
+    return nullptr;
+}
+
+SeriesRegistry::Series* SeriesRegistry::resolve(Shard& shard, SeriesId id) const {
+    uint32_t slot = static_cast<uint32_t>(id >> 8);
+    if ((slot >> kChunkBits) >= kMaxChunks) return nullptr;
+    std::atomic<Series*>* chunk = shard.chunks[slot >> kChunkBits].load(std::memory_order_acquire);
+    if (!chunk) return nullptr;
+    Series* series = chunk[slot & (kChunkSize - 1)].load(std::memory_order_acquire);
+    return series && series->id == id ? series : nullptr;
+}
+
+void SeriesRegistry::rebuild(Shard& shard, size_t capacity) {
+    Table* old = shard.table.load(std::memory_order_relaxed);
+    Table* table = new Table;
+    table->mask = capacity - 1;
+    table->slots.reset(new std::atomic<Series*>[capacity]);
+    for (size_t i = 0; i < capacity; i++) {
+        table->slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+    table->used = 0;
+    table->tombstones = 0;
+    if (old) {
+        for (size_t i = 0; i <= old->mask; i++) {
+            Series* series = old->slots[i].load(std::memory_order_relaxed);
+            if (!series || isTombstone(series)) continue;
+            size_t index = series->hash & table->mask;
+            while (table->slots[index].load(std::memory_order_relaxed)) {
+                index = (index + 1) & table->mask;
+            }
+            table->slots[index].store(series, std::memory_order_relaxed);
+            table->used++;
+        }
+        shard.retiredTables.push_back(old);   // 읽는 쪽이 아직 옛 색인을 탐색하고 있을 수 있다
+    }
+    shard.table.store(table, std::memory_order_release);
+}
+
+void SeriesRegistry::insert(Shard& shard, Series* series) {
+    Table* table = shard.table.load(std::memory_order_relaxed);
+    if (!table || (table->used + 1) * 2 > table->mask + 1) {
+        rebuild(shard, tableCapacity(shard.live + 1));
+        table = shard.table.load(std::memory_order_relaxed);
+    }
+
+    size_t index = series->hash & table->mask;
+    size_t tombstone = SIZE_MAX;
+    while (Series* existing = table->slots[index].load(std::memory_order_relaxed)) {
+        if (isTombstone(existing) && tombstone == SIZE_MAX) tombstone = index;
+        index = (index + 1) & table->mask;
+    }
+    if (tombstone != SIZE_MAX) {
+        index = tombstone;
+        table->tombstones--;
+    } else {
+        table->used++;
+    }
+    table->slots[index].store(series, std::memory_order_release);
+}
+
+void SeriesRegistry::unlink(Shard& shard, Series* series) {
+    Table* table = shard.table.load(std::memory_order_relaxed);
+    size_t index = series->hash & table->mask;
+    while (table->slots[index].load(std::memory_order_relaxed) != series) {
+        index = (index + 1) & table->mask;
+    }
+    table->slots[index].store(reinterpret_cast<Series*>(kTombstone), std::memory_order_release);
+    table->tombstones++;
+
+    uint32_t slot = static_cast<uint32_t>(series->id >> 8);
+    shard.chunks[slot >> kChunkBits].load(std::memory_order_relaxed)[slot & (kChunkSize - 1)].store(
+        nullptr, std::memory_order_release);
+    shard.live--;
+    shard.retired.push_back(series);
+    shard.retiredSlots.push_back(slot);
+
+    // tombstone이 많으면 탐색이 길어진다
+    if (table->tombstones * 4 > table->mask + 1) {
+        rebuild(shard, tableCapacity(shard.live));
+    }
+}
+
+void SeriesRegistry::reclaim(Shard& shard) {
+    if (shard.retired.empty() && shard.retiredTables.empty()) return;
+    // 여기 오기 전에 뺀 포인터는 지금 읽는 쪽이 없으면 더 이상 누구도 들고 있지 않다
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (shard.readers.load(std::memory_order_seq_cst) != 0) return;
+    for (Series* series : shard.retired) delete series;
+    for (Table* table : shard.retiredTables) delete table;
+    shard.freeSlots.insert(shard.freeSlots.end(), shard.retiredSlots.begin(), shard.retiredSlots.end());
+    shard.retired.clear();
+    shard.retiredTables.clear();
+    shard.retiredSlots.clear();
+}
+
+SeriesId SeriesRegistry::find(const SeriesKey& key) const {
+    uint64_t hash = key.hash();
+    Shard& shard = shards[shardBits ? hash >> (64 - shardBits) : 0];
+    ReadGuard guard(shard);
+    Series* series = lookup(shard, key, hash);
+    return series ? series->id : kInvalidSeriesId;
+}
+
+SeriesId SeriesRegistry::getOrCreate(const SeriesKey& key, int64_t nowMs) {
+    uint64_t hash = key.hash();
+    unsigned int shardIndex = shardBits ? static_cast<unsigned int>(hash >> (64 - shardBits)) : 0;
+    Shard& shard = shards[shardIndex];
+    {
+        ReadGuard guard(shard);
+        if (Series* series = lookup(shard, key, hash)) return series->id;
+    }
+
+    std::lock_guard<std::mutex> lock(shard.writeMutex);
+    if (Series* series = lookup(shard, key, hash)) return series->id;   // 잠그는 사이 다른 스레드가 만들었다
+
+    uint32_t slot;
+    if (!shard.freeSlots.empty()) {
+        slot = shard.freeSlots.back();
+        shard.freeSlots.pop_back();
+    } else if (shard.nextSlot < kMaxChunks * kChunkSize) {
+        slot = shard.nextSlot++;
+    } else {
+        std::cerr << "Series registry shard full" << std::endl;
+        return kInvalidSeriesId;
+    }
+    std::atomic<Series*>* chunk = shard.chunks[slot >> kChunkBits].load(std::memory_order_relaxed);
+    if (!chunk) {
+        chunk = new std::atomic<Series*>[kChunkSize];
+        for (unsigned int i = 0; i < kChunkSize; i++) {
+            chunk[i].store(nullptr, std::memory_order_relaxed);
+        }
+        shard.chunks[slot >> kChunkBits].store(chunk, std::memory_order_release);
+    }
+    if (slot >= shard.generations.size()) shard.generations.resize(slot + 1, 0);
+    uint32_t generation = (shard.generations[slot] + 1) & kGenerationMask;
+    if (generation == 0) generation = 1;
+    shard.generations[slot] = generation;
+
+    Series* series = new Series{(static_cast<uint64_t>(generation) << 40) | (static_cast<uint64_t>(slot) << 8) | shardIndex,
+                                hash, key, std::string(), {0}, {nowMs}};
+    std::string& text = series->text;
+    text = internedString(key.metric);
+    if (!key.labels.empty()) {
+        text.push_back('{');
+        for (size_t i = 0; i < key.labels.size(); i++) {
+            if (i) text.push_back(',');
+            text += internedString(key.labels[i].name);
+            text += "=\"";
+            if (key.labels[i].numeric) text += std::to_string(key.labels[i].number);
+            else appendLabelValue(internedString(key.labels[i].value), text);
+            text.push_back('"');
+        }
+        text.push_back('}');
+    }
+
+    insert(shard, series);
+    chunk[slot & (kChunkSize - 1)].store(series, std::memory_order_release);
+    shard.live++;
+    created.fetch_add(1, std::memory_order_relaxed);
+    return series->id;
+}
+
+bool SeriesRegistry::set(SeriesId id, double value, int64_t nowMs) {
+    Shard* shard = shardFor(id);
+    if (!shard) return false;
+    ReadGuard guard(*shard);
+    Series* series = resolve(*shard, id);
+    if (!series) return false;
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    series->value.store(bits, std::memory_order_relaxed);
+    series->updatedMs.store(nowMs, std::memory_order_relaxed);
+    return true;
+}
+
+bool SeriesRegistry::get(SeriesId id, double& value) const {
+    Shard* shard = shardFor(id);
+    if (!shard) return false;
+    ReadGuard guard(*shard);
+    Series* series = resolve(*shard, id);
+    if (!series) return false;
+    uint64_t bits = series->value.load(std::memory_order_relaxed);
+    std::memcpy(&value, &bits, sizeof(value));
+    return true;
+}
+
+SeriesId SeriesRegistry::update(const SeriesKey& key, double value, int64_t nowMs) {
+    SeriesId id = getOrCreate(key, nowMs);
+    // 만든 직후 쓸릴 수는 없지만 (갱신 시각이 지금) 다른 스레드의 remove와는 겹칠 수 있다
+    if (id != kInvalidSeriesId && !set(id, value, nowMs)) return kInvalidSeriesId;
+    return id;
+}
+
+bool SeriesRegistry::remove(SeriesId id) {
+    Shard* shard = shardFor(id);
+    if (!shard) return false;
+    std::lock_guard<std::mutex> lock(shard->writeMutex);
+    Series* series = resolve(*shard, id);
+    if (!series) return false;
+    unlink(*shard, series);
+    removed.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void SeriesRegistry::describe(std::string_view metric, std::string_view type, std::string_view help) {
+    std::lock_guard<std::mutex> lock(describeMutex);
+    descriptions[internString(metric)] = {std::string(type), std::string(help)};
+}
+
+void SeriesRegistry::appendPrometheus(std::string& out) {
+    // 샤드마다 읽기 구간 안에서는 값과 레이블 텍스트만 복사하고, 정렬과 렌더링은 구간 밖에서 한다.
+    // 스크레이프가 계속 돌아도 샤드별 구간이 짧아 쓸기 스레드가 해제할 틈이 생긴다
+    struct Row {
+        InternId metric;
+        SeriesId id;
+        double value;
+        size_t textOffset;
+        size_t textLength;
+    };
+    std::vector<Row> rows;
+    std::string texts;
+    for (unsigned int i = 0; i < (1u << shardBits); i++) {
+        Shard& shard = shards[i];
+        ReadGuard guard(shard);
+        Table* table = shard.table.load(std::memory_order_acquire);
+        if (!table) continue;
+        for (size_t slot = 0; slot <= table->mask; slot++) {
+            Series* series = table->slots[slot].load(std::memory_order_acquire);
+            if (!series || isTombstone(series)) continue;
+            uint64_t bits = series->value.load(std::memory_order_relaxed);
+            Row row;
+            row.metric = series->key.metric;
+            row.id = series->id;
+            std::memcpy(&row.value, &bits, sizeof(row.value));
+            row.textOffset = texts.size();
+            row.textLength = series->text.size();
+            texts += series->text;
+            rows.push_back(row);
+        }
+    }
+    std::sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) {
+        return a.metric != b.metric ? a.metric < b.metric : a.id < b.id;
+    });
+
+    std::lock_guard<std::mutex> lock(describeMutex);
+    InternId metric = kEmptyIntern;
+    for (const Row& row : rows) {
+        if (row.metric != metric) {
+            metric = row.metric;
+            const std::string& name = internedString(metric);
+            auto it = descriptions.find(metric);
+            if (it != descriptions.end() && !it->second.second.empty()) {
+                out += "# HELP " + name + " " + it->second.second + "\n";
+            }
+            out += "# TYPE " + name + " " + (it != descriptions.end() ? it->second.first : "gauge") + "\n";
+        }
+        out.append(texts, row.textOffset, row.textLength);
+        out.push_back(' ');
+        if (std::isnan(row.value)) out += "NaN";   // appendNumber는 JSON용 null을 쓴다
+        else appendNumber(row.value, out);
+        out.push_back('\n');
+    }
+}
+
+size_t SeriesRegistry::sweep(int64_t nowMs) {
+    size_t count = 0;
+    for (unsigned int i = 0; i < (1u << shardBits); i++) {
+        Shard& shard = shards[i];
+        std::lock_guard<std::mutex> lock(shard.writeMutex);
+        reclaim(shard);
+        for (uint32_t slot = 0; slot < shard.nextSlot; slot++) {
+            std::atomic<Series*>* chunk = shard.chunks[slot >> kChunkBits].load(std::memory_order_relaxed);
+            if (!chunk) continue;
+            Series* series = chunk[slot & (kChunkSize - 1)].load(std::memory_order_relaxed);
+            if (series && nowMs - series->updatedMs.load(std::memory_order_relaxed) > config.staleMs) {
+                unlink(shard, series);
+                count++;
+            }
+        }
+    }
+    swept.fetch_add(count, std::memory_order_relaxed);
+    return count;
+}
+
+void SeriesRegistry::start() {
+    if (running || config.sweepIntervalMs <= 0) return;
+    running = true;
+    sweepThread = std::thread(&SeriesRegistry::sweepLoop, this);
+}
+
+void SeriesRegistry::stop() {
+    if (!running) return;
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        running = false;
+    }
+    wake.notify_all();
+    if (sweepThread.joinable()) sweepThread.join();
+}
+
+void SeriesRegistry::sweepLoop() {
+    while (running) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wake.wait_for(lock, std::chrono::milliseconds(config.sweepIntervalMs), [this] { return !running; });
+        }
+        if (!running) break;
+        sweep(nowMillis());
+    }
+}
+
+SeriesRegistryStats SeriesRegistry::getStats() {
+    SeriesRegistryStats stats{};
+    for (unsigned int i = 0; i < (1u << shardBits); i++) {
+        std::lock_guard<std::mutex> lock(shards[i].writeMutex);
+        stats.live += shards[i].live;
+        stats.pendingReclaim += shards[i].retired.size();
+    }
+    stats.created = created.load(std::memory_order_relaxed);
+    stats.swept = swept.load(std::memory_order_relaxed);
+    stats.removed = removed.load(std::memory_order_relaxed);
+    return stats;
+}
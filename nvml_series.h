@@ -0,0 +1,169 @@
+#ifndef NVML_SERIES_H
+#define NVML_SERIES_H
+
+#include "nvml_intern.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// 시계열 id: [세대 24비트][샤드 안 슬롯 32비트][샤드 8비트]. 0은 없음
+// 같은 레이블 집합은 살아 있는 동안 같은 id를 가진다. 쓸어낸 슬롯을 다시 쓸 때는 세대가 바뀌므로
+// 오래된 id로 갱신하면 새 시계열에 쓰지 않고 false가 된다
+typedef uint64_t SeriesId;
+const SeriesId kInvalidSeriesId = 0;
+
+// 값은 인터닝한 문자열이거나 숫자. pid, 인스턴스 번호처럼 계속 바뀌는 숫자는 인터닝 테이블에 넣지 않는다
+struct SeriesLabel {
+    InternId name;
+    InternId value = kEmptyIntern;      // 문자열 값 (numeric이면 비어 있다)
+    bool numeric = false;
+    unsigned long long number = 0;
+};
+
+// 지표 이름 + 레이블 (레이블 이름순으로 유지해 같은 집합이면 같은 키)
+struct SeriesKey {
+    InternId metric;
+    std::vector<SeriesLabel> labels;
+
+    explicit SeriesKey(std::string_view metric);
+    SeriesKey& label(std::string_view name, std::string_view value);
+    SeriesKey& label(std::string_view name, unsigned long long value);
+    uint64_t hash() const;
+    bool operator==(const SeriesKey& other) const;
+};
+
+struct SeriesRegistryConfig {
+    unsigned int shards = 16;                   // 2의 거듭제곱으로 올림 (최대 256)
+    int64_t staleMs = 5 * 60 * 1000;            // 이만큼 갱신되지 않은 시계열은 쓸어낸다
+    int64_t sweepIntervalMs = 30 * 1000;
+};
+
+struct SeriesRegistryStats {
+    uint64_t live;
+    uint64_t created;
+    uint64_t swept;
+    uint64_t removed;
+    uint64_t pendingReclaim;    // 읽는 쪽이 끝나기를 기다리는 해제 대기
+};
+
+// 샤드 시계열 레지스트리 (내보내기 대상 지표 값 저장소)
+// 레이블 집합 해시로 샤드를 고르고, 샤드마다 개방 주소 색인과 슬롯 배열(id -> 시계열)을 둔다.
+// 조회/갱신/스크레이프는 잠그지 않는다: 포인터는 원자적으로 읽고, 값은 시계열 안의 원자 변수에 쓴다.
+// 추가/삭제만 샤드 잠금을 잡는다. 색인에서 뺀 시계열과 커진 뒤의 옛 색인은 바로 지우지 않고
+// 다음 쓸기 때 그 샤드를 읽는 쪽이 하나도 없으면 해제한다 (샤드별 읽기 카운터)
+class SeriesRegistry {
+private:
+    struct Series {
+        SeriesId id;
+        uint64_t hash;
+        SeriesKey key;
+        std::string text;                       // 'metric{name="value",...}' (한 번만 만든다)
+        std::atomic<uint64_t> value;            // double 비트
+        std::atomic<int64_t> updatedMs;
+    };
+
+    struct Table {
+        size_t mask;
+        std::unique_ptr<std::atomic<Series*>[]> slots;   // nullptr: 빈 칸, tombstone: 지운 칸
+        size_t used;                                     // 시계열 + tombstone (쓰는 쪽만)
+        size_t tombstones;
+    };
+
+    static const unsigned int kChunkBits = 10;
+    static const unsigned int kChunkSize = 1u << kChunkBits;
+    static const unsigned int kMaxChunks = 4096;        // 샤드당 최대 400만 슬롯
+
+    struct alignas(64) Shard {
+        std::atomic<uint32_t> readers{0};
+        std::atomic<Table*> table{nullptr};
+        std::atomic<std::atomic<Series*>*> chunks[kMaxChunks];   // 슬롯 -> 시계열
+
+        std::mutex writeMutex;
+        uint32_t nextSlot = 0;
+        std::vector<uint32_t> freeSlots;
+        std::vector<uint32_t> generations;              // 슬롯별 세대
+        size_t live = 0;
+        std::vector<Series*> retired;                   // 해제 대기 (읽는 쪽이 끝나면)
+        std::vector<Table*> retiredTables;
+        std::vector<uint32_t> retiredSlots;
+
+        Shard();
+    };
+
+    // 샤드 읽기 구간 (이 안에서 얻은 포인터만 쓴다)
+    class ReadGuard {
+    private:
+        Shard& shard;
+
+    public:
+        // 카운터를 올린 뒤 포인터를 읽기 전에 전체 펜스: reclaim의 펜스와 짝을 이뤄
+        // 쓰는 쪽이 카운터 0을 보면 이 구간은 뺀 포인터를 읽지 않는다
+        explicit ReadGuard(Shard& shard) : shard(shard) {
+            shard.readers.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+        ~ReadGuard() { shard.readers.fetch_sub(1, std::memory_order_release); }
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+    };
+
+    SeriesRegistryConfig config;
+    unsigned int shardBits;
+    std::unique_ptr<Shard[]> shards;
+
+    std::atomic<uint64_t> created;
+    std::atomic<uint64_t> swept;
+    std::atomic<uint64_t> removed;
+
+    std::mutex describeMutex;
+    std::unordered_map<InternId, std::pair<std::string, std::string>> descriptions;   // metric -> (type, help)
+
+    std::atomic<bool> running;
+    std::thread sweepThread;
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+
+public:
+    explicit SeriesRegistry(const SeriesRegistryConfig& config = SeriesRegistryConfig());
+    ~SeriesRegistry();
+    SeriesRegistry(const SeriesRegistry&) = delete;
+    SeriesRegistry& operator=(const SeriesRegistry&) = delete;
+
+    // 레이블 집합의 id (없으면 만든다). 틱마다 쓰는 쪽은 id를 들고 set을 부른다
+    SeriesId getOrCreate(const SeriesKey& key, int64_t nowMs);
+    SeriesId find(const SeriesKey& key) const;      // 없으면 kInvalidSeriesId
+    // 쓸렸거나 지운 id면 false (getOrCreate로 다시 얻는다)
+    bool set(SeriesId id, double value, int64_t nowMs);
+    bool get(SeriesId id, double& value) const;
+    SeriesId update(const SeriesKey& key, double value, int64_t nowMs);
+    bool remove(SeriesId id);
+
+    // Prometheus # TYPE/# HELP (없으면 gauge)
+    void describe(std::string_view metric, std::string_view type, std::string_view help);
+
+    // 지금 살아 있는 시계열을 지표별로 묶어 텍스트 형식으로 붙인다
+    void appendPrometheus(std::string& out);
+
+    // staleMs 넘게 갱신되지 않은 시계열을 쓸고, 지난번에 뺀 것을 해제한다. 쓴 수를 돌려준다
+    size_t sweep(int64_t nowMs);
+    void start();   // 주기 쓸기 스레드
+    void stop();
+
+    SeriesRegistryStats getStats();
+
+private:
+    Shard* shardFor(SeriesId id) const;
+    Series* lookup(Shard& shard, const SeriesKey& key, uint64_t hash) const;
+    Series* resolve(Shard& shard, SeriesId id) const;   // ReadGuard 안에서
+    void insert(Shard& shard, Series* series);
+    void unlink(Shard& shard, Series* series);
+    void rebuild(Shard& shard, size_t capacity);
+    void reclaim(Shard& shard);
+    void sweepLoop();
+};
+
+#endif // NVML_SERIES_H
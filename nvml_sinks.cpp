@@ -0,0 +1,372 @@
+#include "nvml_sinks.h"
+#include "nvml_util.h"
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <iostream>
+
+namespace {
+
+uint64_t toMillis(std::chrono::system_clock::time_point time) {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count());
+}
+
+// GPU 지표 정의 (Prometheus 이름, 설명, 값)
+struct GaugeDef {
+    const char* name;
+    const char* help;
+    unsigned long long (*value)(const GPUMetrics&);
+};
+
+const GaugeDef kGauges[] = {
+    {"nvml_gpu_utilization_percent", "GPU utilization.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.gpuUtilization; }},
+    {"nvml_memory_utilization_percent", "Memory controller utilization.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.memoryUtilization; }},
+    {"nvml_encoder_utilization_percent", "Encoder utilization.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.encoderUtilization; }},
+    {"nvml_decoder_utilization_percent", "Decoder utilization.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.decoderUtilization; }},
+    {"nvml_memory_used_bytes", "Framebuffer memory used.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.memoryUsed; }},
+    {"nvml_memory_total_bytes", "Framebuffer memory total.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.memoryTotal; }},
+    {"nvml_temperature_celsius", "GPU temperature.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.temperature; }},
+    {"nvml_fan_speed_percent", "Fan speed.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.fanSpeed; }},
+    {"nvml_power_usage_milliwatts", "Power draw.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.powerUsage; }},
+    {"nvml_power_limit_milliwatts", "Power limit.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.powerLimit; }},
+    {"nvml_sm_clock_mhz", "SM clock.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.smClock; }},
+    {"nvml_memory_clock_mhz", "Memory clock.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.memoryClock; }},
+    {"nvml_graphics_clock_mhz", "Graphics clock.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.graphicsClock; }},
+    {"nvml_ecc_single_bit_errors", "Volatile single bit ECC errors.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.eccSingleBit; }},
+    {"nvml_ecc_double_bit_errors", "Volatile double bit ECC errors.",
+     [](const GPUMetrics& m) -> unsigned long long { return m.eccDoubleBit; }},
+};
+
+const char* const kPressureNames[HOST_PRESSURE_COUNT] = {"cpu", "memory", "io"};
+
+std::string formatDouble(double value) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.2f", value);
+    return text;
+}
+
+void appendHostJson(const HostMetrics& host, std::string& out) {
+    out += ",\"host\":{\"intervalMs\":" + std::to_string(host.intervalMs);
+    out += ",\"cpuCount\":" + std::to_string(host.cpuCount);
+    out += ",\"cpuBusy\":" + formatDouble(host.cpuBusyPercent);
+    out += ",\"cpuIowait\":" + formatDouble(host.cpuIowaitPercent);
+    out += ",\"cpuSteal\":" + formatDouble(host.cpuStealPercent);
+    out += ",\"memoryTotal\":" + std::to_string(host.memoryTotal);
+    out += ",\"memoryAvailable\":" + std::to_string(host.memoryAvailable);
+    out += ",\"swapTotal\":" + std::to_string(host.swapTotal);
+    out += ",\"swapFree\":" + std::to_string(host.swapFree);
+    if (host.pressureValid) {
+        out += ",\"pressure\":{";
+        for (int i = 0; i < HOST_PRESSURE_COUNT; i++) {
+            const HostPressure& pressure = host.pressure[i];
+            if (i) out.push_back(',');
+            out += "\"";
+            out += kPressureNames[i];
+            out += "\":{\"some\":" + formatDouble(pressure.somePercent);
+            out += ",\"full\":" + formatDouble(pressure.fullPercent);
+            out += ",\"someAvg10\":" + formatDouble(pressure.someAvg10);
+            out += ",\"fullAvg10\":" + formatDouble(pressure.fullAvg10);
+            out += "}";
+        }
+        out += "}";
+    }
+    out += ",\"processes\":[";
+    for (size_t i = 0; i < host.processes.size(); i++) {
+        const HostProcessCpu& process = host.processes[i];
+        if (i) out.push_back(',');
+        out += "{\"pid\":" + std::to_string(process.pid);
+        out += ",\"cpuTimeMs\":" + std::to_string(process.cpuTimeMs);
+        out += ",\"cpuPercent\":" + formatDouble(process.cpuPercent);
+        out += "}";
+    }
+    out += "]}";
+}
+
+} // namespace
+
+void appendSnapshotJson(const MetricsSnapshot& snapshot, std::string& out) {
+    out += "{\"timestamp\":";
+    out += std::to_string(toMillis(snapshot.timestamp));
+    out += ",\"devices\":[";
+    for (size_t i = 0; i < snapshot.devices.size(); i++) {
+        const GPUMetrics& m = snapshot.devices[i];
+        if (i) out.push_back(',');
+        out += "{\"index\":" + std::to_string(m.deviceIndex);
+        out += ",\"gpuUtilization\":" + std::to_string(m.gpuUtilization);
+        out += ",\"memoryUtilization\":" + std::to_string(m.memoryUtilization);
+        out += ",\"encoderUtilization\":" + std::to_string(m.encoderUtilization);
+        out += ",\"decoderUtilization\":" + std::to_string(m.decoderUtilization);
+        out += ",\"memoryUsed\":" + std::to_string(m.memoryUsed);
+        out += ",\"memoryTotal\":" + std::to_string(m.memoryTotal);
+        out += ",\"temperature\":" + std::to_string(m.temperature);
+        out += ",\"fanSpeed\":" + std::to_string(m.fanSpeed);
+        out += ",\"powerUsage\":" + std::to_string(m.powerUsage);
+        out += ",\"powerLimit\":" + std::to_string(m.powerLimit);
+        out += ",\"smClock\":" + std::to_string(m.smClock);
+        out += ",\"memoryClock\":" + std::to_string(m.memoryClock);
+        out += ",\"graphicsClock\":" + std::to_string(m.graphicsClock);
+        out += ",\"eccSingleBit\":" + std::to_string(m.eccSingleBit);
+        out += ",\"eccDoubleBit\":" + std::to_string(m.eccDoubleBit);
+        out += "}";
+    }
+    out += "],\"processes\":[";
+    for (size_t i = 0; i < snapshot.processes.size(); i++) {
+        const ProcessInfo& p = snapshot.processes[i];
+        if (i) out.push_back(',');
+        out += "{\"device\":" + std::to_string(p.deviceIndex);
+        out += ",\"pid\":" + std::to_string(p.pid);
+        out += ",\"name\":";
+        appendJsonString(internedString(p.nameId), out);
+        out += ",\"usedGpuMemory\":" + std::to_string(p.usedGpuMemory);
+        out += ",\"type\":\"";
+        out += p.type == NVML_PROCESS_TYPE_COMPUTE ? "compute" : "graphics";
+        out += "\"}";
+    }
+    out += "]";
+    if (snapshot.host.valid) {
+        appendHostJson(snapshot.host, out);
+    }
+    out += "}";
+}
+
+PrometheusSink::PrometheusSink(HttpServer& server, const std::vector<GPUInfo>& gpus, ExporterPipeline* pipeline,
+                               SeriesRegistry* series, const std::string& path)
+    : server(server), path(path), gpus(gpus), pipeline(pipeline),
+      ownedSeries(series ? nullptr : std::make_unique<SeriesRegistry>()), series(series ? series : ownedSeries.get()),
+      page(std::make_shared<const std::string>()), tick(0) {
+}
+
+bool PrometheusSink::open() {
+    for (const auto& gauge : kGauges) {
+        series->describe(gauge.name, "gauge", gauge.help);
+    }
+    series->describe("nvml_process_memory_bytes", "gauge", "GPU memory used by a process.");
+    server.route(path, [this](const HttpRequest&, HttpResponse& response) {
+        std::shared_ptr<const std::string> current;
+        {
+            std::lock_guard<std::mutex> lock(pageMutex);
+            current = page;
+        }
+        response.contentType = "text/plain; version=0.0.4; charset=utf-8";
+        series->appendPrometheus(response.body);
+        response.body += *current;
+        if (pipeline) {
+            pipeline->renderMetrics(response.body);
+        }
+    });
+    return true;
+}
+
+bool PrometheusSink::exportBatch(const std::vector<SnapshotPtr>& batch) {
+    // 스크레이프는 최신 값만 보므로 배치의 마지막 스냅샷만
+    const MetricsSnapshot& snapshot = *batch.back();
+    updateSeries(snapshot);
+
+    renderBuffer.clear();
+    if (snapshot.host.valid) {
+        renderHost(snapshot.host, renderBuffer);
+    }
+    auto rendered = std::make_shared<const std::string>(renderBuffer);
+    std::lock_guard<std::mutex> lock(pageMutex);
+    page = std::move(rendered);
+    return true;
+}
+
+SeriesKey PrometheusSink::deviceKey(const char* metric, unsigned int index) const {
+    SeriesKey key(metric);
+    key.label("gpu", index);
+    if (index < gpus.size()) {
+        key.label("uuid", gpus[index].uuid).label("name", gpus[index].name);
+    }
+    return key;
+}
+
+void PrometheusSink::updateSeries(const MetricsSnapshot& snapshot) {
+    const size_t gaugeCount = sizeof(kGauges) / sizeof(kGauges[0]);
+    int64_t now = static_cast<int64_t>(toMillis(snapshot.timestamp));
+
+    // 레이블 집합은 처음 한 번만 만들고, 이후에는 id로 값만 쓴다. 쓸려서 set이 false면 다시 만든다
+    for (const auto& device : snapshot.devices) {
+        if (device.deviceIndex >= deviceSeries.size()) deviceSeries.resize(device.deviceIndex + 1);
+        std::vector<SeriesId>& ids = deviceSeries[device.deviceIndex];
+        ids.resize(gaugeCount, kInvalidSeriesId);
+        for (size_t i = 0; i < gaugeCount; i++) {
+            double value = static_cast<double>(kGauges[i].value(device));
+            if (ids[i] != kInvalidSeriesId && series->set(ids[i], value, now)) continue;
+            ids[i] = series->update(deviceKey(kGauges[i].name, device.deviceIndex), value, now);
+        }
+    }
+
+    tick++;
+    for (const auto& process : snapshot.processes) {
+        uint64_t key = (static_cast<uint64_t>(process.deviceIndex) << 32) | process.pid;
+        ProcessSeries& entry = processSeries.emplace(key, ProcessSeries{kInvalidSeriesId, kEmptyIntern, 0}).first->second;
+        double value = static_cast<double>(process.usedGpuMemory);
+        entry.tick = tick;
+        if (entry.id != kInvalidSeriesId && entry.nameId == process.nameId && series->set(entry.id, value, now)) {
+            continue;
+        }
+        // pid가 다른 이름으로 재사용되면 옛 시계열을 뺀다
+        if (entry.id != kInvalidSeriesId) series->remove(entry.id);
+        SeriesKey seriesKey("nvml_process_memory_bytes");
+        seriesKey.label("gpu", process.deviceIndex).label("pid", process.pid);
+        seriesKey.label("name", internedString(process.nameId));
+        entry.id = series->update(seriesKey, value, now);
+        entry.nameId = process.nameId;
+    }
+    // 끝난 프로세스는 쓸기를 기다리지 않고 바로 뺀다
+    for (auto it = processSeries.begin(); it != processSeries.end();) {
+        if (it->second.tick == tick) {
+            ++it;
+            continue;
+        }
+        if (it->second.id != kInvalidSeriesId) series->remove(it->second.id);
+        it = processSeries.erase(it);
+    }
+}
+
+void PrometheusSink::renderHost(const HostMetrics& host, std::string& out) {
+    // 비율은 첫 틱에 의미가 없으므로 구간이 있을 때만
+    if (host.intervalMs > 0) {
+        out += "# HELP nvml_host_cpu_busy_percent Host CPU busy time over the last tick.\n";
+        out += "# TYPE nvml_host_cpu_busy_percent gauge\n";
+        out += "nvml_host_cpu_busy_percent " + formatDouble(host.cpuBusyPercent) + "\n";
+        out += "# HELP nvml_host_cpu_iowait_percent Host CPU iowait time over the last tick.\n";
+        out += "# TYPE nvml_host_cpu_iowait_percent gauge\n";
+        out += "nvml_host_cpu_iowait_percent " + formatDouble(host.cpuIowaitPercent) + "\n";
+        out += "# HELP nvml_host_cpu_steal_percent Host CPU steal time over the last tick.\n";
+        out += "# TYPE nvml_host_cpu_steal_percent gauge\n";
+        out += "nvml_host_cpu_steal_percent " + formatDouble(host.cpuStealPercent) + "\n";
+    }
+    out += "# HELP nvml_host_memory_available_bytes Host MemAvailable.\n";
+    out += "# TYPE nvml_host_memory_available_bytes gauge\n";
+    out += "nvml_host_memory_available_bytes " + std::to_string(host.memoryAvailable) + "\n";
+    out += "# HELP nvml_host_memory_total_bytes Host MemTotal.\n";
+    out += "# TYPE nvml_host_memory_total_bytes gauge\n";
+    out += "nvml_host_memory_total_bytes " + std::to_string(host.memoryTotal) + "\n";
+    out += "# HELP nvml_host_swap_free_bytes Host SwapFree.\n";
+    out += "# TYPE nvml_host_swap_free_bytes gauge\n";
+    out += "nvml_host_swap_free_bytes " + std::to_string(host.swapFree) + "\n";
+
+    if (host.pressureValid && host.intervalMs > 0) {
+        out += "# HELP nvml_host_pressure_percent Share of the last tick with tasks stalled on a resource (PSI).\n";
+        out += "# TYPE nvml_host_pressure_percent gauge\n";
+        for (int i = 0; i < HOST_PRESSURE_COUNT; i++) {
+            out += "nvml_host_pressure_percent{resource=\"";
+            out += kPressureNames[i];
+            out += "\",kind=\"some\"} " + formatDouble(host.pressure[i].somePercent) + "\n";
+            out += "nvml_host_pressure_percent{resource=\"";
+            out += kPressureNames[i];
+            out += "\",kind=\"full\"} " + formatDouble(host.pressure[i].fullPercent) + "\n";
+        }
+    }
+
+    out += "# HELP nvml_process_cpu_seconds_total CPU time of a GPU process.\n";
+    out += "# TYPE nvml_process_cpu_seconds_total counter\n";
+    for (const auto& process : host.processes) {
+        out += "nvml_process_cpu_seconds_total{pid=\"" + std::to_string(process.pid) + "\"} " +
+               formatDouble(process.cpuTimeMs / 1000.0) + "\n";
+    }
+}
+
+FileSink::FileSink(const std::string& path) : path(path), file(nullptr) {
+}
+
+FileSink::~FileSink() {
+    close();
+}
+
+bool FileSink::open() {
+    if (file) return true;
+    file = std::fopen(path.c_str(), "a");
+    if (!file) {
+        std::cerr << "Failed to open " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void FileSink::close() {
+    if (file) {
+        std::fclose(file);
+        file = nullptr;
+    }
+}
+
+bool FileSink::exportBatch(const std::vector<SnapshotPtr>& batch) {
+    if (!open()) return false;
+
+    line.clear();
+    for (const auto& snapshot : batch) {
+        appendSnapshotJson(*snapshot, line);
+        line.push_back('\n');
+    }
+
+    if (std::fwrite(line.data(), 1, line.size(), file) != line.size() || std::fflush(file) != 0) {
+        std::cerr << "Failed to write " << path << ": " << std::strerror(errno) << std::endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+StreamSink::StreamSink(WireStreamClient& client) : client(client) {
+}
+
+bool StreamSink::exportBatch(const std::vector<SnapshotPtr>& batch) {
+    for (const auto& snapshot : batch) {
+        samples.clear();
+        for (const auto& metrics : snapshot->devices) {
+            samples.push_back(makeWireSample(metrics.deviceIndex, metrics));
+        }
+        client.submit(toMillis(snapshot->timestamp), samples);
+    }
+    return true;
+}
+
+LogSink::LogSink(std::ostream& out, int intervalSeconds) : out(out), intervalSeconds(intervalSeconds) {
+}
+
+bool LogSink::exportBatch(const std::vector<SnapshotPtr>& batch) {
+    const MetricsSnapshot& snapshot = *batch.back();
+    if (snapshot.timestamp - lastLog < std::chrono::seconds(intervalSeconds)) {
+        return true;
+    }
+    lastLog = snapshot.timestamp;
+
+    std::ostringstream line;
+    line << "[Snapshot]";
+    for (const auto& metrics : snapshot.devices) {
+        line << " GPU" << metrics.deviceIndex << ": " << metrics.gpuUtilization << "% "
+             << (metrics.memoryUsed / 1024 / 1024) << "/" << (metrics.memoryTotal / 1024 / 1024) << "MB "
+             << metrics.temperature << "C " << (metrics.powerUsage / 1000) << "W";
+    }
+    line << " (" << snapshot.processes.size() << " processes)";
+    if (snapshot.host.valid) {
+        line << " Host: " << static_cast<int>(snapshot.host.cpuBusyPercent) << "% CPU "
+             << (snapshot.host.memoryAvailable / 1024 / 1024) << "MB avail";
+        if (snapshot.host.pressureValid) {
+            line << " PSI cpu/mem/io " << static_cast<int>(snapshot.host.pressure[HOST_PRESSURE_CPU].somePercent) << "/"
+                 << static_cast<int>(snapshot.host.pressure[HOST_PRESSURE_MEMORY].somePercent) << "/"
+                 << static_cast<int>(snapshot.host.pressure[HOST_PRESSURE_IO].somePercent) << "%";
+        }
+    }
+    line << "\n";
+    out << line.str() << std::flush;
+    return static_cast<bool>(out);
+}
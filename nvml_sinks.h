@@ -0,0 +1,100 @@
+#ifndef NVML_SINKS_H
+#define NVML_SINKS_H
+
+#include "nvml_exporter.h"
+#include "nvml_http.h"
+#include "nvml_series.h"
+#include "nvml_stream.h"
+#include <cstdio>
+#include <ostream>
+#include <unordered_map>
+
+// Prometheus 텍스트 형식 /metrics
+// GPU/프로세스 지표는 시계열 레지스트리에 id로 갱신하고 (틱마다 set만), 스크레이프 때 레지스트리를 렌더링한다.
+// 호스트 지표는 마지막 스냅샷을 렌더링해 둔 페이지를 붙인다
+class PrometheusSink : public MetricsSink {
+private:
+    // (gpu, pid)마다 시계열 id와 레이블에 들어간 이름. 틱에 보이지 않은 프로세스는 바로 뺀다
+    struct ProcessSeries {
+        SeriesId id;
+        InternId nameId;
+        uint64_t tick;
+    };
+
+    HttpServer& server;
+    std::string path;
+    std::vector<GPUInfo> gpus;
+    ExporterPipeline* pipeline; // 파이프라인 자체 지표 (선택)
+    std::unique_ptr<SeriesRegistry> ownedSeries;
+    SeriesRegistry* series;     // 주어지지 않으면 자체 레지스트리
+
+    std::mutex pageMutex;
+    std::shared_ptr<const std::string> page;
+    std::string renderBuffer;
+
+    std::vector<std::vector<SeriesId>> deviceSeries;          // 디바이스 인덱스 -> 지표별 id
+    std::unordered_map<uint64_t, ProcessSeries> processSeries;
+    uint64_t tick;
+
+public:
+    PrometheusSink(HttpServer& server, const std::vector<GPUInfo>& gpus, ExporterPipeline* pipeline = nullptr,
+                   SeriesRegistry* series = nullptr, const std::string& path = "/metrics");
+
+    std::string name() const override { return "prometheus"; }
+    bool open() override;
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override;
+
+private:
+    void updateSeries(const MetricsSnapshot& snapshot);
+    SeriesKey deviceKey(const char* metric, unsigned int index) const;
+    void renderHost(const HostMetrics& host, std::string& out);
+};
+
+// JSON Lines 파일 (스냅샷당 한 줄). 쓰기 실패 시 다음 시도에서 파일을 다시 연다
+class FileSink : public MetricsSink {
+private:
+    std::string path;
+    FILE* file;
+    std::string line;
+
+public:
+    explicit FileSink(const std::string& path);
+    ~FileSink() override;
+
+    std::string name() const override { return "file"; }
+    bool open() override;
+    void close() override;
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override;
+};
+
+// 집계기 바이너리 스트림 (WireStreamClient가 자체 큐/재전송을 가진다)
+class StreamSink : public MetricsSink {
+private:
+    WireStreamClient& client;
+    std::vector<WireSample> samples;
+
+public:
+    explicit StreamSink(WireStreamClient& client);
+
+    std::string name() const override { return "stream"; }
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override;
+};
+
+// 사람이 읽는 요약 로그 (intervalSeconds마다 한 줄)
+class LogSink : public MetricsSink {
+private:
+    std::ostream& out;
+    int intervalSeconds;
+    std::chrono::system_clock::time_point lastLog;
+
+public:
+    explicit LogSink(std::ostream& out, int intervalSeconds = 10);
+
+    std::string name() const override { return "log"; }
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override;
+};
+
+// 스냅샷 -> JSON 한 줄 (개행 제외)
+void appendSnapshotJson(const MetricsSnapshot& snapshot, std::string& out);
+
+#endif // NVML_SINKS_H
@@ -0,0 +1,543 @@
+#include "nvml_sketch.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+namespace {
+
+// 이보다 작은 크기는 0 버킷에 센다
+const double kMinIndexable = 1e-9;
+const uint32_t kMaxDecodedBuckets = 1 << 20;
+
+void putVarint(uint64_t value, std::string& out) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+uint64_t getVarint(CheckpointReader& reader) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64 && reader.good(); shift += 7) {
+        uint8_t byte = reader.get<uint8_t>();
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) return value;
+    }
+    return value;
+}
+
+} // namespace
+
+QuantileSketch::QuantileSketch(double relativeAccuracy, uint32_t maxBuckets)
+    : relativeAccuracy(std::min(std::max(relativeAccuracy, 1e-6), 0.5)),
+      gamma((1 + this->relativeAccuracy) / (1 - this->relativeAccuracy)), logGamma(std::log(gamma)),
+      maxBuckets(std::max<uint32_t>(maxBuckets, 16)) {
+    clear();
+}
+
+void QuantileSketch::clear() {
+    positive.offset = 0;
+    positive.counts.clear();
+    negative.offset = 0;
+    negative.counts.clear();
+    zeroCount = 0;
+    count = 0;
+    sum = 0;
+    min = std::numeric_limits<double>::infinity();
+    max = -std::numeric_limits<double>::infinity();
+}
+
+int32_t QuantileSketch::indexOf(double value) const {
+    return static_cast<int32_t>(std::ceil(std::log(value) / logGamma));
+}
+
+double QuantileSketch::valueOf(int32_t index) const {
+    // 버킷 (gamma^(i-1), gamma^i]의 상대 오차가 가장 작은 대표값
+    return 2 * std::pow(gamma, index) / (gamma + 1);
+}
+
+void QuantileSketch::addToStore(Store& store, int32_t index, uint64_t weight) {
+    auto& counts = store.counts;
+    if (counts.empty()) {
+        store.offset = index;
+        counts.assign(1, weight);
+        return;
+    }
+
+    int64_t top = static_cast<int64_t>(store.offset) + counts.size() - 1;
+    if (index < store.offset) {
+        // 아래로 늘리면 상한을 넘는 경우 가장 낮은 버킷에 합친다
+        int64_t lowest = std::max<int64_t>(index, top - maxBuckets + 1);
+        if (lowest >= store.offset) {
+            counts[0] += weight;
+            return;
+        }
+        counts.insert(counts.begin(), static_cast<size_t>(store.offset - lowest), 0);
+        store.offset = static_cast<int32_t>(lowest);
+        counts[index < lowest ? 0 : index - lowest] += weight;
+        return;
+    }
+    if (index > top) {
+        counts.resize(static_cast<size_t>(index - store.offset + 1), 0);
+        if (counts.size() > maxBuckets) {
+            // 가장 낮은 버킷들을 하나로 합친다
+            size_t collapse = counts.size() - maxBuckets;
+            uint64_t merged = 0;
+            for (size_t i = 0; i <= collapse; i++) {
+                merged += counts[i];
+            }
+            counts.erase(counts.begin(), counts.begin() + collapse);
+            counts[0] = merged;
+            store.offset += static_cast<int32_t>(collapse);
+        }
+    }
+    counts[index - store.offset] += weight;
+}
+
+void QuantileSketch::add(double value, uint64_t weight) {
+    if (weight == 0 || std::isnan(value)) return;
+
+    if (value > kMinIndexable) {
+        addToStore(positive, indexOf(value), weight);
+    } else if (value < -kMinIndexable) {
+        addToStore(negative, indexOf(-value), weight);
+    } else {
+        zeroCount += weight;
+    }
+    count += weight;
+    sum += value * weight;
+    min = std::min(min, value);
+    max = std::max(max, value);
+}
+
+bool QuantileSketch::merge(const QuantileSketch& other) {
+    if (std::fabs(other.relativeAccuracy - relativeAccuracy) > 1e-12) return false;
+    if (other.count == 0) return true;
+
+    for (size_t i = 0; i < other.positive.counts.size(); i++) {
+        if (other.positive.counts[i]) {
+            addToStore(positive, other.positive.offset + static_cast<int32_t>(i), other.positive.counts[i]);
+        }
+    }
+    for (size_t i = 0; i < other.negative.counts.size(); i++) {
+        if (other.negative.counts[i]) {
+            addToStore(negative, other.negative.offset + static_cast<int32_t>(i), other.negative.counts[i]);
+        }
+    }
+    zeroCount += other.zeroCount;
+    count += other.count;
+    sum += other.sum;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    return true;
+}
+
+double QuantileSketch::quantile(double q) const {
+    if (count == 0) return std::numeric_limits<double>::quiet_NaN();
+    q = std::min(std::max(q, 0.0), 1.0);
+    double rank = q * (count - 1);
+
+    double result = max;
+    uint64_t seen = 0;
+    bool found = false;
+    // 음수 (절댓값 큰 것부터), 0, 양수 (작은 것부터)
+    for (size_t i = negative.counts.size(); i-- > 0 && !found;) {
+        seen += negative.counts[i];
+        if (seen > rank) {
+            result = -valueOf(negative.offset + static_cast<int32_t>(i));
+            found = true;
+        }
+    }
+    if (!found) {
+        seen += zeroCount;
+        if (seen > rank) {
+            result = 0;
+            found = true;
+        }
+    }
+    for (size_t i = 0; i < positive.counts.size() && !found; i++) {
+        seen += positive.counts[i];
+        if (seen > rank) {
+            result = valueOf(positive.offset + static_cast<int32_t>(i));
+            found = true;
+        }
+    }
+    return std::min(std::max(result, min), max);
+}
+
+size_t QuantileSketch::bytes() const {
+    return sizeof(*this) + (positive.counts.capacity() + negative.counts.capacity()) * sizeof(uint64_t);
+}
+
+void QuantileSketch::encode(std::string& out) const {
+    putLE<double>(relativeAccuracy, out);
+    putLE<uint32_t>(maxBuckets, out);
+    putVarint(count, out);
+    putVarint(zeroCount, out);
+    putLE<double>(sum, out);
+    putLE<double>(min, out);
+    putLE<double>(max, out);
+    for (const Store* store : {&positive, &negative}) {
+        putLE<int32_t>(store->offset, out);
+        putVarint(store->counts.size(), out);
+        for (uint64_t c : store->counts) {
+            putVarint(c, out);
+        }
+    }
+}
+
+bool QuantileSketch::decode(CheckpointReader& reader) {
+    double accuracy = reader.get<double>();
+    uint32_t buckets = reader.get<uint32_t>();
+    if (!reader.good() || !(accuracy > 0 && accuracy <= 0.5)) return false;
+
+    QuantileSketch decoded(accuracy, buckets);
+    decoded.count = getVarint(reader);
+    decoded.zeroCount = getVarint(reader);
+    decoded.sum = reader.get<double>();
+    decoded.min = reader.get<double>();
+    decoded.max = reader.get<double>();
+    uint64_t total = decoded.zeroCount;
+    for (Store* store : {&decoded.positive, &decoded.negative}) {
+        store->offset = reader.get<int32_t>();
+        uint64_t size = getVarint(reader);
+        if (!reader.good() || size > kMaxDecodedBuckets || size > reader.remaining()) return false;
+        store->counts.resize(size);
+        for (auto& c : store->counts) {
+            c = getVarint(reader);
+            total += c;
+        }
+    }
+    if (!reader.good() || total != decoded.count) return false;
+    *this = std::move(decoded);
+    return true;
+}
+
+MetricSketches::MetricSketches(const SketchConfig& config) : config(config), samples(0) {
+    auto& tiers = this->config.tiers;
+    tiers.erase(std::remove_if(tiers.begin(), tiers.end(),
+                               [](const SketchTier& tier) { return tier.slotMs <= 0 || tier.slots == 0; }),
+                tiers.end());
+    if (tiers.empty()) tiers.push_back({60 * 1000, 60});
+    std::sort(tiers.begin(), tiers.end(), [](const SketchTier& a, const SketchTier& b) {
+        return a.slotMs * a.slots < b.slotMs * b.slots;
+    });
+}
+
+void MetricSketches::setDevices(const std::vector<GPUInfo>& gpus) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& gpu : gpus) {
+        if (gpu.index >= uuids.size()) uuids.resize(gpu.index + 1);
+        uuids[gpu.index] = gpu.uuid;
+    }
+}
+
+MetricSketches::Series& MetricSketches::seriesFor(unsigned int device, int metric) {
+    size_t index = static_cast<size_t>(device) * HM_DEVICE_METRIC_COUNT + metric;
+    if (index >= series.size()) {
+        size_t size = (static_cast<size_t>(device) + 1) * HM_DEVICE_METRIC_COUNT;
+        series.resize(size);
+    }
+    Series& entry = series[index];
+    if (entry.tiers.empty()) {
+        entry.tiers.resize(config.tiers.size());
+        for (size_t t = 0; t < config.tiers.size(); t++) {
+            entry.tiers[t].slots.assign(config.tiers[t].slots, QuantileSketch(config.relativeAccuracy, config.maxBuckets));
+            entry.tiers[t].slotIds.assign(config.tiers[t].slots, -1);
+        }
+    }
+    return entry;
+}
+
+void MetricSketches::insert(unsigned int device, int metric, int64_t timestampMs, double value) {
+    Series& entry = seriesFor(device, metric);
+    for (size_t t = 0; t < config.tiers.size(); t++) {
+        Window& window = entry.tiers[t];
+        int64_t slotId = floorDiv(timestampMs, config.tiers[t].slotMs);
+        size_t pos = static_cast<size_t>(slotId % config.tiers[t].slots);
+        if (window.slotIds[pos] != slotId) {
+            if (window.slotIds[pos] > slotId) continue; // 링보다 오래된 샘플
+            window.slots[pos].clear();
+            window.slotIds[pos] = slotId;
+        }
+        window.slots[pos].add(value);
+    }
+    samples++;
+}
+
+void MetricSketches::add(unsigned int device, int metric, int64_t timestampMs, double value) {
+    if (metric < 0 || metric >= HM_DEVICE_METRIC_COUNT) return;
+    std::lock_guard<std::mutex> lock(mutex);
+    insert(device, metric, timestampMs, value);
+}
+
+void MetricSketches::add(const MetricsSnapshot& snapshot) {
+    int64_t ts = std::chrono::duration_cast<std::chrono::milliseconds>(snapshot.timestamp.time_since_epoch()).count();
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& m : snapshot.devices) {
+        for (int metric = 0; metric < HM_DEVICE_METRIC_COUNT; metric++) {
+            insert(m.deviceIndex, metric, ts, historyMetricValue(m, metric));
+        }
+    }
+}
+
+bool MetricSketches::query(int metric, uint64_t deviceMask, int64_t windowMs, int64_t now,
+                           QuantileSketch& result) const {
+    result = QuantileSketch(config.relativeAccuracy, config.maxBuckets);
+    if (metric < 0 || metric >= HM_DEVICE_METRIC_COUNT || windowMs <= 0) return false;
+
+    size_t tier = config.tiers.size() - 1;
+    for (size_t t = 0; t < config.tiers.size(); t++) {
+        if (config.tiers[t].slotMs * config.tiers[t].slots >= windowMs) {
+            tier = t;
+            break;
+        }
+    }
+    int64_t slotMs = config.tiers[tier].slotMs;
+    int64_t first = floorDiv(now - windowMs, slotMs);
+    int64_t last = floorDiv(now, slotMs);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t index = metric; index < series.size(); index += HM_DEVICE_METRIC_COUNT) {
+        unsigned int device = static_cast<unsigned int>(index / HM_DEVICE_METRIC_COUNT);
+        if (!(deviceMask & historyDeviceBit(device)) || series[index].tiers.empty()) continue;
+
+        const Window& window = series[index].tiers[tier];
+        for (size_t s = 0; s < window.slots.size(); s++) {
+            if (window.slotIds[s] >= first && window.slotIds[s] <= last) {
+                result.merge(window.slots[s]);
+            }
+        }
+    }
+    return true;
+}
+
+unsigned int MetricSketches::deviceCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t devices = series.size() / HM_DEVICE_METRIC_COUNT;
+    return static_cast<unsigned int>(std::max(devices, uuids.size()));
+}
+
+std::string MetricSketches::deviceUuid(unsigned int index) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return index < uuids.size() ? uuids[index] : "";
+}
+
+SketchStats MetricSketches::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    SketchStats stats = {};
+    stats.samples = samples;
+    for (const auto& entry : series) {
+        if (entry.tiers.empty()) continue;
+        stats.series++;
+        for (const auto& window : entry.tiers) {
+            for (const auto& sketch : window.slots) {
+                if (sketch.getCount() > 0) stats.sketches++;
+                stats.buckets += sketch.bucketCount();
+                stats.bytes += sketch.bytes();
+            }
+        }
+    }
+    return stats;
+}
+
+void MetricSketches::saveCheckpoint(CheckpointWriter& writer) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    writer.put<double>(config.relativeAccuracy);
+    writer.put<uint32_t>(static_cast<uint32_t>(config.tiers.size()));
+    for (const auto& tier : config.tiers) {
+        writer.put<int64_t>(tier.slotMs);
+        writer.put<uint32_t>(tier.slots);
+    }
+    writer.put<uint64_t>(samples);
+    writer.put<uint32_t>(static_cast<uint32_t>(series.size()));
+
+    std::string encoded;
+    for (const auto& entry : series) {
+        writer.put<uint8_t>(entry.tiers.empty() ? 0 : 1);
+        for (const auto& window : entry.tiers) {
+            for (size_t s = 0; s < window.slots.size(); s++) {
+                writer.put<int64_t>(window.slotIds[s]);
+                if (window.slotIds[s] < 0) continue;
+                encoded.clear();
+                window.slots[s].encode(encoded);
+                writer.putString(encoded);
+            }
+        }
+    }
+}
+
+bool MetricSketches::restoreCheckpoint(CheckpointReader& reader) {
+    double accuracy = reader.get<double>();
+    uint32_t tierCount = reader.get<uint32_t>();
+    if (!reader.good() || accuracy != config.relativeAccuracy || tierCount != config.tiers.size()) return false;
+    for (const auto& tier : config.tiers) {
+        int64_t slotMs = reader.get<int64_t>();
+        uint32_t slots = reader.get<uint32_t>();
+        if (slotMs != tier.slotMs || slots != tier.slots) return false;
+    }
+    uint64_t restoredSamples = reader.get<uint64_t>();
+    uint32_t seriesCount = reader.get<uint32_t>();
+    if (!reader.good() || seriesCount % HM_DEVICE_METRIC_COUNT != 0) return false;
+
+    std::vector<Series> restored(seriesCount);
+    for (auto& entry : restored) {
+        if (reader.get<uint8_t>() == 0) continue;
+        entry.tiers.resize(config.tiers.size());
+        for (size_t t = 0; t < config.tiers.size() && reader.good(); t++) {
+            Window& window = entry.tiers[t];
+            window.slots.assign(config.tiers[t].slots, QuantileSketch(config.relativeAccuracy, config.maxBuckets));
+            window.slotIds.assign(config.tiers[t].slots, -1);
+            for (size_t s = 0; s < window.slots.size() && reader.good(); s++) {
+                window.slotIds[s] = reader.get<int64_t>();
+                if (window.slotIds[s] < 0) continue;
+                std::string encoded = reader.getString();
+                CheckpointReader sketchReader(reinterpret_cast<const uint8_t*>(encoded.data()), encoded.size());
+                if (!window.slots[s].decode(sketchReader) ||
+                    window.slots[s].getRelativeAccuracy() != config.relativeAccuracy) {
+                    return false;
+                }
+            }
+        }
+        if (!reader.good()) return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    series = std::move(restored);
+    samples = restoredSamples;
+    return true;
+}
+
+void registerSketchApi(HttpServer& server, const MetricSketches& sketches, const std::string& path) {
+    server.route(path, [&sketches](const HttpRequest& request, HttpResponse& response) {
+        response.contentType = "application/json";
+
+        int metric = historyMetricFromName(request.queryParam("metric"));
+        if (metric < 0 || metric >= HM_DEVICE_METRIC_COUNT) {
+            response.status = 400;
+            response.body = errorJson("unknown metric");
+            return;
+        }
+
+        int64_t window;
+        if (!parseHistoryDuration(request.queryParam("window", "5m"), window) || window <= 0) {
+            response.status = 400;
+            response.body = errorJson("invalid window");
+            return;
+        }
+
+        std::vector<double> quantiles;
+        for (const auto& item : splitList(request.queryParam("q", "0.5,0.9,0.99"))) {
+            bool percent = item[0] == 'p';
+            char* end = nullptr;
+            double q = std::strtod(item.c_str() + (percent ? 1 : 0), &end);
+            if (percent) q /= 100;
+            if (*end != '\0' || q < 0 || q > 1) {
+                response.status = 400;
+                response.body = errorJson("invalid quantile " + item);
+                return;
+            }
+            quantiles.push_back(q);
+        }
+
+        unsigned int deviceCount = sketches.deviceCount();
+        std::vector<unsigned int> devices;
+        std::string gpus = request.queryParam("gpu");
+        if (gpus.empty()) {
+            for (unsigned int d = 0; d < deviceCount; d++) {
+                devices.push_back(d);
+            }
+        }
+        for (const auto& item : splitList(gpus)) {
+            char* end = nullptr;
+            unsigned long index = std::strtoul(item.c_str(), &end, 10);
+            if (*end != '\0') {
+                index = deviceCount;
+                for (unsigned int d = 0; d < deviceCount; d++) {
+                    if (sketches.deviceUuid(d) == item) index = d;
+                }
+            }
+            if (index >= deviceCount) {
+                response.status = 400;
+                response.body = errorJson("unknown gpu " + item);
+                return;
+            }
+            devices.push_back(static_cast<unsigned int>(index));
+        }
+
+        int64_t now = nowMillis();
+        bool merged = request.queryParam("group", "device") == "none";
+        if (request.queryParam("format") == "sketch") {
+            uint64_t mask = 0;
+            for (unsigned int d : devices) {
+                mask |= historyDeviceBit(d);
+            }
+            QuantileSketch sketch;
+            sketches.query(metric, mask, window, now, sketch);
+            response.contentType = "application/octet-stream";
+            sketch.encode(response.body);
+            return;
+        }
+
+        std::string& out = response.body;
+        out = "{\"metric\":";
+        appendJsonString(historyMetricName(metric), out);
+        out += ",\"window\":";
+        appendNumber(static_cast<double>(window), out);
+        out += ",\"relativeAccuracy\":";
+        appendNumber(sketches.relativeAccuracy(), out);
+        out += ",\"series\":[";
+
+        std::vector<std::pair<int, uint64_t>> groups; // (gpu 또는 -1, 마스크)
+        if (merged) {
+            uint64_t mask = 0;
+            for (unsigned int d : devices) {
+                mask |= historyDeviceBit(d);
+            }
+            groups.push_back({-1, mask});
+        } else {
+            for (unsigned int d : devices) {
+                groups.push_back({static_cast<int>(d), historyDeviceBit(d)});
+            }
+        }
+
+        bool first = true;
+        QuantileSketch sketch;
+        for (const auto& group : groups) {
+            sketches.query(metric, group.second, window, now, sketch);
+            if (sketch.getCount() == 0) continue;
+            if (!first) out.push_back(',');
+            first = false;
+            out.push_back('{');
+            if (group.first >= 0) {
+                out += "\"gpu\":";
+                appendNumber(group.first, out);
+                out += ",\"uuid\":";
+                appendJsonString(sketches.deviceUuid(group.first), out);
+                out.push_back(',');
+            }
+            out += "\"count\":";
+            appendNumber(static_cast<double>(sketch.getCount()), out);
+            out += ",\"min\":";
+            appendNumber(sketch.getMin(), out);
+            out += ",\"max\":";
+            appendNumber(sketch.getMax(), out);
+            out += ",\"avg\":";
+            appendNumber(sketch.getSum() / sketch.getCount(), out);
+            out += ",\"quantiles\":[";
+            for (size_t i = 0; i < quantiles.size(); i++) {
+                if (i > 0) out.push_back(',');
+                out += "{\"q\":";
+                appendNumber(quantiles[i], out);
+                out += ",\"value\":";
+                appendNumber(sketch.quantile(quantiles[i]), out);
+                out.push_back('}');
+            }
+            out += "]}";
+        }
+        out += "]}\n";
+    });
+}
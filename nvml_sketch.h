@@ -0,0 +1,149 @@
+#ifndef NVML_SKETCH_H
+#define NVML_SKETCH_H
+
+#include "nvml_history.h"
+
+// DDSketch 분위수 스케치
+// 값 v를 로그 버킷 ceil(log_gamma(v)), gamma = (1 + a) / (1 - a)에 세므로 어떤 분위수든 상대 오차 a 이내다.
+// 버킷 수가 maxBuckets를 넘으면 가장 작은 버킷들을 합친다 (높은 분위수 정확도 유지).
+// a = 1%, 2048 버킷이면 약 9자리 범위까지 오차가 보장된다. 같은 a의 스케치끼리 버킷을 더해 합칠 수 있다
+class QuantileSketch {
+private:
+    // 연속 버킷 배열 (offset부터)
+    struct Store {
+        int32_t offset = 0;
+        std::vector<uint64_t> counts;
+    };
+
+    double relativeAccuracy;
+    double gamma;
+    double logGamma;
+    uint32_t maxBuckets;
+    Store positive;
+    Store negative;   // -v의 버킷
+    uint64_t zeroCount;
+    uint64_t count;
+    double sum;
+    double min;
+    double max;
+
+public:
+    explicit QuantileSketch(double relativeAccuracy = 0.01, uint32_t maxBuckets = 2048);
+
+    void add(double value, uint64_t weight = 1);
+    // 상대 오차가 다르면 false
+    bool merge(const QuantileSketch& other);
+    void clear();
+
+    // q는 [0, 1]. 비어 있으면 NaN
+    double quantile(double q) const;
+    uint64_t getCount() const { return count; }
+    double getSum() const { return sum; }
+    double getMin() const { return min; }
+    double getMax() const { return max; }
+    double getRelativeAccuracy() const { return relativeAccuracy; }
+    size_t bucketCount() const { return positive.counts.size() + negative.counts.size(); }
+    size_t bytes() const;
+
+    // 직렬화 (노드 간 병합, 체크포인트). 카운트는 LEB128 가변 길이
+    void encode(std::string& out) const;
+    bool decode(CheckpointReader& reader);
+
+private:
+    int32_t indexOf(double value) const;
+    double valueOf(int32_t index) const;
+    void addToStore(Store& store, int32_t index, uint64_t weight);
+};
+
+// 롤링 창 단계: slotMs 크기 슬롯 slots개의 링 (창 길이 = slotMs * slots)
+struct SketchTier {
+    int64_t slotMs;
+    uint32_t slots;
+};
+
+struct SketchConfig {
+    double relativeAccuracy = 0.01;
+    uint32_t maxBuckets = 2048;
+    std::vector<SketchTier> tiers = {
+        {10 * 1000, 30},    // 5분 (10초 슬롯)
+        {60 * 1000, 60},    // 1시간 (1분 슬롯)
+        {3600 * 1000, 24},  // 1일 (1시간 슬롯)
+    };
+};
+
+struct SketchStats {
+    size_t series;
+    size_t sketches;   // 값이 있는 슬롯
+    size_t buckets;
+    size_t bytes;
+    uint64_t samples;
+};
+
+// 디바이스 x 지표(Device 테이블 지표)별 분위수 스케치
+// 샘플마다 각 단계의 현재 슬롯 스케치에 더하고, 질의는 창에 걸친 슬롯들과 디바이스들을 합친다.
+// 슬롯은 절대 시각 번호로 식별하므로 시간이 지난 슬롯은 다음에 쓸 때 비운다 (메모리 고정)
+class MetricSketches {
+private:
+    struct Window {
+        std::vector<QuantileSketch> slots;
+        std::vector<int64_t> slotIds;   // 슬롯에 든 시각 / slotMs (-1이면 비어 있음)
+    };
+
+    struct Series {
+        std::vector<Window> tiers;
+    };
+
+    SketchConfig config;
+    mutable std::mutex mutex;
+    std::vector<Series> series;   // device * HM_DEVICE_METRIC_COUNT + metric
+    std::vector<std::string> uuids;
+    uint64_t samples;
+
+public:
+    explicit MetricSketches(const SketchConfig& config = SketchConfig());
+
+    void setDevices(const std::vector<GPUInfo>& gpus);
+    void add(const MetricsSnapshot& snapshot);
+    void add(unsigned int device, int metric, int64_t timestampMs, double value);
+
+    // now 기준 최근 windowMs 동안 deviceMask 디바이스의 스케치를 합친다
+    // 창을 덮는 가장 촘촘한 단계를 쓰고, 슬롯 경계만큼 창이 길어질 수 있다. 가장 긴 단계보다 길면 그 단계 전체
+    bool query(int metric, uint64_t deviceMask, int64_t windowMs, int64_t now, QuantileSketch& result) const;
+
+    unsigned int deviceCount() const;
+    std::string deviceUuid(unsigned int index) const;
+    double relativeAccuracy() const { return config.relativeAccuracy; }
+    SketchStats getStats() const;
+
+    // 체크포인트 (단계 구성이 바뀌었으면 복원하지 않는다)
+    void saveCheckpoint(CheckpointWriter& writer) const;
+    bool restoreCheckpoint(CheckpointReader& reader);
+
+private:
+    Series& seriesFor(unsigned int device, int metric);
+    void insert(unsigned int device, int metric, int64_t timestampMs, double value);
+};
+
+// HTTP API (/api/quantiles)
+//   metric=temperature&q=0.5,0.99&window=5m&gpu=0,1&group=device|none
+// format=sketch이면 합친 스케치를 인코딩한 바이너리 (다른 노드/GPU 스케치와 합칠 수 있다)
+void registerSketchApi(HttpServer& server, const MetricSketches& sketches, const std::string& path = "/api/quantiles");
+
+// 파이프라인 싱크: 스냅샷의 모든 디바이스 샘플을 스케치에 더한다
+class SketchSink : public MetricsSink {
+private:
+    MetricSketches& sketches;
+
+public:
+    explicit SketchSink(MetricSketches& sketches) : sketches(sketches) {}
+
+    std::string name() const override { return "sketch"; }
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override {
+        for (const auto& snapshot : batch) {
+            sketches.add(*snapshot);
+        }
+        return true;
+    }
+};
+
+#endif // NVML_SKETCH_H
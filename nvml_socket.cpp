@@ -0,0 +1,228 @@
+#include "nvml_socket.h"
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+std::string SocketAddress::toString() const {
+    if (isUnix) {
+        return "unix://" + path;
+    }
+    return "tcp://" + host + ":" + std::to_string(port);
+}
+
+bool parseSocketAddress(const std::string& text, SocketAddress& address) {
+    const std::string unixPrefix = "unix://";
+    const std::string tcpPrefix = "tcp://";
+
+    if (text.compare(0, unixPrefix.size(), unixPrefix) == 0) {
+        address.isUnix = true;
+        address.path = text.substr(unixPrefix.size());
+        return !address.path.empty() && address.path.size() < sizeof(sockaddr_un::sun_path);
+    }
+
+    std::string hostPort = text;
+    if (text.compare(0, tcpPrefix.size(), tcpPrefix) == 0) {
+        hostPort = text.substr(tcpPrefix.size());
+    }
+
+    size_t colon = hostPort.rfind(':');
+    if (colon == std::string::npos) {
+        return false;
+    }
+
+    address.isUnix = false;
+    address.host = hostPort.substr(0, colon);
+    if (address.host.empty()) {
+        address.host = "0.0.0.0";
+    }
+
+    try {
+        unsigned long port = std::stoul(hostPort.substr(colon + 1));
+        if (port > 65535) return false;
+        address.port = static_cast<uint16_t>(port);
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+static bool resolveTcp(const SocketAddress& address, sockaddr_storage& storage, socklen_t& length) {
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* result = nullptr;
+    std::string port = std::to_string(address.port);
+    if (getaddrinfo(address.host.c_str(), port.c_str(), &hints, &result) != 0 || !result) {
+        return false;
+    }
+
+    std::memcpy(&storage, result->ai_addr, result->ai_addrlen);
+    length = result->ai_addrlen;
+    freeaddrinfo(result);
+    return true;
+}
+
+int listenSocket(const SocketAddress& address, int backlog) {
+    int fd = -1;
+
+    if (address.isUnix) {
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+
+        sockaddr_un addr = {};
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, address.path.c_str(), sizeof(addr.sun_path) - 1);
+        unlink(address.path.c_str()); // 이전 실행에서 남은 소켓 파일
+
+        if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            std::cerr << "bind " << address.toString() << " failed: " << std::strerror(errno) << std::endl;
+            close(fd);
+            return -1;
+        }
+    } else {
+        sockaddr_storage storage;
+        socklen_t length;
+        if (!resolveTcp(address, storage, length)) {
+            std::cerr << "Cannot resolve " << address.toString() << std::endl;
+            return -1;
+        }
+
+        fd = socket(storage.ss_family, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+
+        int enable = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+        if (bind(fd, reinterpret_cast<sockaddr*>(&storage), length) < 0) {
+            std::cerr << "bind " << address.toString() << " failed: " << std::strerror(errno) << std::endl;
+            close(fd);
+            return -1;
+        }
+    }
+
+    if (listen(fd, backlog) < 0) {
+        std::cerr << "listen " << address.toString() << " failed: " << std::strerror(errno) << std::endl;
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+uint16_t boundPort(int fd) {
+    sockaddr_storage storage;
+    socklen_t length = sizeof(storage);
+    if (getsockname(fd, reinterpret_cast<sockaddr*>(&storage), &length) < 0) {
+        return 0;
+    }
+    if (storage.ss_family == AF_INET) {
+        return ntohs(reinterpret_cast<sockaddr_in*>(&storage)->sin_port);
+    }
+    if (storage.ss_family == AF_INET6) {
+        return ntohs(reinterpret_cast<sockaddr_in6*>(&storage)->sin6_port);
+    }
+    return 0;
+}
+
+int connectSocket(const SocketAddress& address) {
+    int fd = -1;
+
+    if (address.isUnix) {
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+
+        sockaddr_un addr = {};
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, address.path.c_str(), sizeof(addr.sun_path) - 1);
+        if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            close(fd);
+            return -1;
+        }
+    } else {
+        sockaddr_storage storage;
+        socklen_t length;
+        if (!resolveTcp(address, storage, length)) {
+            return -1;
+        }
+
+        fd = socket(storage.ss_family, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+
+        if (connect(fd, reinterpret_cast<sockaddr*>(&storage), length) < 0) {
+            close(fd);
+            return -1;
+        }
+
+        int enable = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    }
+    return fd;
+}
+
+int connectDatagramSocket(const SocketAddress& address) {
+    int fd = -1;
+
+    if (address.isUnix) {
+        fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+        if (fd < 0) return -1;
+
+        sockaddr_un addr = {};
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, address.path.c_str(), sizeof(addr.sun_path) - 1);
+        if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+            close(fd);
+            return -1;
+        }
+    } else {
+        sockaddr_storage storage;
+        socklen_t length;
+        if (!resolveTcp(address, storage, length)) {
+            return -1;
+        }
+
+        fd = socket(storage.ss_family, SOCK_DGRAM, 0);
+        if (fd < 0) return -1;
+
+        // 연결해 두면 send마다 주소 조회/라우팅을 하지 않는다
+        if (connect(fd, reinterpret_cast<sockaddr*>(&storage), length) < 0) {
+            close(fd);
+            return -1;
+        }
+    }
+    return fd;
+}
+
+bool setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0) return false;
+    return fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+bool setSendTimeout(int fd, int timeoutMs) {
+    timeval timeout;
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_usec = (timeoutMs % 1000) * 1000;
+    return setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) == 0;
+}
+
+bool sendAll(int fd, const uint8_t* data, size_t size, size_t* written) {
+    if (written) *written = 0;
+    while (size > 0) {
+        ssize_t sent = send(fd, data, size, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += sent;
+        size -= static_cast<size_t>(sent);
+        if (written) *written += static_cast<size_t>(sent);
+    }
+    return true;
+}
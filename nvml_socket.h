@@ -0,0 +1,42 @@
+#ifndef NVML_SOCKET_H
+#define NVML_SOCKET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// 소켓 주소: "tcp://host:port" 또는 "unix:///path/to/socket"
+struct SocketAddress {
+    bool isUnix = false;
+    std::string host;
+    uint16_t port = 0;
+    std::string path;
+
+    std::string toString() const;
+};
+
+// 주소 문자열 파싱
+bool parseSocketAddress(const std::string& text, SocketAddress& address);
+
+// 리스닝 소켓 생성 (실패 시 -1). TCP 포트 0이면 임시 포트가 할당된다
+int listenSocket(const SocketAddress& address, int backlog = 128);
+
+// 바인딩된 TCP 포트 조회
+uint16_t boundPort(int fd);
+
+// 블로킹 연결 (실패 시 -1)
+int connectSocket(const SocketAddress& address);
+
+// 연결된 데이터그램 소켓 (UDP 또는 unix 데이터그램, 실패 시 -1)
+int connectDatagramSocket(const SocketAddress& address);
+
+// 논블로킹 설정
+bool setNonBlocking(int fd);
+
+// 송신 타임아웃 (SO_SNDTIMEO). 이후 send가 timeoutMs 넘게 막히면 실패한다
+bool setSendTimeout(int fd, int timeoutMs);
+
+// 전체 전송 (블로킹 소켓용, 송신 타임아웃이 지나면 false). written이 있으면 실패해도 보낸 바이트 수를 담는다
+bool sendAll(int fd, const uint8_t* data, size_t size, size_t* written = nullptr);
+
+#endif // NVML_SOCKET_H
@@ -0,0 +1,423 @@
+#include "nvml_spool.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace {
+
+const size_t kRecordHeaderSize = 8;
+const char* kSegmentPrefix = "segment-";
+const char* kSegmentSuffix = ".spool";
+
+uint32_t readU32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+void writeU32(uint8_t* p, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        p[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+bool syncDirectory(const std::string& directory) {
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return false;
+    bool ok = fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+}
+
+} // namespace
+
+RateLimiter::RateLimiter(uint64_t bytesPerSecond, uint64_t burstBytes) {
+    setRate(bytesPerSecond, burstBytes);
+}
+
+void RateLimiter::setRate(uint64_t rate, uint64_t burst) {
+    bytesPerSecond = static_cast<double>(rate);
+    burstBytes = static_cast<double>(burst ? burst : rate);
+    tokens = burstBytes;
+    lastRefill = std::chrono::steady_clock::now();
+}
+
+void RateLimiter::refill() {
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - lastRefill).count();
+    lastRefill = now;
+    tokens = std::min(burstBytes, tokens + elapsed * bytesPerSecond);
+}
+
+bool RateLimiter::tryAcquire(uint64_t bytes) {
+    if (!available()) return false;
+    consume(bytes);
+    return true;
+}
+
+bool RateLimiter::available() {
+    if (bytesPerSecond <= 0) return true;
+    refill();
+    return tokens > 0;
+}
+
+void RateLimiter::consume(uint64_t bytes) {
+    if (bytesPerSecond <= 0) return;
+    tokens -= static_cast<double>(bytes);
+}
+
+void RateLimiter::acquire(uint64_t bytes) {
+    if (bytesPerSecond <= 0) return;
+    refill();
+    if (tokens <= 0) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(-tokens / bytesPerSecond));
+        refill();
+    }
+    tokens -= static_cast<double>(bytes);
+}
+
+DiskSpool::DiskSpool(const SpoolConfig& config)
+    : config(config), nextSegmentId(1), totalBytes(0), stats(), activeFd(-1), unsyncedBytes(0),
+      replaying(false), replayData(nullptr), replaySize(0), replayOffset(0) {
+    // 상한 안에 세그먼트가 여러 개 들어가야 오래된 것부터 버릴 수 있다
+    if (this->config.maxDiskBytes > 0) {
+        this->config.segmentBytes = std::max<size_t>(
+            std::min<uint64_t>(this->config.segmentBytes, this->config.maxDiskBytes / 4), 4096);
+    }
+}
+
+DiskSpool::~DiskSpool() {
+    close();
+}
+
+std::string DiskSpool::segmentPath(uint64_t id) const {
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s%020llu%s", kSegmentPrefix,
+                  static_cast<unsigned long long>(id), kSegmentSuffix);
+    return config.directory + "/" + name;
+}
+
+bool DiskSpool::open() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (mkdir(config.directory.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::cerr << "Failed to create spool directory " << config.directory << ": "
+                  << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    DIR* dir = opendir(config.directory.c_str());
+    if (!dir) {
+        std::cerr << "Failed to open spool directory " << config.directory << ": "
+                  << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    std::vector<uint64_t> ids;
+    while (struct dirent* entry = readdir(dir)) {
+        unsigned long long id;
+        char suffix[16];
+        if (std::sscanf(entry->d_name, "segment-%20llu%15s", &id, suffix) == 2 &&
+            std::strcmp(suffix, kSegmentSuffix) == 0) {
+            ids.push_back(id);
+        }
+    }
+    closedir(dir);
+    std::sort(ids.begin(), ids.end());
+
+    segments.clear();
+    totalBytes = 0;
+    for (uint64_t id : ids) {
+        std::string path = segmentPath(id);
+        struct stat st;
+        if (stat(path.c_str(), &st) != 0) continue;
+
+        // 비정상 종료로 잘린 꼬리 레코드를 잘라낸다
+        uint64_t size = recoverSegment(path, static_cast<uint64_t>(st.st_size));
+        if (size == 0) {
+            unlink(path.c_str());
+            continue;
+        }
+        segments.push_back({id, path, size});
+        totalBytes += size;
+    }
+    nextSegmentId = ids.empty() ? 1 : ids.back() + 1;
+    lastSync = std::chrono::steady_clock::now();
+    return true;
+}
+
+uint64_t DiskSpool::recoverSegment(const std::string& path, uint64_t size) {
+    int fd = ::open(path.c_str(), O_RDWR);
+    if (fd < 0) return 0;
+
+    uint64_t valid = 0;
+    std::vector<uint8_t> payload;
+    uint8_t header[kRecordHeaderSize];
+    while (valid + kRecordHeaderSize <= size) {
+        if (pread(fd, header, kRecordHeaderSize, valid) != static_cast<ssize_t>(kRecordHeaderSize)) break;
+        uint32_t length = readU32(header);
+        if (length > size - valid - kRecordHeaderSize) break;
+
+        payload.resize(length);
+        if (pread(fd, payload.data(), length, valid + kRecordHeaderSize) != static_cast<ssize_t>(length) ||
+            updateCrc32(0, payload.data(), length) != readU32(header + 4)) {
+            break;
+        }
+        valid += kRecordHeaderSize + length;
+    }
+
+    if (valid < size) {
+        std::cerr << "Spool segment " << path << ": truncating " << (size - valid)
+                  << " bytes of incomplete records" << std::endl;
+        if (ftruncate(fd, static_cast<off_t>(valid)) == 0) {
+            fdatasync(fd);
+        }
+    }
+    ::close(fd);
+    return valid;
+}
+
+void DiskSpool::close() {
+    std::lock_guard<std::mutex> lock(mutex);
+    unmapReplay();
+    replaying = false;
+    sealActiveSegment();
+}
+
+bool DiskSpool::openActiveSegment() {
+    Segment segment{nextSegmentId++, "", 0};
+    segment.path = segmentPath(segment.id);
+
+    activeFd = ::open(segment.path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (activeFd < 0) {
+        std::cerr << "Failed to create spool segment " << segment.path << ": "
+                  << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    // 새 파일의 디렉터리 엔트리도 내구성 있게
+    syncDirectory(config.directory);
+    stats.fsyncs++;
+    stats.segmentsCreated++;
+    segments.push_back(segment);
+    return true;
+}
+
+void DiskSpool::sealActiveSegment() {
+    if (activeFd < 0) return;
+    syncLocked();
+    ::close(activeFd);
+    activeFd = -1;
+}
+
+bool DiskSpool::syncLocked() {
+    if (activeFd < 0 || unsyncedBytes == 0) return true;
+    bool ok = fdatasync(activeFd) == 0;
+    stats.fsyncs++;
+    unsyncedBytes = 0;
+    lastSync = std::chrono::steady_clock::now();
+    return ok;
+}
+
+bool DiskSpool::evictFor(uint64_t bytes) {
+    if (config.maxDiskBytes == 0) return true;
+
+    // 재생 중인 맨 앞 세그먼트와 활성 세그먼트는 지우지 않는다
+    size_t index = replaying ? 1 : 0;
+    while (totalBytes + bytes > config.maxDiskBytes) {
+        bool isActive = activeFd >= 0 && index + 1 == segments.size();
+        if (index >= segments.size() || isActive) {
+            return false;
+        }
+        const Segment& victim = segments[index];
+        unlink(victim.path.c_str());
+        totalBytes -= victim.size;
+        stats.segmentsEvicted++;
+        stats.bytesEvicted += victim.size;
+        segments.erase(segments.begin() + index);
+    }
+    return true;
+}
+
+bool DiskSpool::append(const uint8_t* data, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    uint64_t recordBytes = kRecordHeaderSize + size;
+
+    if (activeFd >= 0 && segments.back().size > 0 && segments.back().size + recordBytes > config.segmentBytes) {
+        sealActiveSegment();
+    }
+    if (!evictFor(recordBytes)) {
+        // 활성 세그먼트를 닫으면 지울 수 있는 세그먼트가 생길 수 있다
+        sealActiveSegment();
+        if (!evictFor(recordBytes)) {
+            stats.recordsRejected++;
+            return false;
+        }
+    }
+    if (activeFd < 0 && !openActiveSegment()) {
+        stats.recordsRejected++;
+        return false;
+    }
+
+    uint8_t header[kRecordHeaderSize];
+    writeU32(header, static_cast<uint32_t>(size));
+    writeU32(header + 4, updateCrc32(0, data, size));
+
+    struct iovec iov[2];
+    iov[0].iov_base = header;
+    iov[0].iov_len = kRecordHeaderSize;
+    iov[1].iov_base = const_cast<uint8_t*>(data);
+    iov[1].iov_len = size;
+
+    ssize_t written = writev(activeFd, iov, 2);
+    if (written != static_cast<ssize_t>(recordBytes)) {
+        // 일부만 쓰였으면 세그먼트 끝을 원래대로 되돌린다
+        std::cerr << "Spool write failed: " << std::strerror(errno) << std::endl;
+        if (written > 0 && ftruncate(activeFd, static_cast<off_t>(segments.back().size)) != 0) {
+            sealActiveSegment();
+        }
+        stats.recordsRejected++;
+        return false;
+    }
+
+    segments.back().size += recordBytes;
+    totalBytes += recordBytes;
+    unsyncedBytes += recordBytes;
+    stats.recordsAppended++;
+    stats.payloadBytes += size;
+    stats.bytesWritten += recordBytes;
+
+    if (unsyncedBytes >= config.fsyncBytes ||
+        std::chrono::steady_clock::now() - lastSync >= std::chrono::milliseconds(config.fsyncIntervalMs)) {
+        syncLocked();
+    }
+    return true;
+}
+
+void DiskSpool::syncIfDue() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (std::chrono::steady_clock::now() - lastSync >= std::chrono::milliseconds(config.fsyncIntervalMs)) {
+        syncLocked();
+    }
+}
+
+bool DiskSpool::sync() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return syncLocked();
+}
+
+bool DiskSpool::empty() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return totalBytes == 0;
+}
+
+uint64_t DiskSpool::diskBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return totalBytes;
+}
+
+SpoolStats DiskSpool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+bool DiskSpool::beginReplay() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (replaying) return true;
+
+    // 빈 세그먼트는 건너뛰고, 남은 것이 활성 세그먼트뿐이면 봉인해서 읽는다
+    while (!segments.empty() && segments.front().size == 0 && !(activeFd >= 0 && segments.size() == 1)) {
+        unlink(segments.front().path.c_str());
+        segments.pop_front();
+    }
+    if (segments.empty() || segments.front().size == 0) return false;
+    if (activeFd >= 0 && segments.size() == 1) {
+        sealActiveSegment();
+    }
+
+    const Segment& segment = segments.front();
+    int fd = ::open(segment.path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        std::cerr << "Failed to open spool segment " << segment.path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    void* mapped = mmap(nullptr, segment.size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "Failed to map spool segment " << segment.path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    madvise(mapped, segment.size, MADV_SEQUENTIAL);
+
+    replayData = static_cast<const uint8_t*>(mapped);
+    replaySize = segment.size;
+    replayOffset = 0;
+    replaying = true;
+    return true;
+}
+
+bool DiskSpool::nextRecord(const uint8_t*& data, uint32_t& size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!replaying || replayOffset + kRecordHeaderSize > replaySize) return false;
+
+    const uint8_t* header = replayData + replayOffset;
+    uint32_t length = readU32(header);
+    if (length > replaySize - replayOffset - kRecordHeaderSize ||
+        updateCrc32(0, header + kRecordHeaderSize, length) != readU32(header + 4)) {
+        // 손상된 레코드 이후는 신뢰할 수 없으므로 세그먼트 끝으로 취급
+        std::cerr << "Spool segment " << segments.front().path << ": corrupt record at offset "
+                  << replayOffset << std::endl;
+        stats.corruptSegments++;
+        replayOffset = replaySize;
+        return false;
+    }
+
+    data = header + kRecordHeaderSize;
+    size = length;
+    replayOffset += kRecordHeaderSize + length;
+    stats.recordsReplayed++;
+    stats.bytesReplayed += length;
+    return true;
+}
+
+void DiskSpool::rewindReplay() {
+    std::lock_guard<std::mutex> lock(mutex);
+    replayOffset = 0;
+}
+
+void DiskSpool::finishReplay() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!replaying) return;
+
+    unmapReplay();
+    replaying = false;
+    const Segment& segment = segments.front();
+    unlink(segment.path.c_str());
+    totalBytes -= segment.size;
+    stats.segmentsRemoved++;
+    segments.pop_front();
+}
+
+void DiskSpool::abortReplay() {
+    std::lock_guard<std::mutex> lock(mutex);
+    unmapReplay();
+    replaying = false;
+}
+
+void DiskSpool::unmapReplay() {
+    if (replayData) {
+        munmap(const_cast<uint8_t*>(replayData), replaySize);
+        replayData = nullptr;
+        replaySize = 0;
+        replayOffset = 0;
+    }
+}
@@ -0,0 +1,126 @@
+#ifndef NVML_SPOOL_H
+#define NVML_SPOOL_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// 디스크 스풀 설정
+struct SpoolConfig {
+    std::string directory;                   // 비어 있으면 스풀 사용 안 함
+    size_t segmentBytes = 16 * 1024 * 1024;  // 세그먼트 파일 크기 (넘으면 새 파일)
+    uint64_t maxDiskBytes = 1024ULL * 1024 * 1024; // 전체 디스크 상한 (넘으면 오래된 세그먼트부터 삭제)
+    size_t fsyncBytes = 1024 * 1024;         // 이만큼 쌓이면 fdatasync
+    int fsyncIntervalMs = 1000;              // 또는 이 시간이 지나면 fdatasync
+};
+
+// 스풀 통계 (쓰기 증폭 = bytesWritten / payloadBytes)
+struct SpoolStats {
+    uint64_t recordsAppended;
+    uint64_t recordsRejected;  // 상한 때문에 쓰지 못한 레코드
+    uint64_t payloadBytes;     // 호출자가 넘긴 바이트
+    uint64_t bytesWritten;     // 레코드 헤더 포함 실제 write 바이트
+    uint64_t fsyncs;           // 파일 + 디렉터리 fsync
+    uint64_t segmentsCreated;
+    uint64_t segmentsRemoved;  // 재생 완료 후 삭제
+    uint64_t segmentsEvicted;  // 디스크 상한으로 삭제 (데이터 유실)
+    uint64_t bytesEvicted;
+    uint64_t recordsReplayed;
+    uint64_t bytesReplayed;
+    uint64_t corruptSegments;  // CRC 불일치로 중간에 끊긴 세그먼트
+};
+
+// 바이트/초 토큰 버킷 (0이면 무제한)
+// 토큰이 양수이면 요청 크기만큼 빚을 지고 통과시켜 큰 요청도 굶지 않는다
+class RateLimiter {
+private:
+    double bytesPerSecond;
+    double burstBytes;
+    double tokens;
+    std::chrono::steady_clock::time_point lastRefill;
+
+public:
+    explicit RateLimiter(uint64_t bytesPerSecond = 0, uint64_t burstBytes = 0);
+
+    void setRate(uint64_t bytesPerSecond, uint64_t burstBytes);
+    bool tryAcquire(uint64_t bytes);
+    // 지금 보낼 수 있는지 (크기를 미리 모를 때 available 후 consume)
+    bool available();
+    void consume(uint64_t bytes);
+    // 토큰이 생길 때까지 잠든 뒤 차감
+    void acquire(uint64_t bytes);
+
+private:
+    void refill();
+};
+
+// 세그먼트 단위 append-only 디스크 스풀
+// 레코드: [길이 u32][CRC32 u32][payload] (리틀 엔디언)
+// 재생은 가장 오래된 세그먼트를 mmap으로 순차 읽고, 호출자가 완료를 알리면 파일을 삭제한다.
+// 완료 전에 프로세스가 죽으면 그 세그먼트는 처음부터 다시 재생된다 (at-least-once)
+class DiskSpool {
+private:
+    struct Segment {
+        uint64_t id;
+        std::string path;
+        uint64_t size;
+    };
+
+    SpoolConfig config;
+    std::deque<Segment> segments; // 오래된 것부터, 쓰는 중이면 마지막이 활성 세그먼트
+    uint64_t nextSegmentId;
+    uint64_t totalBytes;
+    mutable std::mutex mutex;
+    SpoolStats stats;
+
+    // 쓰기 상태
+    int activeFd;
+    size_t unsyncedBytes;
+    std::chrono::steady_clock::time_point lastSync;
+
+    // 재생 상태 (segments.front()를 mmap)
+    bool replaying;
+    const uint8_t* replayData;
+    size_t replaySize;
+    size_t replayOffset;
+
+public:
+    explicit DiskSpool(const SpoolConfig& config);
+    ~DiskSpool();
+
+    // 디렉터리 생성 및 기존 세그먼트 복구 (잘린 마지막 레코드는 잘라낸다)
+    bool open();
+    void close();
+
+    bool append(const uint8_t* data, size_t size);
+    // 배치 fsync 주기가 지났으면 동기화
+    void syncIfDue();
+    bool sync();
+
+    bool empty() const;
+    uint64_t diskBytes() const;
+    SpoolStats getStats() const;
+
+    // 재생
+    bool beginReplay();
+    bool nextRecord(const uint8_t*& data, uint32_t& size);
+    void rewindReplay();
+    void finishReplay(); // 현재 세그먼트 삭제
+    void abortReplay();  // 세그먼트는 남겨 둔다
+    bool isReplaying() const { return replaying; }
+
+private:
+    bool openActiveSegment();
+    void sealActiveSegment();
+    bool syncLocked();
+    bool evictFor(uint64_t bytes);
+    void unmapReplay();
+    std::string segmentPath(uint64_t id) const;
+    static uint64_t recoverSegment(const std::string& path, uint64_t size);
+};
+
+#endif // NVML_SPOOL_H
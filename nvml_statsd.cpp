@@ -0,0 +1,320 @@
+#include "nvml_statsd.h"
+#include "nvml_influx.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <unistd.h>
+
+namespace {
+
+// sendmmsg 한 번에 보낼 최대 패킷 수
+const size_t kMaxPacketsPerCall = 64;
+
+// GPU 게이지 정의 (StatsD 이름, 값)
+struct StatsdGauge {
+    const char* name;
+    unsigned long long (*value)(const GPUMetrics&);
+};
+
+const StatsdGauge kGauges[] = {
+    {"gpu.utilization", [](const GPUMetrics& m) -> unsigned long long { return m.gpuUtilization; }},
+    {"memory.utilization", [](const GPUMetrics& m) -> unsigned long long { return m.memoryUtilization; }},
+    {"encoder.utilization", [](const GPUMetrics& m) -> unsigned long long { return m.encoderUtilization; }},
+    {"decoder.utilization", [](const GPUMetrics& m) -> unsigned long long { return m.decoderUtilization; }},
+    {"memory.used", [](const GPUMetrics& m) -> unsigned long long { return m.memoryUsed; }},
+    {"memory.total", [](const GPUMetrics& m) -> unsigned long long { return m.memoryTotal; }},
+    {"temperature", [](const GPUMetrics& m) -> unsigned long long { return m.temperature; }},
+    {"fan.speed", [](const GPUMetrics& m) -> unsigned long long { return m.fanSpeed; }},
+    {"power.usage", [](const GPUMetrics& m) -> unsigned long long { return m.powerUsage; }},
+    {"power.limit", [](const GPUMetrics& m) -> unsigned long long { return m.powerLimit; }},
+    {"clock.sm", [](const GPUMetrics& m) -> unsigned long long { return m.smClock; }},
+    {"clock.memory", [](const GPUMetrics& m) -> unsigned long long { return m.memoryClock; }},
+    {"clock.graphics", [](const GPUMetrics& m) -> unsigned long long { return m.graphicsClock; }},
+    {"ecc.single_bit", [](const GPUMetrics& m) -> unsigned long long { return m.eccSingleBit; }},
+    {"ecc.double_bit", [](const GPUMetrics& m) -> unsigned long long { return m.eccDoubleBit; }},
+};
+
+} // namespace
+
+StatsdTagCache::StatsdTagCache(const std::vector<GPUInfo>& gpus, const std::vector<std::string>& constantTags)
+    : tick(0) {
+    for (const auto& tag : constantTags) {
+        constant.push_back(',');
+        appendTagValue(tag, TagSyntax::Statsd, constant);
+    }
+
+    for (const auto& gpu : gpus) {
+        if (gpu.index >= deviceBase.size()) {
+            deviceBase.resize(gpu.index + 1);
+        }
+        std::string& text = deviceBase[gpu.index];
+        text = "gpu:" + std::to_string(gpu.index);
+        if (!gpu.uuid.empty()) {
+            text += ",uuid:";
+            appendTagValue(gpu.uuid, TagSyntax::Statsd, text);
+        }
+        if (!gpu.name.empty()) {
+            text += ",name:";
+            appendTagValue(gpu.name, TagSyntax::Statsd, text);
+        }
+    }
+}
+
+const std::string& StatsdTagCache::base(unsigned int index) {
+    // 초기화 이후 나타난 디바이스는 인덱스 태그만
+    if (index >= deviceBase.size()) {
+        deviceBase.resize(index + 1);
+    }
+    if (deviceBase[index].empty()) {
+        deviceBase[index] = "gpu:" + std::to_string(index);
+    }
+    return deviceBase[index];
+}
+
+const std::string& StatsdTagCache::device(unsigned int index) {
+    if (index >= deviceTags.size()) {
+        deviceTags.resize(index + 1);
+    }
+    std::string& tags = deviceTags[index];
+    if (tags.empty()) {
+        tags = "|#" + base(index) + constant;
+    }
+    return tags;
+}
+
+const std::string& StatsdTagCache::process(const ProcessInfo& process) {
+    uint64_t key = (static_cast<uint64_t>(process.deviceIndex) << 32) | process.pid;
+    ProcessEntry& entry = processTags[key];
+    entry.lastTick = tick;
+
+    // PID가 재사용되어 이름이 바뀐 경우에만 다시 만든다
+    if (entry.tags.empty() || entry.name != process.nameId) {
+        entry.name = process.nameId;
+        entry.tags = "|#" + base(process.deviceIndex) + ",pid:" + std::to_string(process.pid) + ",process:";
+        appendTagValue(internedString(process.nameId), TagSyntax::Statsd, entry.tags);
+        entry.tags += constant;
+    }
+    return entry.tags;
+}
+
+const std::string& StatsdTagCache::mig(unsigned int parentIndex, const std::string& migUuid,
+                                       unsigned int gpuInstanceId) {
+    auto it = migTags.find(migUuid);
+    if (it != migTags.end()) {
+        return it->second;
+    }
+
+    std::string tags = "|#" + base(parentIndex) + ",mig_uuid:";
+    appendTagValue(migUuid, TagSyntax::Statsd, tags);
+    tags += ",mig_slice:" + std::to_string(gpuInstanceId) + constant;
+    return migTags.emplace(migUuid, std::move(tags)).first->second;
+}
+
+void StatsdTagCache::endTick(unsigned int idleTicks) {
+    tick++;
+    for (auto it = processTags.begin(); it != processTags.end();) {
+        if (tick - it->second.lastTick > idleTicks) {
+            it = processTags.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+StatsdEmitter::StatsdEmitter(const StatsdConfig& config) : config(config), fd(-1), current(0), stats() {
+    this->config.maxPacketBytes = std::max<size_t>(this->config.maxPacketBytes, 64);
+    packets.resize(this->config.maxPacketBytes * 8);
+    lengths.assign(8, 0);
+}
+
+StatsdEmitter::~StatsdEmitter() {
+    close();
+}
+
+bool StatsdEmitter::open() {
+    if (fd >= 0) return true;
+
+    std::string text = config.address;
+    const std::string udpPrefix = "udp://";
+    if (text.compare(0, udpPrefix.size(), udpPrefix) == 0) {
+        text = text.substr(udpPrefix.size());
+    }
+    if (!parseSocketAddress(text, address)) {
+        std::cerr << "Invalid StatsD address: " << config.address << std::endl;
+        return false;
+    }
+
+    fd = connectDatagramSocket(address);
+    if (fd < 0) {
+        std::cerr << "Failed to open StatsD socket " << config.address << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void StatsdEmitter::close() {
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+void StatsdEmitter::metric(const std::string& scope, const char* name, unsigned long long value, char type,
+                           const std::string& tags) {
+    char digits[24];
+    size_t digitCount = formatUInt(value, digits) - digits;
+    size_t nameLength = std::strlen(name);
+    size_t lineLength = config.prefix.size() + scope.size() + nameLength + 1 + digitCount + 2 + tags.size() + 1;
+
+    if (lineLength > config.maxPacketBytes) {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.droppedLines++;
+        return;
+    }
+
+    // 현재 패킷에 들어가지 않으면 다음 슬롯으로
+    if (lengths[current] + lineLength > config.maxPacketBytes) {
+        current++;
+        if (current == lengths.size()) {
+            lengths.push_back(0);
+            packets.resize(lengths.size() * config.maxPacketBytes);
+        }
+        lengths[current] = 0;
+    }
+
+    char* out = slot(current) + lengths[current];
+    std::memcpy(out, config.prefix.data(), config.prefix.size());
+    out += config.prefix.size();
+    std::memcpy(out, scope.data(), scope.size());
+    out += scope.size();
+    std::memcpy(out, name, nameLength);
+    out += nameLength;
+    *out++ = ':';
+    std::memcpy(out, digits, digitCount);
+    out += digitCount;
+    *out++ = '|';
+    *out++ = type;
+    std::memcpy(out, tags.data(), tags.size());
+    out += tags.size();
+    *out++ = '\n';
+    lengths[current] += lineLength;
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    stats.metrics++;
+}
+
+bool StatsdEmitter::flush() {
+    size_t count = lengths[current] > 0 ? current + 1 : current;
+    if (count == 0) return true;
+
+    if (fd < 0 && !open()) {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.droppedPackets += count;
+        lengths.assign(lengths.size(), 0);
+        current = 0;
+        return false;
+    }
+
+    iov.resize(count);
+    messages.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        // 마지막 개행은 빼도 되지만 DogStatsD/StatsD 모두 허용하므로 그대로 보낸다
+        iov[i].iov_base = slot(i);
+        iov[i].iov_len = lengths[i];
+        std::memset(&messages[i], 0, sizeof(mmsghdr));
+        messages[i].msg_hdr.msg_iov = &iov[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    uint64_t sentPackets = 0, sentBytes = 0, dropped = 0, syscalls = 0;
+    size_t next = 0;
+    while (next < count) {
+        unsigned int batch = static_cast<unsigned int>(std::min(count - next, kMaxPacketsPerCall));
+        int sent = sendmmsg(fd, &messages[next], batch, MSG_DONTWAIT);
+        syscalls++;
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            // 수신측이 없거나(ECONNREFUSED) 버퍼가 찼으면 해당 패킷만 버리고 계속
+            dropped++;
+            next++;
+            continue;
+        }
+        for (int i = 0; i < sent; i++) {
+            sentBytes += messages[next + i].msg_len;
+        }
+        sentPackets += sent;
+        next += sent;
+    }
+
+    lengths.assign(lengths.size(), 0);
+    current = 0;
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    stats.packets += sentPackets;
+    stats.bytes += sentBytes;
+    stats.syscalls += syscalls;
+    stats.droppedPackets += dropped;
+    return dropped == 0;
+}
+
+StatsdStats StatsdEmitter::getStats() {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return stats;
+}
+
+StatsdSink::StatsdSink(const StatsdConfig& config, const std::vector<GPUInfo>& gpus)
+    : config(config), emitter(config), tags(gpus, config.constantTags) {
+}
+
+bool StatsdSink::open() {
+    return emitter.open();
+}
+
+void StatsdSink::close() {
+    emitter.flush();
+    emitter.close();
+}
+
+const std::string& StatsdSink::scope(unsigned int index) {
+    if (config.dogstatsd) return empty;
+
+    if (index >= deviceScopes.size()) {
+        deviceScopes.resize(index + 1);
+    }
+    if (deviceScopes[index].empty()) {
+        deviceScopes[index] = "gpu." + std::to_string(index) + ".";
+    }
+    return deviceScopes[index];
+}
+
+bool StatsdSink::exportBatch(const std::vector<SnapshotPtr>& batch) {
+    // UDP는 재전송하지 않으므로 실패해도 true (손실은 통계에 남는다)
+    for (const auto& snapshot : batch) {
+        for (const auto& m : snapshot->devices) {
+            const std::string& deviceScope = scope(m.deviceIndex);
+            const std::string& deviceTags = config.dogstatsd ? tags.device(m.deviceIndex) : empty;
+            for (const auto& gauge : kGauges) {
+                emitter.metric(deviceScope, gauge.name, gauge.value(m), 'g', deviceTags);
+            }
+        }
+
+        for (const auto& p : snapshot->processes) {
+            if (config.dogstatsd) {
+                emitter.metric(empty, "process.memory.used", p.usedGpuMemory, 'g', tags.process(p));
+            } else {
+                processScope = scope(p.deviceIndex);
+                processScope += "process.";
+                processScope += std::to_string(p.pid);
+                processScope.push_back('.');
+                emitter.metric(processScope, "memory.used", p.usedGpuMemory, 'g', empty);
+            }
+        }
+
+        // 틱 경계마다 보낸다
+        emitter.flush();
+        tags.endTick(config.tagIdleTicks);
+    }
+    return true;
+}
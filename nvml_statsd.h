@@ -0,0 +1,123 @@
+#ifndef NVML_STATSD_H
+#define NVML_STATSD_H
+
+#include "nvml_exporter.h"
+#include "nvml_socket.h"
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <sys/socket.h>
+
+struct StatsdConfig {
+    std::string address = "127.0.0.1:8125"; // "udp://host:port", "host:port" 또는 "unix:///path" (DogStatsD UDS)
+    std::string prefix = "nvml.";
+    bool dogstatsd = true;          // |#태그 확장. false면 GPU 인덱스를 지표 이름에 넣는다
+    size_t maxPacketBytes = 1432;   // 1500 MTU - IP/UDP 헤더 여유
+    std::vector<std::string> constantTags; // 모든 지표에 붙는 태그 (예: "env:prod")
+    unsigned int tagIdleTicks = 60; // 이 틱 수 동안 보이지 않은 프로세스 태그는 버린다
+};
+
+struct StatsdStats {
+    uint64_t metrics;
+    uint64_t packets;
+    uint64_t bytes;
+    uint64_t syscalls;       // sendmmsg 호출 수
+    uint64_t droppedPackets; // 전송 실패 (수신측 없음, 소켓 버퍼 부족 등)
+    uint64_t droppedLines;   // 한 줄이 패킷보다 큼
+};
+
+// 태그 꼬리 문자열("|#gpu:0,uuid:...,name:...") 인터닝
+// GPU/MIG 슬라이스/프로세스마다 한 번만 만들고 이후에는 참조만 넘긴다
+class StatsdTagCache {
+private:
+    struct ProcessEntry {
+        InternId name;
+        std::string tags;
+        uint64_t lastTick;
+    };
+
+    std::string constant;                 // ",env:prod"
+    std::vector<std::string> deviceBase;  // "gpu:0,uuid:...,name:..." (인덱스별, 접두/접미 없음)
+    std::vector<std::string> deviceTags;
+    std::unordered_map<uint64_t, ProcessEntry> processTags; // (디바이스 << 32) | pid
+    std::unordered_map<std::string, std::string> migTags;   // MIG UUID
+    uint64_t tick;
+
+public:
+    StatsdTagCache(const std::vector<GPUInfo>& gpus, const std::vector<std::string>& constantTags);
+
+    const std::string& device(unsigned int index);
+    const std::string& process(const ProcessInfo& process);
+    const std::string& mig(unsigned int parentIndex, const std::string& migUuid, unsigned int gpuInstanceId);
+
+    // 틱 끝에서 호출. idleTicks 동안 보이지 않은 프로세스 태그를 정리한다
+    void endTick(unsigned int idleTicks);
+    size_t size() const { return processTags.size() + migTags.size(); }
+
+private:
+    const std::string& base(unsigned int index);
+};
+
+// StatsD 라인을 MTU 크기 패킷에 채워 틱마다 sendmmsg로 한꺼번에 보낸다
+// 패킷/iovec/mmsghdr 버퍼는 재사용한다
+class StatsdEmitter {
+private:
+    StatsdConfig config;
+    SocketAddress address;
+    int fd;
+
+    std::vector<char> packets;   // maxPacketBytes 크기 슬롯을 이어 붙인 버퍼
+    std::vector<size_t> lengths; // 슬롯별 사용 길이
+    size_t current;              // 채우는 중인 슬롯
+    std::vector<iovec> iov;
+    std::vector<mmsghdr> messages;
+
+    std::mutex statsMutex;
+    StatsdStats stats;
+
+public:
+    explicit StatsdEmitter(const StatsdConfig& config);
+    ~StatsdEmitter();
+
+    bool open();
+    void close();
+
+    // "<prefix><scope><name>:<value>|<type><tags>"
+    // scope는 태그 없는 StatsD에서 "gpu.0." 같은 이름 중간 부분, tags는 StatsdTagCache 결과
+    void metric(const std::string& scope, const char* name, unsigned long long value, char type,
+                const std::string& tags);
+
+    // 채운 패킷을 모두 보내고 버퍼를 비운다
+    bool flush();
+
+    StatsdStats getStats();
+
+private:
+    char* slot(size_t index) { return packets.data() + index * config.maxPacketBytes; }
+};
+
+// 스냅샷마다 GPU/프로세스 게이지를 보내는 싱크 (틱 경계에서 flush)
+class StatsdSink : public MetricsSink {
+private:
+    StatsdConfig config;
+    StatsdEmitter emitter;
+    StatsdTagCache tags;
+    std::vector<std::string> deviceScopes; // 태그 없는 모드의 "gpu.<index>."
+    std::string processScope;              // 태그 없는 모드의 "gpu.<index>.process.<pid>."
+    const std::string empty;
+
+public:
+    StatsdSink(const StatsdConfig& config, const std::vector<GPUInfo>& gpus);
+
+    std::string name() const override { return "statsd"; }
+    bool open() override;
+    void close() override;
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override;
+
+    StatsdStats getStats() { return emitter.getStats(); }
+
+private:
+    const std::string& scope(unsigned int index);
+};
+
+#endif // NVML_STATSD_H
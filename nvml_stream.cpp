@@ -0,0 +1,429 @@
+#include "nvml_stream.h"
+#include <algorithm>
+#include <iostream>
+#include <cerrno>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+const size_t kReadChunk = 4096;
+const int kIdleWaitMs = 100; // ACK 확인 주기
+
+} // namespace
+
+WireStreamClient::WireStreamClient(const StreamClientConfig& config)
+    : config(config), unsentIndex(0), running(false), flushRequested(false), stats(), fd(-1),
+      connectedOnce(false), framesSinceKeyframe(0), lastAckedSequence(0), replayDone(false),
+      replayLastSequence(0) {
+    // 재시작 후에도 시퀀스가 이전 실행(스풀에 남은 틱)보다 커지도록 시작 시각(us)에서 시작
+    nextSequence = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+
+    if (this->config.ticksPerFrame == 0) this->config.ticksPerFrame = 1;
+    if (this->config.maxPendingTicks < this->config.ticksPerFrame) {
+        this->config.maxPendingTicks = this->config.ticksPerFrame;
+    }
+}
+
+WireStreamClient::~WireStreamClient() {
+    stop();
+}
+
+void WireStreamClient::setDevices(const std::vector<WireDeviceDecl>& decls) {
+    std::lock_guard<std::mutex> lock(mutex);
+    devices = decls;
+}
+
+bool WireStreamClient::start() {
+    if (running) return false;
+
+    if (!parseSocketAddress(config.address, address)) {
+        std::cerr << "Invalid stream address: " << config.address << std::endl;
+        return false;
+    }
+
+    if (!config.spool.directory.empty()) {
+        spool = std::make_unique<DiskSpool>(config.spool);
+        if (!spool->open()) {
+            spool.reset();
+            return false;
+        }
+        drainLimiter.setRate(config.drainBytesPerSecond, config.drainBytesPerSecond);
+    }
+
+    flushRequested = false;
+    running = true;
+    senderThread = std::thread(&WireStreamClient::senderLoop, this);
+    return true;
+}
+
+void WireStreamClient::stop() {
+    if (!running) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        flushRequested = true;
+    }
+    cv.notify_all();
+
+    if (senderThread.joinable()) {
+        senderThread.join();
+    }
+    running = false;
+    disconnect();
+    if (spool) {
+        spool->close();
+    }
+}
+
+void WireStreamClient::submit(uint64_t timestampMs, const std::vector<WireSample>& samples) {
+    bool ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // 상한 초과 시 가장 오래된 틱을 버린다 (스풀이 있으면 송신 스레드가 먼저 디스크로 옮긴다)
+        size_t limit = spool ? config.maxPendingTicks * 2 : config.maxPendingTicks;
+        if (pending.size() >= limit) {
+            spareSamples.push_back(std::move(pending.front().samples));
+            pending.pop_front();
+            if (unsentIndex > 0) unsentIndex--;
+            stats.ticksDropped++;
+        }
+
+        WireTick tick;
+        tick.sequence = nextSequence++;
+        tick.timestampMs = timestampMs;
+        if (!spareSamples.empty()) {
+            tick.samples = std::move(spareSamples.back());
+            spareSamples.pop_back();
+        }
+        tick.samples.assign(samples.begin(), samples.end());
+        pending.push_back(std::move(tick));
+
+        stats.ticksSubmitted++;
+        ready = pending.size() - unsentIndex >= config.ticksPerFrame ||
+                (spool && pending.size() > config.maxPendingTicks);
+    }
+    if (ready) {
+        cv.notify_one();
+    }
+}
+
+StreamClientStats WireStreamClient::getStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+SpoolStats WireStreamClient::getSpoolStats() {
+    return spool ? spool->getStats() : SpoolStats();
+}
+
+void WireStreamClient::senderLoop() {
+    while (true) {
+        bool flush;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            flush = flushRequested;
+        }
+
+        if (spool) {
+            spillPending(false);
+            spool->syncIfDue();
+        }
+
+        if (fd < 0) {
+            auto now = std::chrono::steady_clock::now();
+            if (now >= nextConnectAttempt && !connectAndHandshake()) {
+                nextConnectAttempt = now + std::chrono::milliseconds(config.reconnectIntervalMs);
+            }
+            if (fd < 0) {
+                if (flush) {
+                    // 종료 중에는 재연결을 기다리지 않고 남은 틱을 디스크에 남긴다
+                    spillPending(true);
+                    break;
+                }
+                // 연결을 기다리는 동안에도 넘친 틱은 스풀로 옮긴다
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait_until(lock, nextConnectAttempt, [this] {
+                    return flushRequested || (spool && pending.size() > config.maxPendingTicks);
+                });
+                continue;
+            }
+        }
+
+        if (!readAcks() || !drainSpool() || !sendPending(flush)) {
+            disconnect();
+            // 종료 중 송신이 막혀 끊겼으면 재연결하지 않고 남은 틱을 디스크에 남긴다
+            std::unique_lock<std::mutex> lock(mutex);
+            if (flushRequested) {
+                lock.unlock();
+                spillPending(true);
+                break;
+            }
+            continue;
+        }
+        if (flush) {
+            // 스풀 재생이 끝나지 않아 보내지 못한 틱은 다음 실행에서 재생
+            spillPending(true);
+            break;
+        }
+
+        // 배치가 찰 때까지 대기 (주기적으로 깨어나 ACK를 읽는다)
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait_for(lock, std::chrono::milliseconds(kIdleWaitMs), [this] {
+            return flushRequested || pending.size() - unsentIndex >= config.ticksPerFrame ||
+                   (spool && pending.size() > config.maxPendingTicks);
+        });
+    }
+}
+
+bool WireStreamClient::connectAndHandshake() {
+    int newFd = connectSocket(address);
+    if (newFd < 0) {
+        return false;
+    }
+
+    sendBuffer.clear();
+    WireEncoder encoder(sendBuffer);
+    encoder.hello(config.nodeName);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        encoder.devices(devices);
+        if (connectedOnce) stats.reconnects++;
+    }
+    if ((config.sendTimeoutMs > 0 && !setSendTimeout(newFd, config.sendTimeoutMs)) ||
+        !sendAll(newFd, sendBuffer.data(), sendBuffer.size())) {
+        close(newFd);
+        return false;
+    }
+
+    // 새 연결의 디코더 상태는 비어 있으므로 첫 프레임은 키프레임
+    fd = newFd;
+    connectedOnce = true;
+    delta.reset();
+    framesSinceKeyframe = config.keyframeInterval;
+    readBuffer.clear();
+    return true;
+}
+
+void WireStreamClient::disconnect() {
+    if (fd < 0) return;
+    close(fd);
+    fd = -1;
+
+    // ACK 받지 못한 틱은 다음 연결에서 처음부터 다시 보낸다
+    if (spool && spool->isReplaying()) {
+        spool->rewindReplay();
+        replayDone = false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    unsentIndex = 0;
+}
+
+bool WireStreamClient::readAcks() {
+    uint64_t acked = 0;
+    bool gotAck = false;
+
+    while (true) {
+        size_t offset = readBuffer.size();
+        readBuffer.resize(offset + kReadChunk);
+        ssize_t n = recv(fd, readBuffer.data() + offset, kReadChunk, MSG_DONTWAIT);
+        if (n > 0) {
+            readBuffer.resize(offset + n);
+            continue;
+        }
+        readBuffer.resize(offset);
+        if (n == 0) return false;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        if (errno == EINTR) continue;
+        return false;
+    }
+
+    size_t pos = 0;
+    while (pos < readBuffer.size()) {
+        WireFrameType type;
+        const uint8_t* payload;
+        uint32_t payloadSize;
+        size_t frameSize;
+        WireParseResult result = parseWireFrame(readBuffer.data() + pos, readBuffer.size() - pos,
+                                                type, payload, payloadSize, frameSize);
+        if (result == WireParseResult::NeedMore) break;
+        if (result == WireParseResult::Error) return false;
+
+        uint64_t sequence;
+        if (type == WIRE_FRAME_ACK && decodeWireAck(payload, payloadSize, sequence)) {
+            acked = std::max(acked, sequence);
+            gotAck = true;
+        }
+        pos += frameSize;
+    }
+    readBuffer.erase(readBuffer.begin(), readBuffer.begin() + pos);
+
+    if (gotAck) {
+        lastAckedSequence = std::max(lastAckedSequence, acked);
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t count = 0;
+        while (count < unsentIndex && pending[count].sequence <= acked) {
+            spareSamples.push_back(std::move(pending[count].samples));
+            count++;
+        }
+        pending.erase(pending.begin(), pending.begin() + count);
+        unsentIndex -= count;
+        stats.ticksAcked += count;
+    }
+    return true;
+}
+
+bool WireStreamClient::sendPending(bool flush) {
+    // 스풀에 남은 (더 오래된) 틱을 모두 재생하기 전에는 라이브 틱을 보내지 않는다
+    if (spool && !spool->empty()) {
+        return true;
+    }
+
+    while (true) {
+        sendBuffer.clear();
+        size_t count;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            size_t unsent = pending.size() - unsentIndex;
+            if (unsent == 0 || (!flush && unsent < config.ticksPerFrame)) {
+                return true;
+            }
+            count = std::min(unsent, config.ticksPerFrame);
+
+            // 인코딩만 락 안에서, 전송은 락 밖에서
+            bool keyframe = framesSinceKeyframe >= config.keyframeInterval;
+            WireEncoder encoder(sendBuffer);
+            encoder.batch(pending, unsentIndex, count, delta, keyframe);
+            framesSinceKeyframe = keyframe ? 1 : framesSinceKeyframe + 1;
+            unsentIndex += count;
+        }
+
+        if (!sendAll(fd, sendBuffer.data(), sendBuffer.size())) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.ticksSent += count;
+        stats.framesSent++;
+        stats.bytesSent += sendBuffer.size();
+    }
+}
+
+void WireStreamClient::spillPending(bool all) {
+    while (true) {
+        size_t count;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (pending.empty() || (!all && pending.size() <= config.maxPendingTicks)) {
+                return;
+            }
+
+            // 레코드마다 키프레임이라 따로 재생해도 디코딩할 수 있다
+            count = std::min(config.spillTicks, pending.size());
+            spillBuffer.clear();
+            if (spool) {
+                WireEncoder encoder(spillBuffer);
+                encoder.batch(pending, 0, count, spillState, true);
+            }
+
+            for (size_t i = 0; i < count; i++) {
+                spareSamples.push_back(std::move(pending[i].samples));
+            }
+            pending.erase(pending.begin(), pending.begin() + count);
+            unsentIndex -= std::min(unsentIndex, count);
+        }
+
+        bool written = spool && spool->append(spillBuffer.data(), spillBuffer.size());
+        std::lock_guard<std::mutex> lock(mutex);
+        if (written) {
+            stats.ticksSpooled += count;
+        } else {
+            stats.ticksDropped += count;
+        }
+    }
+}
+
+bool WireStreamClient::drainSpool() {
+    if (!spool) return true;
+
+    while (true) {
+        if (!spool->isReplaying()) {
+            if (!spool->beginReplay()) return true; // 재생할 세그먼트 없음
+            replayDone = false;
+            replayLastSequence = 0;
+        }
+
+        // 세그먼트를 다 보냈으면 마지막 틱의 ACK를 받은 뒤 삭제
+        if (replayDone) {
+            if (lastAckedSequence < replayLastSequence) return true;
+            spool->finishReplay();
+            continue;
+        }
+
+        if (!drainLimiter.available()) return true;
+
+        const uint8_t* record;
+        uint32_t recordSize;
+        if (!spool->nextRecord(record, recordSize)) {
+            replayDone = true;
+            continue;
+        }
+        drainLimiter.consume(recordSize);
+
+        // 레코드는 완성된 BATCH 프레임이므로 그대로 보낸다
+        WireFrameType type;
+        const uint8_t* payload;
+        uint32_t payloadSize;
+        size_t frameSize;
+        uint64_t firstSequence, count;
+        if (parseWireFrame(record, recordSize, type, payload, payloadSize, frameSize) != WireParseResult::Ok ||
+            type != WIRE_FRAME_BATCH || frameSize != recordSize ||
+            !peekWireBatchRange(payload, payloadSize, firstSequence, count) || count == 0) {
+            continue;
+        }
+        if (!sendAll(fd, record, recordSize)) {
+            return false;
+        }
+        replayLastSequence = std::max(replayLastSequence, firstSequence + count - 1);
+
+        // 키프레임 레코드가 디코더 상태를 바꿨으므로 다음 라이브 프레임도 키프레임으로
+        framesSinceKeyframe = config.keyframeInterval;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.ticksReplayed += count;
+        stats.framesSent++;
+        stats.bytesSent += recordSize;
+    }
+}
+
+WireSample makeWireSample(uint32_t slot, const GPUMetrics& metrics) {
+    WireSample sample;
+    sample.slot = slot;
+    sample.values[WIRE_FIELD_GPU_UTIL] = metrics.gpuUtilization;
+    sample.values[WIRE_FIELD_MEM_UTIL] = metrics.memoryUtilization;
+    sample.values[WIRE_FIELD_ENC_UTIL] = metrics.encoderUtilization;
+    sample.values[WIRE_FIELD_DEC_UTIL] = metrics.decoderUtilization;
+    sample.values[WIRE_FIELD_MEM_USED] = metrics.memoryUsed;
+    sample.values[WIRE_FIELD_MEM_TOTAL] = metrics.memoryTotal;
+    sample.values[WIRE_FIELD_TEMPERATURE] = metrics.temperature;
+    sample.values[WIRE_FIELD_FAN_SPEED] = metrics.fanSpeed;
+    sample.values[WIRE_FIELD_POWER_USAGE] = metrics.powerUsage;
+    sample.values[WIRE_FIELD_POWER_LIMIT] = metrics.powerLimit;
+    sample.values[WIRE_FIELD_SM_CLOCK] = metrics.smClock;
+    sample.values[WIRE_FIELD_MEM_CLOCK] = metrics.memoryClock;
+    sample.values[WIRE_FIELD_GRAPHICS_CLOCK] = metrics.graphicsClock;
+    sample.values[WIRE_FIELD_ECC_SINGLE] = metrics.eccSingleBit;
+    sample.values[WIRE_FIELD_ECC_DOUBLE] = metrics.eccDoubleBit;
+    return sample;
+}
+
+std::vector<WireDeviceDecl> makeWireDevices(const std::vector<GPUInfo>& gpus) {
+    std::vector<WireDeviceDecl> decls;
+    decls.reserve(gpus.size());
+    for (const auto& gpu : gpus) {
+        decls.push_back({gpu.index, gpu.uuid, gpu.name});
+    }
+    return decls;
+}
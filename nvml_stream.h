@@ -0,0 +1,117 @@
+#ifndef NVML_STREAM_H
+#define NVML_STREAM_H
+
+#include "nvml_types.h"
+#include "nvml_wire.h"
+#include "nvml_socket.h"
+#include "nvml_spool.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// 에이전트 -> 집계기 스트림 설정
+struct StreamClientConfig {
+    std::string address;                // "tcp://host:port" 또는 "unix:///path"
+    std::string nodeName;
+    size_t ticksPerFrame = 1;           // 한 BATCH 프레임에 담을 틱 수
+    unsigned int keyframeInterval = 60; // 키프레임 사이 프레임 수
+    size_t maxPendingTicks = 3600;      // ACK 대기 + 미전송 틱 상한 (초과 시 오래된 것부터 버림)
+    int reconnectIntervalMs = 1000;
+    int sendTimeoutMs = 5000;           // 송신이 이보다 오래 막히면 연결을 끊는다 (stop도 이만큼만 기다림)
+
+    // 디스크 스풀: maxPendingTicks를 넘는 틱과 종료 시 남은 틱을 디스크에 쓰고
+    // 재연결 후 라이브 틱보다 먼저 재생한다 (spool.directory가 비어 있으면 버린다)
+    SpoolConfig spool;
+    size_t spillTicks = 60;                        // 스풀 레코드 하나에 담을 틱 수
+    uint64_t drainBytesPerSecond = 1024 * 1024;    // 재생 속도 제한 (0이면 무제한)
+};
+
+// 스트림 통계
+struct StreamClientStats {
+    uint64_t ticksSubmitted;
+    uint64_t ticksSent;       // 재전송 포함
+    uint64_t ticksAcked;
+    uint64_t ticksDropped;
+    uint64_t framesSent;
+    uint64_t bytesSent;
+    uint64_t reconnects;
+    uint64_t ticksSpooled;
+    uint64_t ticksReplayed;
+};
+
+// 집계기로 틱을 배치/델타 인코딩해 보내는 클라이언트
+// ACK를 받기 전까지 틱을 보관하고, 재연결하면 ACK 받지 못한 틱부터 다시 보낸다
+class WireStreamClient {
+private:
+    StreamClientConfig config;
+    SocketAddress address;
+    std::vector<WireDeviceDecl> devices;
+
+    // ACK 대기 틱 (앞쪽이 오래된 것). [0, unsentIndex)는 현재 연결로 전송 완료
+    std::deque<WireTick> pending;
+    size_t unsentIndex;
+    uint64_t nextSequence;
+    std::vector<std::vector<WireSample>> spareSamples; // ACK된 틱의 샘플 버퍼 재사용
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::atomic<bool> running;
+    bool flushRequested;
+    std::thread senderThread;
+    StreamClientStats stats;
+
+    // 송신 스레드 전용 상태
+    int fd;
+    bool connectedOnce;
+    std::chrono::steady_clock::time_point nextConnectAttempt;
+    WireDeltaState delta;
+    unsigned int framesSinceKeyframe;
+    uint64_t lastAckedSequence;
+    std::vector<uint8_t> sendBuffer;
+    std::vector<uint8_t> readBuffer;
+
+    // 스풀 (송신 스레드만 접근)
+    std::unique_ptr<DiskSpool> spool;
+    RateLimiter drainLimiter;
+    WireDeltaState spillState;
+    std::vector<uint8_t> spillBuffer;
+    bool replayDone;
+    uint64_t replayLastSequence;
+
+public:
+    explicit WireStreamClient(const StreamClientConfig& config);
+    ~WireStreamClient();
+
+    // 연결마다 보낼 디바이스 선언 (start 전에 설정)
+    void setDevices(const std::vector<WireDeviceDecl>& decls);
+
+    bool start();
+    // 남은 틱을 보낸 뒤 종료
+    void stop();
+
+    // 틱 하나를 큐에 넣는다 (네트워크를 기다리지 않음)
+    void submit(uint64_t timestampMs, const std::vector<WireSample>& samples);
+
+    StreamClientStats getStats();
+    SpoolStats getSpoolStats();
+
+private:
+    void senderLoop();
+    bool connectAndHandshake();
+    void disconnect();
+    bool readAcks();
+    bool sendPending(bool flush);
+    void spillPending(bool all);
+    bool drainSpool();
+};
+
+// GPUMetrics -> wire 샘플 변환
+WireSample makeWireSample(uint32_t slot, const GPUMetrics& metrics);
+
+// GPU 목록 -> 디바이스 선언 (슬롯 = 디바이스 인덱스)
+std::vector<WireDeviceDecl> makeWireDevices(const std::vector<GPUInfo>& gpus);
+
+#endif // NVML_STREAM_H
@@ -0,0 +1,268 @@
+#include "nvml_thermal.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+const double kInitialCovariance = 100.0;
+const double kMaxCovarianceTrace = 1e6;     // 입력이 변하지 않는 동안 망각으로 공분산이 폭주하지 않도록
+const int64_t kMaxTickGapMs = 60 * 1000;    // 이보다 긴 간격의 온도 차는 미분으로 쓰지 않는다
+const unsigned long long kThermalThrottleMask = nvmlClocksThrottleReasonHwSlowdown |
+                                                nvmlClocksThrottleReasonSwThermalSlowdown |
+                                                nvmlClocksThrottleReasonHwThermalSlowdown;
+
+} // namespace
+
+ThermalForecaster::ThermalForecaster(const ThermalConfig& config) : config(config) {}
+
+void ThermalForecaster::setDevices(const std::vector<GPUInfo>& gpus) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& gpu : gpus) {
+        if (gpu.index >= slowdown.size()) slowdown.resize(gpu.index + 1, 0);
+        slowdown[gpu.index] = gpu.slowdownTemperature;
+    }
+}
+
+void ThermalForecaster::setWarningCallback(std::function<void(const ThermalForecast&)> callback) {
+    std::lock_guard<std::mutex> lock(mutex);
+    warningCallback = std::move(callback);
+}
+
+void ThermalForecaster::update(State& state, const GPUMetrics& metrics, int64_t timestampMs) {
+    double temperature = metrics.temperature;
+    int64_t elapsed = timestampMs - state.lastMs;
+    double power = metrics.powerUsage / 1000.0;
+    if (!state.seen || elapsed <= 0 || elapsed > kMaxTickGapMs) {
+        state.seen = true;
+        state.lastMs = timestampMs;
+        state.lastTemperature = temperature;
+        state.smoothedPower = power;
+        if (state.samples == 0) {
+            for (int i = 0; i < 3; i++) {
+                state.covariance[i][i] = kInitialCovariance;
+            }
+        }
+        return;
+    }
+    double dt = elapsed / 1000.0;
+
+    // 재귀 최소제곱: x = [1, P / 100W, T / 100], y = dT/dt (C/s)
+    double x[3] = {1.0, power / 100.0, (temperature + state.lastTemperature) / 2 / 100.0};
+    double y = (temperature - state.lastTemperature) / dt;
+    double lambda = std::exp2(-static_cast<double>(elapsed) / config.modelHalfLifeMs);
+
+    double px[3];
+    for (int i = 0; i < 3; i++) {
+        px[i] = state.covariance[i][0] * x[0] + state.covariance[i][1] * x[1] + state.covariance[i][2] * x[2];
+    }
+    double denominator = lambda + x[0] * px[0] + x[1] * px[1] + x[2] * px[2];
+    double error = y - (state.theta[0] * x[0] + state.theta[1] * x[1] + state.theta[2] * x[2]);
+    double trace = 0;
+    for (int i = 0; i < 3; i++) {
+        double gain = px[i] / denominator;
+        state.theta[i] += gain * error;
+        trace += state.covariance[i][i];
+    }
+    double forget = trace > kMaxCovarianceTrace ? 1.0 : lambda;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            state.covariance[i][j] = (state.covariance[i][j] - px[i] * px[j] / denominator) / forget;
+        }
+    }
+    state.samples++;
+
+    // 선형 추세: 원점을 새 샘플로 옮기고 (x' = x - dt) 감쇠
+    double decay = std::exp2(-static_cast<double>(elapsed) / config.trendHalfLifeMs);
+    state.w *= decay;
+    state.sx *= decay;
+    state.sy *= decay;
+    state.sxx *= decay;
+    state.sxy *= decay;
+    state.sxx += -2 * dt * state.sx + dt * dt * state.w;
+    state.sxy -= dt * state.sy;
+    state.sx -= dt * state.w;
+    state.w += 1;
+    state.sy += temperature;
+
+    double alpha = 1 - std::exp2(-static_cast<double>(elapsed) / config.powerHalfLifeMs);
+    state.smoothedPower += alpha * (power - state.smoothedPower);
+    state.lastMs = timestampMs;
+    state.lastTemperature = temperature;
+}
+
+void ThermalForecaster::forecast(State& state, const GPUMetrics& metrics) const {
+    ThermalForecast& result = state.last;
+    result.deviceIndex = metrics.deviceIndex;
+    result.temperature = metrics.temperature;
+    result.slowdownTemperature = metrics.deviceIndex < slowdown.size() ? slowdown[metrics.deviceIndex] : 0;
+    result.powerUsage = metrics.powerUsage;
+    result.smoothedPowerW = state.smoothedPower;
+    result.fanSpeed = metrics.fanSpeed;
+    result.smClock = metrics.smClock;
+    result.throttling = (metrics.clocksThrottleReasons & kThermalThrottleMask) != 0;
+
+    // dT/dt = c0 + c1 P + c2 T  =>  tau = -1 / c2, Tss = -(c0 + c1 P) / c2
+    double k = state.theta[2] / 100.0;
+    double power = state.smoothedPower / 100.0;
+    result.tauSeconds = k < 0 ? -1.0 / k : 0;
+    result.steadyStateC = k < 0 ? -(state.theta[0] + state.theta[1] * power) / k : 0;
+    result.modelValid = state.samples >= config.minSamples && k < 0 && result.tauSeconds >= config.minTauSeconds &&
+                        result.tauSeconds <= config.maxTauSeconds;
+
+    double varX = state.w * state.sxx - state.sx * state.sx;
+    double slope = varX > 1e-9 ? (state.w * state.sxy - state.sx * state.sy) / varX : 0;  // C/s
+    result.trendCPerMinute = slope * 60;
+
+    result.timeToSlowdownMs = -1;
+    double threshold = result.slowdownTemperature;
+    double temperature = metrics.temperature;
+    if (threshold <= 0) {
+        // 임계값을 모르면 예측하지 않는다
+    } else if (temperature >= threshold) {
+        result.timeToSlowdownMs = 0;
+    } else if (result.modelValid && result.steadyStateC > threshold) {
+        double seconds = result.tauSeconds * std::log((result.steadyStateC - temperature) /
+                                                      (result.steadyStateC - threshold));
+        result.timeToSlowdownMs = static_cast<int64_t>(seconds * 1000);
+    }
+
+    result.atRisk = result.throttling ||
+                    (result.timeToSlowdownMs >= 0 && result.timeToSlowdownMs <= config.warnHorizonMs);
+}
+
+void ThermalForecaster::add(const MetricsSnapshot& snapshot) {
+    int64_t ts = std::chrono::duration_cast<std::chrono::milliseconds>(snapshot.timestamp.time_since_epoch()).count();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    pending.clear();
+    for (const auto& m : snapshot.devices) {
+        if (m.deviceIndex >= states.size()) states.resize(m.deviceIndex + 1);
+        State& state = states[m.deviceIndex];
+        update(state, m, ts);
+        forecast(state, m);
+        if (state.last.atRisk) {
+            state.safeSinceMs = ts;
+            if (!state.warned) {
+                state.warned = true;
+                pending.push_back(state.last);
+            }
+        } else if (state.warned && ts - state.safeSinceMs >= config.rearmMs) {
+            state.warned = false;
+        }
+    }
+
+    if (pending.empty() || !warningCallback) return;
+    std::vector<ThermalForecast> fired;
+    fired.swap(pending);
+    auto callback = warningCallback;
+    lock.unlock();
+    for (const auto& forecast : fired) {
+        callback(forecast);
+    }
+    lock.lock();
+    pending.swap(fired);
+}
+
+std::vector<ThermalForecast> ThermalForecaster::forecasts() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<ThermalForecast> result;
+    for (const auto& state : states) {
+        if (state.seen) result.push_back(state.last);
+    }
+    return result;
+}
+
+void ThermalForecaster::saveCheckpoint(CheckpointWriter& writer) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    writer.put<uint32_t>(static_cast<uint32_t>(states.size()));
+    for (const auto& state : states) {
+        for (int i = 0; i < 3; i++) {
+            writer.put<double>(state.theta[i]);
+        }
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                writer.put<double>(state.covariance[i][j]);
+            }
+        }
+        writer.put<uint64_t>(state.samples);
+        writer.put<uint8_t>(state.warned ? 1 : 0);
+        writer.put<int64_t>(state.safeSinceMs);
+    }
+}
+
+bool ThermalForecaster::restoreCheckpoint(CheckpointReader& reader) {
+    uint32_t count = reader.get<uint32_t>();
+    if (!reader.good()) return false;
+
+    std::vector<State> restored(count);
+    for (auto& state : restored) {
+        for (int i = 0; i < 3; i++) {
+            state.theta[i] = reader.get<double>();
+        }
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                state.covariance[i][j] = reader.get<double>();
+            }
+        }
+        state.samples = reader.get<uint64_t>();
+        state.warned = reader.get<uint8_t>() != 0;
+        state.safeSinceMs = reader.get<int64_t>();
+        if (!reader.good()) return false;
+    }
+
+    // seen은 false로 두어 첫 틱이 온도/전력 기준점만 다시 잡게 한다 (공분산은 samples > 0이라 유지)
+    std::lock_guard<std::mutex> lock(mutex);
+    states = std::move(restored);
+    return true;
+}
+
+void registerThermalApi(HttpServer& server, const ThermalForecaster& forecaster, const std::string& path) {
+    server.route(path, [&forecaster](const HttpRequest&, HttpResponse& response) {
+        std::string& out = response.body;
+        out = "{\"gpus\":[";
+        bool first = true;
+        for (const auto& f : forecaster.forecasts()) {
+            if (!first) out.push_back(',');
+            first = false;
+            out += "{\"gpu\":";
+            appendNumber(f.deviceIndex, out);
+            out += ",\"temperature\":";
+            appendNumber(f.temperature, out);
+            out += ",\"slowdownTemperature\":";
+            appendNumber(f.slowdownTemperature, out);
+            out += ",\"power\":";
+            appendNumber(f.powerUsage / 1000.0, out, 4);
+            out += ",\"smoothedPower\":";
+            appendNumber(std::round(f.smoothedPowerW), out);
+            out += ",\"fan\":";
+            appendNumber(f.fanSpeed, out);
+            out += ",\"smClock\":";
+            appendNumber(f.smClock, out);
+            out += ",\"model\":";
+            out += f.modelValid ? "\"rc\"" : "\"trend\"";
+            if (f.modelValid) {
+                out += ",\"steadyState\":";
+                appendNumber(f.steadyStateC, out, 4);
+                out += ",\"tauSeconds\":";
+                appendNumber(f.tauSeconds, out, 4);
+            }
+            out += ",\"trendPerMinute\":";
+            appendNumber(f.trendCPerMinute, out, 4);
+            out += ",\"timeToSlowdownSeconds\":";
+            if (f.timeToSlowdownMs >= 0) {
+                appendNumber(static_cast<double>(f.timeToSlowdownMs / 1000), out);
+            } else {
+                out += "null";
+            }
+            out += ",\"throttling\":";
+            out += f.throttling ? "true" : "false";
+            out += ",\"atRisk\":";
+            out += f.atRisk ? "true" : "false";
+            out.push_back('}');
+        }
+        out += "]}\n";
+        response.contentType = "application/json";
+    });
+}
@@ -0,0 +1,103 @@
+#ifndef NVML_THERMAL_H
+#define NVML_THERMAL_H
+
+#include "nvml_history.h"
+#include <functional>
+
+struct ThermalConfig {
+    int64_t modelHalfLifeMs = 10 * 60 * 1000;   // RC 모델 망각 반감기
+    int64_t trendHalfLifeMs = 2 * 60 * 1000;    // 선형 추세 반감기 (참고값, 예측에는 쓰지 않는다)
+    int64_t warnHorizonMs = 10 * 60 * 1000;     // 감속 임계 도달 예상이 이 안이면 경고
+    int64_t rearmMs = 5 * 60 * 1000;            // 이만큼 계속 위험하지 않아야 경고를 다시 무장한다
+    int64_t powerHalfLifeMs = 30 * 1000;        // 예측에 쓰는 전력 평활 반감기 (부하 요동 흡수)
+    unsigned int minSamples = 120;              // 이보다 적은 틱으로 맞춘 모델은 쓰지 않는다 (초기 추정이 크게 흔들린다)
+    double minTauSeconds = 5;                   // 이 범위 밖 시상수는 잘못 맞은 것으로 본다
+    double maxTauSeconds = 3600;
+};
+
+struct ThermalForecast {
+    unsigned int deviceIndex;
+    unsigned int temperature;
+    unsigned int slowdownTemperature;   // 0이면 알 수 없음 (예측 안 함)
+    unsigned int powerUsage;            // mW
+    double smoothedPowerW;              // 예측에 쓴 평활 전력
+    unsigned int fanSpeed;
+    unsigned int smClock;
+    bool modelValid;                    // RC 모델이 맞았는지 (아니면 예측하지 않는다)
+    double steadyStateC;                // 현재 전력이 유지될 때의 평형 온도 (modelValid일 때)
+    double tauSeconds;
+    double trendCPerMinute;             // 최근 선형 추세 (지수 접근을 직선으로 늘리면 과대 예측하므로 참고만)
+    int64_t timeToSlowdownMs;           // -1이면 도달하지 않거나 예측 불가, 0이면 이미 도달
+    bool throttling;                    // NVML이 열/하드웨어 감속 중이라고 보고
+    bool atRisk;                        // 감속 중이거나 warnHorizon 안에 도달 예상
+};
+
+// GPU별 열 감속 예측
+// 1차 열 모델 dT/dt = (Tss(P) - T) / tau, Tss = a + b P 를 dT/dt = c0 + c1 P + c2 T 로 놓고
+// 지수 망각 재귀 최소제곱(3변수, 틱마다 상수 시간)으로 맞춘다.
+// 미분 dT/dt는 인접 두 샘플 차이라 온도 잡음이 회귀 변수와 상관되지 않도록 T는 두 샘플의 중점을 쓴다.
+// 평활 전력이 유지된다고 보고 T(t) = Tss + (T0 - Tss) e^(-t / tau)가 감속 임계에 닿는 시간을 구한다
+class ThermalForecaster {
+private:
+    struct State {
+        bool seen = false;
+        int64_t lastMs = 0;
+        double lastTemperature = 0;
+        double smoothedPower = 0;   // W
+        double theta[3] = {0, 0, 0};
+        double covariance[3][3] = {};
+        uint64_t samples = 0;
+        double w = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;   // 선형 추세 감쇠 합 (x: 초, 최근 샘플이 0)
+        bool warned = false;
+        int64_t safeSinceMs = 0;
+        ThermalForecast last{};
+    };
+
+    ThermalConfig config;
+    mutable std::mutex mutex;
+    std::vector<State> states;
+    std::vector<unsigned int> slowdown;   // 디바이스별 감속 임계 (GPUInfo에서)
+    std::function<void(const ThermalForecast&)> warningCallback;
+    std::vector<ThermalForecast> pending;
+
+public:
+    explicit ThermalForecaster(const ThermalConfig& config = ThermalConfig());
+
+    void setDevices(const std::vector<GPUInfo>& gpus);
+    // 위험으로 바뀔 때 한 번 (위험에서 벗어나면 다시 무장)
+    void setWarningCallback(std::function<void(const ThermalForecast&)> callback);
+
+    void add(const MetricsSnapshot& snapshot);
+    std::vector<ThermalForecast> forecasts() const;
+
+    // 체크포인트 (디바이스별 RLS 계수/공분산/샘플 수, 경고 상태). 모델은 GPU와 냉각 환경에 묶이므로
+    // 부팅 범위가 아니다. 복원 뒤 첫 틱은 직전 샘플 없이 다시 시작하지만 minSamples 예열은 건너뛴다
+    void saveCheckpoint(CheckpointWriter& writer) const;
+    bool restoreCheckpoint(CheckpointReader& reader);
+
+private:
+    void update(State& state, const GPUMetrics& metrics, int64_t timestampMs);
+    void forecast(State& state, const GPUMetrics& metrics) const;
+};
+
+// HTTP API (/api/thermal): GPU별 예측
+void registerThermalApi(HttpServer& server, const ThermalForecaster& forecaster, const std::string& path = "/api/thermal");
+
+// 파이프라인 싱크
+class ThermalSink : public MetricsSink {
+private:
+    ThermalForecaster& forecaster;
+
+public:
+    explicit ThermalSink(ThermalForecaster& forecaster) : forecaster(forecaster) {}
+
+    std::string name() const override { return "thermal"; }
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override {
+        for (const auto& snapshot : batch) {
+            forecaster.add(*snapshot);
+        }
+        return true;
+    }
+};
+
+#endif // NVML_THERMAL_H
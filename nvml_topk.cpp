@@ -0,0 +1,376 @@
+#include "nvml_topk.h"
+#include "nvml_util.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+const char* const kTopKMetricNames[TOPK_METRIC_COUNT] = {
+    "memory",
+    "gpu_seconds",
+    "energy",
+};
+
+const uint32_t kMaxDecodedCapacity = 1 << 16;
+
+TopKMode modeFor(int metric) {
+    return metric == TOPK_MEMORY ? TopKMode::Max : TopKMode::Sum;
+}
+
+} // namespace
+
+const char* topKMetricName(int metric) {
+    return metric >= 0 && metric < TOPK_METRIC_COUNT ? kTopKMetricNames[metric] : "";
+}
+
+int topKMetricFromName(const std::string& name) {
+    for (int metric = 0; metric < TOPK_METRIC_COUNT; metric++) {
+        if (name == kTopKMetricNames[metric]) return metric;
+    }
+    return -1;
+}
+
+TopKSummary::TopKSummary(TopKMode mode, size_t capacity) : mode(mode), capacity(std::max<size_t>(capacity, 1)) {}
+
+void TopKSummary::swapEntries(size_t a, size_t b) {
+    std::swap(heap[a], heap[b]);
+    index[heap[a].key] = a;
+    index[heap[b].key] = b;
+}
+
+void TopKSummary::siftUp(size_t pos) {
+    while (pos > 0) {
+        size_t parent = (pos - 1) / 2;
+        if (heap[parent].value <= heap[pos].value) break;
+        swapEntries(parent, pos);
+        pos = parent;
+    }
+}
+
+void TopKSummary::siftDown(size_t pos) {
+    while (true) {
+        size_t smallest = pos;
+        size_t left = pos * 2 + 1;
+        size_t right = left + 1;
+        if (left < heap.size() && heap[left].value < heap[smallest].value) smallest = left;
+        if (right < heap.size() && heap[right].value < heap[smallest].value) smallest = right;
+        if (smallest == pos) break;
+        swapEntries(pos, smallest);
+        pos = smallest;
+    }
+}
+
+void TopKSummary::insert(Entry entry) {
+    index[entry.key] = heap.size();
+    heap.push_back(std::move(entry));
+    siftUp(heap.size() - 1);
+}
+
+void TopKSummary::add(uint32_t pid, InternId name, double value) {
+    uint64_t key = makeKey(pid, name);
+    auto it = index.find(key);
+    if (it != index.end()) {
+        Entry& entry = heap[it->second];
+        entry.value = mode == TopKMode::Sum ? entry.value + value : std::max(entry.value, value);
+        siftDown(it->second); // 값은 커지기만 한다
+        return;
+    }
+
+    if (heap.size() < capacity) {
+        insert({key, pid, name, value, 0});
+        return;
+    }
+
+    // 가장 작은 카운터를 새 키에 넘긴다
+    Entry& root = heap[0];
+    double floor = root.value;
+    if (mode == TopKMode::Max && value <= floor) return;
+    index.erase(root.key);
+    root.key = key;
+    root.pid = pid;
+    root.name = name;
+    root.value = mode == TopKMode::Sum ? floor + value : value;
+    root.error = mode == TopKMode::Sum ? floor : 0;
+    index[root.key] = 0;
+    siftDown(0);
+}
+
+bool TopKSummary::merge(const TopKSummary& other) {
+    if (other.mode != mode) return false;
+    if (other.heap.empty()) return true;
+
+    // Sum: 꽉 찬 요약에 없는 키는 그 요약의 최솟값까지 셌을 수 있다
+    double floorThis = mode == TopKMode::Sum && heap.size() >= capacity ? heap[0].value : 0;
+    double floorOther = mode == TopKMode::Sum && other.heap.size() >= other.capacity ? other.heap[0].value : 0;
+
+    std::vector<Entry> combined;
+    combined.reserve(heap.size() + other.heap.size());
+    for (const auto& entry : heap) {
+        Entry merged = entry;
+        auto it = other.index.find(entry.key);
+        if (it != other.index.end()) {
+            const Entry& match = other.heap[it->second];
+            merged.value = mode == TopKMode::Sum ? entry.value + match.value : std::max(entry.value, match.value);
+            merged.error = entry.error + match.error;
+        } else {
+            merged.value += floorOther;
+            merged.error += floorOther;
+        }
+        combined.push_back(std::move(merged));
+    }
+    for (const auto& entry : other.heap) {
+        if (index.count(entry.key)) continue;
+        Entry merged = entry;
+        merged.value += floorThis;
+        merged.error += floorThis;
+        combined.push_back(std::move(merged));
+    }
+
+    // 큰 것 capacity개만 남기고 오름차순 배열(최소 힙)로 다시 만든다
+    if (combined.size() > capacity) {
+        std::nth_element(combined.begin(), combined.begin() + capacity, combined.end(),
+                         [](const Entry& a, const Entry& b) { return a.value > b.value; });
+        combined.resize(capacity);
+    }
+    std::sort(combined.begin(), combined.end(), [](const Entry& a, const Entry& b) { return a.value < b.value; });
+    heap = std::move(combined);
+    index.clear();
+    for (size_t i = 0; i < heap.size(); i++) {
+        index[heap[i].key] = i;
+    }
+    return true;
+}
+
+void TopKSummary::clear() {
+    heap.clear();
+    index.clear();
+}
+
+std::vector<TopKItem> TopKSummary::top(size_t k) const {
+    std::vector<TopKItem> items;
+    items.reserve(heap.size());
+    for (const auto& entry : heap) {
+        items.push_back({entry.pid, internedString(entry.name), entry.value, entry.error});
+    }
+    auto byValue = [](const TopKItem& a, const TopKItem& b) { return a.value > b.value; };
+    k = std::min(k, items.size());
+    std::partial_sort(items.begin(), items.begin() + k, items.end(), byValue);
+    items.resize(k);
+    return items;
+}
+
+void TopKSummary::encode(std::string& out) const {
+    putLE<uint8_t>(mode == TopKMode::Sum ? 0 : 1, out);
+    putLE<uint32_t>(static_cast<uint32_t>(capacity), out);
+    putLE<uint32_t>(static_cast<uint32_t>(heap.size()), out);
+    for (const auto& entry : heap) {
+        putLE<uint32_t>(entry.pid, out);
+        const std::string& name = internedString(entry.name);   // id는 실행마다 다르므로 문자열로
+        putLE<uint32_t>(static_cast<uint32_t>(name.size()), out);
+        out += name;
+        putLE<double>(entry.value, out);
+        putLE<double>(entry.error, out);
+    }
+}
+
+bool TopKSummary::decode(CheckpointReader& reader) {
+    uint8_t decodedMode = reader.get<uint8_t>();
+    uint32_t decodedCapacity = reader.get<uint32_t>();
+    uint32_t count = reader.get<uint32_t>();
+    if (!reader.good() || decodedMode > 1 || decodedCapacity == 0 || decodedCapacity > kMaxDecodedCapacity ||
+        count > decodedCapacity) {
+        return false;
+    }
+
+    TopKSummary decoded(decodedMode == 0 ? TopKMode::Sum : TopKMode::Max, decodedCapacity);
+    for (uint32_t i = 0; i < count; i++) {
+        Entry entry;
+        entry.pid = reader.get<uint32_t>();
+        entry.name = internString(reader.getString());
+        entry.value = reader.get<double>();
+        entry.error = reader.get<double>();
+        if (!reader.good()) return false;
+        entry.key = makeKey(entry.pid, entry.name);
+        if (decoded.index.count(entry.key)) return false;
+        decoded.insert(std::move(entry));
+    }
+    *this = std::move(decoded);
+    return true;
+}
+
+HeavyHitterTracker::HeavyHitterTracker(const TopKConfig& config) : config(config), lastTimestamp(-1), ticks(0) {
+    this->config.capacity = std::max<size_t>(this->config.capacity, 1);
+    this->config.slotMs = std::max<int64_t>(this->config.slotMs, 1000);
+    this->config.slots = std::max<uint32_t>(this->config.slots, 1);
+    ring.resize(this->config.slots);
+}
+
+HeavyHitterTracker::Slot& HeavyHitterTracker::slotFor(int64_t timestampMs) {
+    int64_t id = floorDiv(timestampMs, config.slotMs);
+    Slot& slot = ring[static_cast<size_t>(id % config.slots)];
+    if (slot.id != id) {
+        slot.id = id;
+        slot.summaries.clear();
+        for (int metric = 0; metric < TOPK_METRIC_COUNT; metric++) {
+            slot.summaries.emplace_back(modeFor(metric), config.capacity);
+        }
+    }
+    return slot;
+}
+
+void HeavyHitterTracker::add(const MetricsSnapshot& snapshot) {
+    int64_t ts = std::chrono::duration_cast<std::chrono::milliseconds>(snapshot.timestamp.time_since_epoch()).count();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // 시계가 되돌아간 틱은 세지 않는다 (현재 슬롯보다 오래된 슬롯을 덮어쓰지 않도록)
+    if (ts < lastTimestamp) return;
+    int64_t elapsed = lastTimestamp < 0 ? 0 : std::min(ts - lastTimestamp, config.maxTickGapMs);
+    lastTimestamp = ts;
+    ticks++;
+
+    // GPU 시간/에너지는 같은 GPU 프로세스끼리 균등 분배 (NVML 프로세스 목록에 프로세스별 사용률이 없다)
+    processCounts.assign(processCounts.size(), 0);
+    deviceMetrics.assign(deviceMetrics.size(), nullptr);
+    for (const auto& m : snapshot.devices) {
+        if (m.deviceIndex >= deviceMetrics.size()) deviceMetrics.resize(m.deviceIndex + 1, nullptr);
+        deviceMetrics[m.deviceIndex] = &m;
+    }
+    for (const auto& p : snapshot.processes) {
+        if (p.deviceIndex >= processCounts.size()) processCounts.resize(p.deviceIndex + 1, 0);
+        processCounts[p.deviceIndex]++;
+    }
+
+    Slot& slot = slotFor(ts);
+    double seconds = elapsed / 1000.0;
+    for (const auto& p : snapshot.processes) {
+        slot.summaries[TOPK_MEMORY].add(p.pid, p.nameId, static_cast<double>(p.usedGpuMemory));
+
+        const GPUMetrics* m = p.deviceIndex < deviceMetrics.size() ? deviceMetrics[p.deviceIndex] : nullptr;
+        if (!m || seconds <= 0) continue;
+        double share = seconds / processCounts[p.deviceIndex];
+        double gpuSeconds = m->gpuUtilization / 100.0 * share;
+        double joules = m->powerUsage / 1000.0 * share;
+        if (gpuSeconds > 0) slot.summaries[TOPK_GPU_SECONDS].add(p.pid, p.nameId, gpuSeconds);
+        if (joules > 0) slot.summaries[TOPK_ENERGY].add(p.pid, p.nameId, joules);
+    }
+}
+
+bool HeavyHitterTracker::query(int metric, int64_t windowMs, int64_t now, TopKSummary& result) const {
+    result = TopKSummary(modeFor(metric), config.capacity);
+    if (metric < 0 || metric >= TOPK_METRIC_COUNT || windowMs <= 0) return false;
+
+    int64_t first = floorDiv(now - windowMs, config.slotMs);
+    int64_t last = floorDiv(now, config.slotMs);
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& slot : ring) {
+        if (slot.id >= first && slot.id <= last) {
+            result.merge(slot.summaries[metric]);
+        }
+    }
+    return true;
+}
+
+void HeavyHitterTracker::saveCheckpoint(CheckpointWriter& writer) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    writer.put<uint32_t>(static_cast<uint32_t>(config.capacity));
+    writer.put<int64_t>(config.slotMs);
+    writer.put<uint32_t>(config.slots);
+    writer.put<int64_t>(lastTimestamp);
+
+    std::string encoded;
+    for (const auto& slot : ring) {
+        writer.put<int64_t>(slot.id);
+        if (slot.id < 0) continue;
+        for (const auto& summary : slot.summaries) {
+            encoded.clear();
+            summary.encode(encoded);
+            writer.putString(encoded);
+        }
+    }
+}
+
+bool HeavyHitterTracker::restoreCheckpoint(CheckpointReader& reader) {
+    uint32_t capacity = reader.get<uint32_t>();
+    int64_t slotMs = reader.get<int64_t>();
+    uint32_t slots = reader.get<uint32_t>();
+    int64_t restoredTimestamp = reader.get<int64_t>();
+    if (!reader.good() || capacity != config.capacity || slotMs != config.slotMs || slots != config.slots) {
+        return false;
+    }
+
+    std::vector<Slot> restored(slots);
+    for (auto& slot : restored) {
+        slot.id = reader.get<int64_t>();
+        if (!reader.good()) return false;
+        if (slot.id < 0) continue;
+        for (int metric = 0; metric < TOPK_METRIC_COUNT; metric++) {
+            std::string encoded = reader.getString();
+            CheckpointReader summaryReader(reinterpret_cast<const uint8_t*>(encoded.data()), encoded.size());
+            TopKSummary summary;
+            if (!reader.good() || !summary.decode(summaryReader) || summary.getMode() != modeFor(metric)) {
+                return false;
+            }
+            slot.summaries.push_back(std::move(summary));
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ring = std::move(restored);
+    lastTimestamp = restoredTimestamp;
+    return true;
+}
+
+void registerTopKApi(HttpServer& server, const HeavyHitterTracker& tracker, const std::string& path) {
+    server.route(path, [&tracker](const HttpRequest& request, HttpResponse& response) {
+        response.contentType = "application/json";
+
+        int metric = topKMetricFromName(request.queryParam("metric", "memory"));
+        if (metric < 0) {
+            response.status = 400;
+            response.body = errorJson("unknown metric");
+            return;
+        }
+        int64_t window;
+        if (!parseHistoryDuration(request.queryParam("window", "10m"), window) || window <= 0) {
+            response.status = 400;
+            response.body = errorJson("invalid window");
+            return;
+        }
+        size_t k = std::strtoul(request.queryParam("k", "10").c_str(), nullptr, 10);
+        if (k == 0) k = 10;
+
+        TopKSummary summary;
+        tracker.query(metric, window, nowMillis(), summary);
+
+        if (request.queryParam("format") == "summary") {
+            response.contentType = "application/octet-stream";
+            summary.encode(response.body);
+            return;
+        }
+
+        std::string& out = response.body;
+        out = "{\"metric\":";
+        appendJsonString(topKMetricName(metric), out);
+        out += ",\"window\":";
+        appendNumber(static_cast<double>(window), out);
+        out += ",\"capacity\":";
+        appendNumber(static_cast<double>(tracker.getCapacity()), out);
+        out += ",\"top\":[";
+        bool first = true;
+        for (const auto& item : summary.top(k)) {
+            if (!first) out.push_back(',');
+            first = false;
+            out += "{\"pid\":";
+            appendNumber(item.pid, out);
+            out += ",\"name\":";
+            appendJsonString(item.name, out);
+            out += ",\"value\":";
+            appendNumber(item.value, out);
+            out += ",\"error\":";
+            appendNumber(item.error, out);
+            out.push_back('}');
+        }
+        out += "]}\n";
+    });
+}
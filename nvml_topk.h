@@ -0,0 +1,133 @@
+#ifndef NVML_TOPK_H
+#define NVML_TOPK_H
+
+#include "nvml_history.h"
+
+// 요약 방식
+enum class TopKMode {
+    Sum,  // space-saving: 누적 합 (GPU 시간, 에너지). 값은 상한, value - error는 하한
+    Max   // 최댓값 (메모리 최고 사용량). 최솟값보다 작은 관측은 top-K에 들 수 없으므로 정확하다
+};
+
+struct TopKItem {
+    uint32_t pid;
+    std::string name;
+    double value;
+    double error;   // Sum: 과대 추정 상한
+};
+
+// 고정 크기 heavy-hitter 요약 (capacity개 카운터, 최솟값 힙 + 키 색인)
+// 프로세스가 아무리 많이 생겼다 사라져도 메모리는 capacity에 묶인다
+class TopKSummary {
+private:
+    struct Entry {
+        uint64_t key;     // 인터닝된 이름 id << 32 | pid
+        uint32_t pid;
+        InternId name;
+        double value;
+        double error;
+    };
+
+    TopKMode mode;
+    size_t capacity;
+    std::vector<Entry> heap;                        // value 최소 힙
+    std::unordered_map<uint64_t, size_t> index;     // key -> 힙 위치
+
+public:
+    explicit TopKSummary(TopKMode mode = TopKMode::Sum, size_t capacity = 64);
+
+    void add(uint32_t pid, InternId name, double value);
+    // 같은 모드끼리 합친다 (노드/슬롯 병합). Sum은 한쪽에 없는 키에 그쪽 최솟값을 오차로 더한다
+    bool merge(const TopKSummary& other);
+    void clear();
+
+    std::vector<TopKItem> top(size_t k) const;  // 값 내림차순
+    size_t size() const { return heap.size(); }
+    TopKMode getMode() const { return mode; }
+
+    void encode(std::string& out) const;
+    bool decode(CheckpointReader& reader);
+
+private:
+    static uint64_t makeKey(uint32_t pid, InternId name) { return (static_cast<uint64_t>(name) << 32) | pid; }
+    void insert(Entry entry);
+    void siftUp(size_t pos);
+    void siftDown(size_t pos);
+    void swapEntries(size_t a, size_t b);
+};
+
+enum TopKMetric {
+    TOPK_MEMORY,       // 최고 GPU 메모리 사용량 (bytes)
+    TOPK_GPU_SECONDS,  // 디바이스 사용률 x 시간, 같은 GPU의 프로세스끼리 균등 분배
+    TOPK_ENERGY,       // 디바이스 전력 x 시간 (J), 같은 GPU의 프로세스끼리 균등 분배
+    TOPK_METRIC_COUNT
+};
+
+const char* topKMetricName(int metric);
+int topKMetricFromName(const std::string& name); // 없으면 -1
+
+struct TopKConfig {
+    size_t capacity = 64;               // 지표/슬롯당 카운터 수
+    int64_t slotMs = 10 * 60 * 1000;    // 슬롯 길이
+    uint32_t slots = 144;               // 슬롯 수 (기본 1일)
+    int64_t maxTickGapMs = 10 * 1000;   // 틱 간격이 이보다 길면 (수집 중단) 이만큼만 센다
+};
+
+// 노드 단위 프로세스 heavy-hitter 추적기
+// 틱마다 프로세스별 메모리, GPU 시간, 에너지를 현재 슬롯 요약에 더하고, 질의는 창에 걸친 슬롯들을 합친다
+class HeavyHitterTracker {
+private:
+    struct Slot {
+        int64_t id = -1;
+        std::vector<TopKSummary> summaries; // 지표별
+    };
+
+    TopKConfig config;
+    mutable std::mutex mutex;
+    std::vector<Slot> ring;
+    int64_t lastTimestamp;
+    uint64_t ticks;
+
+    // 틱마다 재사용
+    std::vector<unsigned int> processCounts;
+    std::vector<const GPUMetrics*> deviceMetrics;
+
+public:
+    explicit HeavyHitterTracker(const TopKConfig& config = TopKConfig());
+
+    void add(const MetricsSnapshot& snapshot);
+
+    // now 기준 최근 windowMs (슬롯 단위로 올림) 요약
+    bool query(int metric, int64_t windowMs, int64_t now, TopKSummary& result) const;
+    size_t getCapacity() const { return config.capacity; }
+
+    void saveCheckpoint(CheckpointWriter& writer) const;
+    bool restoreCheckpoint(CheckpointReader& reader);
+
+private:
+    Slot& slotFor(int64_t timestampMs);
+};
+
+// HTTP API (/api/top)
+//   metric=memory|gpu_seconds|energy&window=1d&k=10
+// format=summary이면 창의 요약을 인코딩한 바이너리 (집계기에서 노드 요약끼리 합친다)
+void registerTopKApi(HttpServer& server, const HeavyHitterTracker& tracker, const std::string& path = "/api/top");
+
+// 파이프라인 싱크
+class TopKSink : public MetricsSink {
+private:
+    HeavyHitterTracker& tracker;
+
+public:
+    explicit TopKSink(HeavyHitterTracker& tracker) : tracker(tracker) {}
+
+    std::string name() const override { return "topk"; }
+    bool exportBatch(const std::vector<SnapshotPtr>& batch) override {
+        for (const auto& snapshot : batch) {
+            tracker.add(*snapshot);
+        }
+        return true;
+    }
+};
+
+#endif // NVML_TOPK_H
@@ -6,6 +6,7 @@
 #include <string>
 #include <chrono>
 #include <memory>
+#include "nvml_intern.h"
 
 // GPU 기본 정보 구조체
 struct GPUInfo {
@@ -19,15 +20,23 @@ struct GPUInfo {
     int cudaMajor;
     int cudaMinor;
     unsigned long long totalMemory;
+    unsigned int slowdownTemperature;   // 열 감속 임계 온도 (0이면 알 수 없음)
+    unsigned int shutdownTemperature;   // 종료 임계 온도 (0이면 알 수 없음)
+    InternId nameId = kEmptyIntern;     // name/uuid의 인터닝 id (틱마다 쓰는 경로는 이 id로 비교/조회)
+    InternId uuidId = kEmptyIntern;
 };
 
 // GPU 성능 메트릭 구조체
 struct GPUMetrics {
+    unsigned int deviceIndex;
+    
     // 사용률
     unsigned int gpuUtilization;
     unsigned int memoryUtilization;
     unsigned int encoderUtilization;
     unsigned int decoderUtilization;
+    unsigned int encoderSamplingPeriod; // us
+    unsigned int decoderSamplingPeriod; // us
     
     // 메모리 정보
     unsigned long long memoryUsed;
@@ -45,6 +54,7 @@ struct GPUMetrics {
     unsigned int graphicsClock;
     unsigned int memoryClock;
     unsigned int smClock;
+    unsigned long long clocksThrottleReasons; // nvmlClocksThrottleReason* 비트
     
     // 에러 카운트
     unsigned long long eccSingleBit;
@@ -56,12 +66,143 @@ struct GPUMetrics {
 
 // 프로세스 정보 구조체
 struct ProcessInfo {
+    unsigned int deviceIndex;
     unsigned int pid;
-    std::string name;
+    InternId nameId = kEmptyIntern; // 인터닝된 프로세스 이름 (internedString으로 읽는다)
     unsigned long long usedGpuMemory;
     nvmlProcessType_t type;  // Graphics or Compute
 };
 
+// 사용률 샘플 (nvmlDeviceGetSamples, timeStamp는 us)
+struct UtilizationSample {
+    unsigned long long timeStamp;
+    unsigned int value;
+};
+
+// NVENC 인코더 세션
+struct EncoderSessionInfo {
+    unsigned int sessionId;
+    unsigned int pid;
+    unsigned int vgpuInstance;
+    nvmlEncoderType_t codecType;
+    unsigned int hResolution;
+    unsigned int vResolution;
+    unsigned int averageFps;
+    unsigned int averageLatency; // us
+};
+
+// Frame Buffer Capture 세션
+struct FBCSessionInfo {
+    unsigned int sessionId;
+    unsigned int pid;
+    unsigned int vgpuInstance;
+    unsigned int displayOrdinal;
+    nvmlFBCSessionType_t sessionType;
+    unsigned int hResolution;
+    unsigned int vResolution;
+    unsigned int averageFps;
+    unsigned int averageLatency; // us
+};
+
+// 인코더 용량 조회 코덱
+enum MediaCodec {
+    MEDIA_CODEC_H264 = 0,
+    MEDIA_CODEC_HEVC = 1,
+    MEDIA_CODEC_COUNT = 2
+};
+
+// 인코더/디코더/FBC 통계
+struct MediaStats {
+    unsigned int deviceIndex;
+    
+    // 인코더
+    unsigned int encoderUtilization;
+    unsigned int encoderSamplingPeriod;
+    unsigned int encoderSessionCount;
+    unsigned int encoderAverageFps;
+    unsigned int encoderAverageLatency;
+    unsigned int encoderCapacity[MEDIA_CODEC_COUNT]; // 남은 용량 (%)
+    std::vector<EncoderSessionInfo> encoderSessions;
+    
+    // 디코더
+    unsigned int decoderUtilization;
+    unsigned int decoderSamplingPeriod;
+    
+    // 마지막 수집 이후의 새 샘플
+    std::vector<UtilizationSample> encoderSamples;
+    std::vector<UtilizationSample> decoderSamples;
+    
+    // FBC
+    unsigned int fbcSessionCount;
+    unsigned int fbcAverageFps;
+    unsigned int fbcAverageLatency;
+    std::vector<FBCSessionInfo> fbcSessions;
+    
+    std::chrono::system_clock::time_point timestamp;
+};
+
+// 호스트 PSI (/proc/pressure/*) 한 자원
+enum HostPressureResource {
+    HOST_PRESSURE_CPU = 0,
+    HOST_PRESSURE_MEMORY = 1,
+    HOST_PRESSURE_IO = 2,
+    HOST_PRESSURE_COUNT = 3
+};
+
+struct HostPressure {
+    double someAvg10;       // 커널의 10초 평균 (%)
+    double fullAvg10;
+    double somePercent;     // 지난 틱 동안 정체된 시간 비율 (total 차이, %)
+    double fullPercent;
+};
+
+// GPU를 쓰는 프로세스의 CPU 시간
+struct HostProcessCpu {
+    unsigned int pid;
+    unsigned long long cpuTimeMs;   // 누적 utime + stime
+    double cpuPercent;              // 지난 틱 동안 (코어 하나 = 100)
+};
+
+// GPU 스냅샷과 같은 틱에 읽은 호스트 지표 (선택, valid가 false면 수집하지 않음)
+struct HostMetrics {
+    bool valid = false;
+    bool pressureValid = false;     // PSI를 지원하지 않는 커널이면 false
+    unsigned int intervalMs = 0;    // 비율 계산 구간 (첫 틱은 0, 비율은 의미 없음)
+    unsigned int cpuCount = 0;
+
+    // /proc/stat (전체 CPU 대비 %)
+    double cpuBusyPercent = 0;
+    double cpuIowaitPercent = 0;
+    double cpuStealPercent = 0;
+
+    // /proc/meminfo (bytes)
+    unsigned long long memoryTotal = 0;
+    unsigned long long memoryAvailable = 0;
+    unsigned long long swapTotal = 0;
+    unsigned long long swapFree = 0;
+
+    HostPressure pressure[HOST_PRESSURE_COUNT] = {};
+    std::vector<HostProcessCpu> processes;  // 스냅샷 프로세스의 pid마다 하나
+};
+
+// 한 모니터링 틱의 전체 디바이스 스냅샷 (내보내기/스트리밍용)
+// MIG 슬라이스 메모리 (MIG 모드 GPU의 슬라이스마다 틱당 하나)
+struct MigSliceMemory {
+    unsigned int deviceIndex;            // 부모 GPU
+    unsigned int sliceIndex;             // nvmlDeviceGetMigDeviceHandleByIndex 인덱스
+    InternId uuidId = kEmptyIntern;      // MIG uuid (인터닝)
+    unsigned long long usedBytes;
+    unsigned long long totalBytes;
+};
+
+struct MetricsSnapshot {
+    std::chrono::system_clock::time_point timestamp;
+    std::vector<GPUMetrics> devices;     // gpuDevices 순서
+    std::vector<ProcessInfo> processes;  // 모든 디바이스의 프로세스
+    std::vector<MigSliceMemory> migSlices;
+    HostMetrics host;                    // NVMLManager::setHostMonitoring으로 켠 경우
+};
+
 // 이벤트 정보 구조체
 struct EventInfo {
     nvmlDevice_t device;
@@ -70,17 +211,32 @@ struct EventInfo {
     std::string description;
 };
 
+// Unit 온도 센서 (nvmlUnitGetTemperature type 인자)
+enum UnitTemperatureSensor {
+    UNIT_TEMPERATURE_INTAKE = 0,
+    UNIT_TEMPERATURE_EXHAUST = 1,
+    UNIT_TEMPERATURE_BOARD = 2,
+    UNIT_TEMPERATURE_COUNT = 3
+};
+
 // Unit 정보 구조체 (S-class systems)
 struct UnitInfo {
     nvmlUnit_t unit;
+    unsigned int index;
     std::string id;
     std::string name;
     std::string serial;
     std::string firmwareVersion;
     std::vector<nvmlDevice_t> devices;
-    unsigned int fanSpeed;
-    unsigned int temperature;
+    unsigned int fanSpeed;     // 첫 번째 팬
+    unsigned int temperature;  // intake 센서
+    
+    // 주기적으로 갱신되는 텔레메트리
+    std::vector<nvmlUnitFanInfo_t> fans;
+    unsigned int temperatures[UNIT_TEMPERATURE_COUNT];
     nvmlPSUInfo_t psuInfo;
+    nvmlLedState_t ledState;
+    std::chrono::system_clock::time_point timestamp;
 };
 
 // BAR1 메모리 정보
@@ -93,10 +249,77 @@ struct BAR1MemoryInfo {
 // vGPU 정보 구조체
 struct VGPUInfo {
     unsigned int vgpuInstance;
-    std::string vgpuType;
+    InternId typeNameId = kEmptyIntern;  // vGPU 타입 이름, uuid, VM ID의 인터닝 id (internedString으로 읽는다)
+    nvmlVgpuTypeId_t typeId;
+    InternId uuidId = kEmptyIntern;
+    InternId vmId = kEmptyIntern;
     unsigned long long framebufferSize;
+    unsigned long long framebufferUsed;
     unsigned int maxInstances;
     unsigned int createdInstances;
+    
+    // 인코더 통계
+    unsigned int encoderCapacity;
+    unsigned int encoderSessionCount;
+    unsigned int encoderAverageFps;
+    unsigned int encoderAverageLatency;
+};
+
+// vGPU 사용률 샘플 (timeStamp는 NVML 기준 us)
+struct VGPUUtilizationSample {
+    unsigned int vgpuInstance;
+    unsigned long long timeStamp;
+    unsigned int smUtil;
+    unsigned int memUtil;
+    unsigned int encUtil;
+    unsigned int decUtil;
 };
 
+// vGPU 내부 프로세스 사용률 샘플
+struct VGPUProcessSample {
+    unsigned int vgpuInstance;
+    unsigned int pid;
+    InternId nameId = kEmptyIntern;      // 인터닝된 프로세스 이름
+    unsigned long long timeStamp;
+    unsigned int smUtil;
+    unsigned int memUtil;
+    unsigned int encUtil;
+    unsigned int decUtil;
+};
+
+// 한 번의 수집 주기에서 발생한 vGPU 변경 사항과 새 샘플
+struct VGPUUpdate {
+    unsigned int deviceIndex;
+    std::vector<unsigned int> created;
+    std::vector<unsigned int> destroyed;
+    std::vector<VGPUInfo> instances;     // 새로 생겼거나 동적 정보(FB 사용량, 인코더 통계)가 바뀐 인스턴스만
+    std::vector<VGPUUtilizationSample> utilization;
+    std::vector<VGPUProcessSample> processes;
+    
+    bool empty() const {
+        return created.empty() && destroyed.empty() && instances.empty() &&
+               utilization.empty() && processes.empty();
+    }
+    
+    void clear() {
+        created.clear();
+        destroyed.clear();
+        instances.clear();
+        utilization.clear();
+        processes.clear();
+    }
+};
+
+// NVML 샘플 값(nvmlDeviceGetSamples, vGPU 사용률 샘플)을 unsigned int로 변환
+inline unsigned int sampleValueToUInt(nvmlValueType_t type, const nvmlValue_t& value) {
+    switch (type) {
+        case NVML_VALUE_TYPE_DOUBLE: return static_cast<unsigned int>(value.dVal);
+        case NVML_VALUE_TYPE_UNSIGNED_INT: return value.uiVal;
+        case NVML_VALUE_TYPE_UNSIGNED_LONG: return static_cast<unsigned int>(value.ulVal);
+        case NVML_VALUE_TYPE_UNSIGNED_LONG_LONG: return static_cast<unsigned int>(value.ullVal);
+        case NVML_VALUE_TYPE_SIGNED_LONG_LONG: return static_cast<unsigned int>(value.sllVal);
+        default: return 0;
+    }
+}
+
 #endif // NVML_TYPES_H
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "nvml_util.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+struct CrcTable {
+    uint32_t values[256];
+
+    CrcTable() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            values[i] = c;
+        }
+    }
+};
+
+} // namespace
+
+int64_t nowMillis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+int64_t floorDiv(int64_t value, int64_t divisor) {
+    int64_t q = value / divisor;
+    return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? q - 1 : q;
+}
+
+void appendNumber(double value, std::string& out, int precision) {
+    char text[32];
+    if (std::isnan(value)) {
+        out += "null";
+        return;
+    }
+    if (value == std::floor(value) && std::fabs(value) < 1e15) {
+        std::snprintf(text, sizeof(text), "%lld", static_cast<long long>(value));
+    } else {
+        std::snprintf(text, sizeof(text), "%.*g", precision, value);
+    }
+    out += text;
+}
+
+void appendJsonString(const std::string& value, std::string& out) {
+    out.push_back('"');
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            out.push_back('\\');
+            out.push_back(c);
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        } else {
+            out.push_back(c);
+        }
+    }
+    out.push_back('"');
+}
+
+std::string errorJson(const std::string& error) {
+    std::string out = "{\"error\":";
+    appendJsonString(error, out);
+    out += "}\n";
+    return out;
+}
+
+std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> items;
+    size_t pos = 0;
+    while (pos <= text.size()) {
+        size_t end = text.find(',', pos);
+        if (end == std::string::npos) end = text.size();
+        if (end > pos) items.push_back(text.substr(pos, end - pos));
+        pos = end + 1;
+    }
+    return items;
+}
+
+void appendTagValue(const std::string& value, TagSyntax syntax, std::string& out) {
+    for (char c : value) {
+        if (syntax == TagSyntax::Statsd) {
+            out.push_back(c == ',' || c == '|' || c == '#' || c == '\n' ? '_' : c);
+        } else if (c == ',' || c == ' ' || c == '=') {
+            out.push_back('\\');
+            out.push_back(c);
+        } else if (c == '\n') {
+            out.push_back(' ');
+        } else {
+            out.push_back(c);
+        }
+    }
+}
+
+uint32_t updateCrc32(uint32_t crc, const void* data, size_t size) {
+    static const CrcTable table;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    crc ^= 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++) {
+        crc = table.values[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
@@ -0,0 +1,42 @@
+#ifndef NVML_UTIL_H
+#define NVML_UTIL_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// 여러 모듈이 같이 쓰는 작은 도우미 (시각, JSON 출력, 리틀 엔디언 직렬화, CRC, 목록 파싱, 태그 이스케이프)
+// NVML이나 다른 모듈에 의존하지 않는다
+
+int64_t nowMillis();                                // 벽시계 ms
+int64_t floorDiv(int64_t value, int64_t divisor);   // 음수도 내림 (버킷 시작 시각)
+
+// JSON 숫자: 정수는 그대로, 아니면 유효 숫자 precision자리. NaN은 null
+void appendNumber(double value, std::string& out, int precision = 10);
+// JSON 문자열 (따옴표 포함). 제어 문자는 \u00XX
+void appendJsonString(const std::string& value, std::string& out);
+std::string errorJson(const std::string& error);    // {"error":"..."} + 줄바꿈
+
+std::vector<std::string> splitList(const std::string& text);   // 쉼표 구분, 빈 항목은 버린다
+
+// 태그 값 이스케이프
+//   Influx: 쉼표/공백/등호 앞에 역슬래시, 줄바꿈은 공백
+//   Statsd: 쉼표/파이프/#/줄바꿈을 '_'로 (DogStatsD 태그는 이스케이프가 없다)
+enum class TagSyntax {
+    Influx,
+    Statsd
+};
+void appendTagValue(const std::string& value, TagSyntax syntax, std::string& out);
+
+template <typename T>
+void putLE(T value, std::string& out) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T)); // x86/ARM 리틀 엔디언 가정
+    out.append(bytes, sizeof(T));
+}
+
+// CRC-32 (IEEE). 처음에는 crc = 0, 나눠서 계산하면 앞 조각의 결과를 넘긴다
+uint32_t updateCrc32(uint32_t crc, const void* data, size_t size);
+
+#endif // NVML_UTIL_H
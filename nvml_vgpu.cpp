@@ -0,0 +1,281 @@
+#include "nvml_vgpu.h"
+#include <algorithm>
+
+VGPUCollector::VGPUCollector(const std::vector<GPUInfo>& gpus) {
+    states.resize(gpus.size());
+
+    for (size_t i = 0; i < gpus.size(); i++) {
+        DeviceState& state = states[i];
+        state.device = gpus[i].device;
+        state.supported = false;
+        state.lastUtilizationTimeStamp = 0;
+        state.lastProcessTimeStamp = 0;
+        state.instancesPublished = false;
+
+        // vGPU 호스트 모드가 아닌 GPU는 이후 틱에서 NVML 호출을 하지 않는다
+        nvmlGpuVirtualizationMode_t mode;
+        if (nvmlDeviceGetVirtualizationMode(state.device, &mode) == NVML_SUCCESS) {
+            state.supported = (mode == NVML_GPU_VIRTUALIZATION_MODE_HOST_VGPU);
+        }
+
+        if (state.supported) {
+            refreshInstances(state, nullptr);
+        }
+    }
+}
+
+bool VGPUCollector::isSupported(unsigned int deviceIndex) const {
+    return deviceIndex < states.size() && states[deviceIndex].supported;
+}
+
+bool VGPUCollector::poll(unsigned int deviceIndex, VGPUUpdate& update) {
+    update.clear();
+    update.deviceIndex = deviceIndex;
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (deviceIndex >= states.size() || !states[deviceIndex].supported) {
+        return false;
+    }
+    DeviceState& state = states[deviceIndex];
+
+    if (!refreshInstances(state, &update)) {
+        return false;
+    }
+
+    // 동적 정보 (FB 사용량, 인코더 통계). 바뀐 인스턴스만 넘긴다
+    // 생성/삭제가 있던 틱은 타입별 생성 수가 바뀌므로 전부 넘긴다
+    bool membershipChanged = !state.instancesPublished || !update.created.empty() || !update.destroyed.empty();
+    state.instancesPublished = true;
+    for (auto& entry : state.instances) {
+        VGPUInfo& info = entry.second;
+        unsigned long long framebufferUsed = info.framebufferUsed;
+        unsigned int sessions = info.encoderSessionCount;
+        unsigned int fps = info.encoderAverageFps;
+        unsigned int latency = info.encoderAverageLatency;
+        readDynamicInfo(info);
+        if (membershipChanged || info.framebufferUsed != framebufferUsed || info.encoderSessionCount != sessions ||
+            info.encoderAverageFps != fps || info.encoderAverageLatency != latency) {
+            update.instances.push_back(info);
+        }
+    }
+
+    if (!state.active.empty()) {
+        collectUtilization(state, update);
+        collectProcessUtilization(state, update);
+    }
+
+    return true;
+}
+
+std::vector<VGPUInfo> VGPUCollector::getInstances(unsigned int deviceIndex) {
+    std::vector<VGPUInfo> result;
+    std::lock_guard<std::mutex> lock(stateMutex);
+    if (deviceIndex >= states.size() || !states[deviceIndex].supported) {
+        return result;
+    }
+
+    // 목록을 여기서 갱신하면 생성/삭제 차이가 poll에 잡히지 않으므로 마지막 poll 결과만 돌려준다
+    const DeviceState& state = states[deviceIndex];
+    result.reserve(state.instances.size());
+    for (const auto& entry : state.instances) {
+        result.push_back(entry.second);
+    }
+    return result;
+}
+
+void VGPUCollector::saveCursors(CheckpointWriter& writer) {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    writer.put<uint32_t>(static_cast<uint32_t>(states.size()));
+    for (const auto& state : states) {
+        writer.put<uint64_t>(state.lastUtilizationTimeStamp);
+        writer.put<uint64_t>(state.lastProcessTimeStamp);
+    }
+}
+
+bool VGPUCollector::restoreCursors(CheckpointReader& reader) {
+    uint32_t count = reader.get<uint32_t>();
+    if (!reader.good() || count != states.size()) return false;
+    std::vector<uint64_t> cursors(count * 2);
+    for (auto& cursor : cursors) {
+        cursor = reader.get<uint64_t>();
+    }
+    if (!reader.good()) return false;
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    for (size_t i = 0; i < states.size(); i++) {
+        states[i].lastUtilizationTimeStamp = cursors[i * 2];
+        states[i].lastProcessTimeStamp = cursors[i * 2 + 1];
+    }
+    return true;
+}
+
+bool VGPUCollector::refreshInstances(DeviceState& state, VGPUUpdate* update) {
+    // 이전 목록 크기로 먼저 시도하고 부족하면 한 번 더 호출
+    unsigned int count = static_cast<unsigned int>(state.scratch.capacity());
+    if (count < state.active.size() + 4) {
+        count = static_cast<unsigned int>(state.active.size() + 4);
+    }
+    state.scratch.resize(count);
+
+    nvmlReturn_t result = nvmlDeviceGetActiveVgpus(state.device, &count, state.scratch.data());
+    if (result == NVML_ERROR_INSUFFICIENT_SIZE) {
+        state.scratch.resize(count);
+        result = nvmlDeviceGetActiveVgpus(state.device, &count, state.scratch.data());
+    }
+    if (result != NVML_SUCCESS) {
+        return false;
+    }
+    state.scratch.resize(count);
+    std::sort(state.scratch.begin(), state.scratch.end());
+
+    if (state.scratch == state.active) {
+        return true;
+    }
+
+    // 정렬된 두 목록을 병합하면서 생성/삭제 판별
+    size_t i = 0, j = 0;
+    while (i < state.active.size() || j < state.scratch.size()) {
+        if (j == state.scratch.size() ||
+            (i < state.active.size() && state.active[i] < state.scratch[j])) {
+            state.instances.erase(state.active[i]);
+            if (update) update->destroyed.push_back(state.active[i]);
+            i++;
+        } else if (i == state.active.size() || state.scratch[j] < state.active[i]) {
+            VGPUInfo info = {};
+            readStaticInfo(state, state.scratch[j], info);
+            state.instances[state.scratch[j]] = info;
+            if (update) update->created.push_back(state.scratch[j]);
+            j++;
+        } else {
+            i++;
+            j++;
+        }
+    }
+
+    state.active.swap(state.scratch);
+    updateCreatedCounts(state);
+
+    // 사라진 인스턴스가 있어도 커서는 유지: NVML이 타임스탬프 기준으로만 필터링한다
+    return true;
+}
+
+void VGPUCollector::readStaticInfo(DeviceState& state, nvmlVgpuInstance_t instance, VGPUInfo& info) {
+    info.vgpuInstance = instance;
+
+    if (nvmlVgpuInstanceGetType(instance, &info.typeId) == NVML_SUCCESS) {
+        char typeName[NVML_VGPU_NAME_BUFFER_SIZE];
+        unsigned int size = sizeof(typeName);
+        if (nvmlVgpuTypeGetName(info.typeId, typeName, &size) == NVML_SUCCESS) {
+            info.typeNameId = internString(typeName);
+        }
+        nvmlVgpuTypeGetFramebufferSize(info.typeId, &info.framebufferSize);
+        nvmlVgpuTypeGetMaxInstances(state.device, info.typeId, &info.maxInstances);
+    }
+
+    char uuid[NVML_DEVICE_UUID_BUFFER_SIZE];
+    if (nvmlVgpuInstanceGetUUID(instance, uuid, sizeof(uuid)) == NVML_SUCCESS) {
+        info.uuidId = internString(uuid);
+    }
+
+    char vmId[NVML_DEVICE_UUID_BUFFER_SIZE];
+    nvmlVgpuVmIdType_t vmIdType;
+    if (nvmlVgpuInstanceGetVmID(instance, vmId, sizeof(vmId), &vmIdType) == NVML_SUCCESS) {
+        info.vmId = internString(vmId);
+    }
+
+    nvmlVgpuInstanceGetEncoderCapacity(instance, &info.encoderCapacity);
+}
+
+void VGPUCollector::readDynamicInfo(VGPUInfo& info) {
+    nvmlVgpuInstanceGetFbUsage(info.vgpuInstance, &info.framebufferUsed);
+    nvmlVgpuInstanceGetEncoderStats(info.vgpuInstance, &info.encoderSessionCount,
+                                    &info.encoderAverageFps, &info.encoderAverageLatency);
+}
+
+void VGPUCollector::updateCreatedCounts(DeviceState& state) {
+    // 같은 타입으로 생성된 인스턴스 수
+    std::map<nvmlVgpuTypeId_t, unsigned int> typeCounts;
+    for (const auto& entry : state.instances) {
+        typeCounts[entry.second.typeId]++;
+    }
+    for (auto& entry : state.instances) {
+        entry.second.createdInstances = typeCounts[entry.second.typeId];
+    }
+}
+
+void VGPUCollector::collectUtilization(DeviceState& state, VGPUUpdate& update) {
+    // 인스턴스당 최대 한 개의 샘플이 반환된다
+    if (state.utilizationBuffer.size() < state.active.size()) {
+        state.utilizationBuffer.resize(state.active.size());
+    }
+
+    nvmlValueType_t valueType;
+    unsigned int count = static_cast<unsigned int>(state.utilizationBuffer.size());
+    nvmlReturn_t result = nvmlDeviceGetVgpuUtilization(state.device, state.lastUtilizationTimeStamp,
+                                                       &valueType, &count, state.utilizationBuffer.data());
+    if (result == NVML_ERROR_INSUFFICIENT_SIZE) {
+        state.utilizationBuffer.resize(count);
+        result = nvmlDeviceGetVgpuUtilization(state.device, state.lastUtilizationTimeStamp,
+                                              &valueType, &count, state.utilizationBuffer.data());
+    }
+    if (result != NVML_SUCCESS) {
+        return;
+    }
+
+    unsigned long long newest = state.lastUtilizationTimeStamp;
+    for (unsigned int i = 0; i < count; i++) {
+        const auto& raw = state.utilizationBuffer[i];
+        if (raw.timeStamp <= state.lastUtilizationTimeStamp) continue;
+
+        VGPUUtilizationSample sample;
+        sample.vgpuInstance = raw.vgpuInstance;
+        sample.timeStamp = raw.timeStamp;
+        sample.smUtil = sampleValueToUInt(valueType, raw.smUtil);
+        sample.memUtil = sampleValueToUInt(valueType, raw.memUtil);
+        sample.encUtil = sampleValueToUInt(valueType, raw.encUtil);
+        sample.decUtil = sampleValueToUInt(valueType, raw.decUtil);
+        update.utilization.push_back(sample);
+
+        newest = std::max(newest, raw.timeStamp);
+    }
+    state.lastUtilizationTimeStamp = newest;
+}
+
+void VGPUCollector::collectProcessUtilization(DeviceState& state, VGPUUpdate& update) {
+    // 프로세스 수는 알 수 없으므로 이전 크기를 유지하고 부족할 때만 늘린다
+    if (state.processBuffer.empty()) {
+        state.processBuffer.resize(state.active.size() * 4);
+    }
+
+    unsigned int count = static_cast<unsigned int>(state.processBuffer.size());
+    nvmlReturn_t result = nvmlDeviceGetVgpuProcessUtilization(state.device, state.lastProcessTimeStamp,
+                                                              &count, state.processBuffer.data());
+    if (result == NVML_ERROR_INSUFFICIENT_SIZE) {
+        state.processBuffer.resize(count);
+        result = nvmlDeviceGetVgpuProcessUtilization(state.device, state.lastProcessTimeStamp,
+                                                     &count, state.processBuffer.data());
+    }
+    if (result != NVML_SUCCESS) {
+        return;
+    }
+
+    unsigned long long newest = state.lastProcessTimeStamp;
+    for (unsigned int i = 0; i < count; i++) {
+        const auto& raw = state.processBuffer[i];
+        if (raw.timeStamp <= state.lastProcessTimeStamp) continue;
+
+        VGPUProcessSample sample;
+        sample.vgpuInstance = raw.vgpuInstance;
+        sample.pid = raw.pid;
+        sample.nameId = internString(raw.processName);
+        sample.timeStamp = raw.timeStamp;
+        sample.smUtil = raw.smUtil;
+        sample.memUtil = raw.memUtil;
+        sample.encUtil = raw.encUtil;
+        sample.decUtil = raw.decUtil;
+        update.processes.push_back(std::move(sample));
+
+        newest = std::max(newest, raw.timeStamp);
+    }
+    state.lastProcessTimeStamp = newest;
+}
@@ -0,0 +1,61 @@
+#ifndef NVML_VGPU_H
+#define NVML_VGPU_H
+
+#include "nvml_checkpoint.h"
+#include "nvml_types.h"
+#include <map>
+#include <mutex>
+
+// vGPU 수집기
+// 활성 vGPU 인스턴스 목록은 틱마다 diff만 계산하고, 정적 정보(타입, UUID, VM ID)는
+// 인스턴스가 처음 보일 때 한 번만 조회한다. 사용률은 lastSeenTimeStamp 커서로 새 샘플만 읽는다.
+class VGPUCollector {
+private:
+    struct DeviceState {
+        nvmlDevice_t device;
+        bool supported;
+
+        // 정렬된 활성 인스턴스 목록 (diff 계산용)
+        std::vector<nvmlVgpuInstance_t> active;
+        std::vector<nvmlVgpuInstance_t> scratch;
+        std::map<nvmlVgpuInstance_t, VGPUInfo> instances;
+        bool instancesPublished;    // 첫 poll은 바뀌지 않은 인스턴스도 모두 넘긴다
+
+        // 증분 수집 커서
+        unsigned long long lastUtilizationTimeStamp;
+        unsigned long long lastProcessTimeStamp;
+
+        // 틱마다 재사용하는 NVML 샘플 버퍼
+        std::vector<nvmlVgpuInstanceUtilizationSample_t> utilizationBuffer;
+        std::vector<nvmlVgpuProcessUtilizationSample_t> processBuffer;
+    };
+
+    std::vector<DeviceState> states;
+    std::mutex stateMutex;
+
+public:
+    explicit VGPUCollector(const std::vector<GPUInfo>& gpus);
+
+    // vGPU 호스트 모드 여부
+    bool isSupported(unsigned int deviceIndex) const;
+
+    // 한 주기 수집: 생성/삭제된 인스턴스, 동적 정보가 바뀐 인스턴스, 마지막 호출 이후의 새 샘플만 채운다
+    bool poll(unsigned int deviceIndex, VGPUUpdate& update);
+
+    // 마지막 poll 기준 활성 인스턴스 정보 (NVML을 다시 읽지 않는다)
+    std::vector<VGPUInfo> getInstances(unsigned int deviceIndex);
+
+    // 체크포인트: 디바이스별 샘플 커서. 재시작 뒤 이미 내보낸 샘플을 다시 읽지 않는다
+    void saveCursors(CheckpointWriter& writer);
+    bool restoreCursors(CheckpointReader& reader); // 디바이스 수가 다르면 false
+
+private:
+    bool refreshInstances(DeviceState& state, VGPUUpdate* update);
+    void readStaticInfo(DeviceState& state, nvmlVgpuInstance_t instance, VGPUInfo& info);
+    void readDynamicInfo(VGPUInfo& info);
+    void updateCreatedCounts(DeviceState& state);
+    void collectUtilization(DeviceState& state, VGPUUpdate& update);
+    void collectProcessUtilization(DeviceState& state, VGPUUpdate& update);
+};
+
+#endif // NVML_VGPU_H
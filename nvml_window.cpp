@@ -0,0 +1,195 @@
+#include "nvml_window.h"
+#include "nvml_history.h"
+#include <algorithm>
+
+SlidingWindow::SlidingWindow(int64_t windowMs)
+    : windowMs(std::max<int64_t>(windowMs, 1)), newest(std::numeric_limits<int64_t>::min()) {}
+
+void SlidingWindow::add(int64_t timestampMs, double value) {
+    if (timestampMs < newest) timestampMs = newest;
+    newest = timestampMs;
+    back.push_back({timestampMs, value});
+    backAggregate.add(value);
+    evict(timestampMs - windowMs);
+}
+
+void SlidingWindow::advance(int64_t nowMs) {
+    evict(nowMs - windowMs);
+}
+
+WindowAggregate SlidingWindow::aggregate() const {
+    WindowAggregate result;
+    if (!front.empty()) result = front.back().suffix;
+    result.merge(backAggregate);
+    return result;
+}
+
+void SlidingWindow::clear() {
+    front.clear();
+    back.clear();
+    backAggregate = WindowAggregate();
+    newest = std::numeric_limits<int64_t>::min();
+}
+
+namespace {
+
+void putAggregate(CheckpointWriter& writer, const WindowAggregate& aggregate) {
+    writer.put<uint64_t>(aggregate.count);
+    writer.put<double>(aggregate.sum);
+    writer.put<double>(aggregate.sumSquares);
+    writer.put<double>(aggregate.min);
+    writer.put<double>(aggregate.max);
+}
+
+WindowAggregate getAggregate(CheckpointReader& reader) {
+    WindowAggregate aggregate;
+    aggregate.count = reader.get<uint64_t>();
+    aggregate.sum = reader.get<double>();
+    aggregate.sumSquares = reader.get<double>();
+    aggregate.min = reader.get<double>();
+    aggregate.max = reader.get<double>();
+    return aggregate;
+}
+
+} // namespace
+
+void SlidingWindow::saveCheckpoint(CheckpointWriter& writer) const {
+    writer.put<int64_t>(newest);
+    writer.put<uint32_t>(static_cast<uint32_t>(front.size()));
+    for (const auto& entry : front) {
+        writer.put<int64_t>(entry.timestamp);
+        putAggregate(writer, entry.suffix);
+    }
+    writer.put<uint32_t>(static_cast<uint32_t>(back.size()));
+    for (const auto& sample : back) {
+        writer.put<int64_t>(sample.timestamp);
+        writer.put<double>(sample.value);
+    }
+    putAggregate(writer, backAggregate);
+}
+
+bool SlidingWindow::restoreCheckpoint(CheckpointReader& reader) {
+    int64_t restoredNewest = reader.get<int64_t>();
+    uint32_t frontCount = reader.get<uint32_t>();
+    if (!reader.good()) return false;
+    std::vector<FrontEntry> restoredFront;
+    for (uint32_t i = 0; i < frontCount; i++) {
+        FrontEntry entry;
+        entry.timestamp = reader.get<int64_t>();
+        entry.suffix = getAggregate(reader);
+        if (!reader.good()) return false;
+        restoredFront.push_back(entry);
+    }
+    uint32_t backCount = reader.get<uint32_t>();
+    if (!reader.good()) return false;
+    std::vector<Sample> restoredBack;
+    for (uint32_t i = 0; i < backCount; i++) {
+        Sample sample;
+        sample.timestamp = reader.get<int64_t>();
+        sample.value = reader.get<double>();
+        if (!reader.good()) return false;
+        restoredBack.push_back(sample);
+    }
+    WindowAggregate restoredAggregate = getAggregate(reader);
+    if (!reader.good()) return false;
+
+    newest = restoredNewest;
+    front = std::move(restoredFront);
+    back = std::move(restoredBack);
+    backAggregate = restoredAggregate;
+    return true;
+}
+
+void SlidingWindow::evict(int64_t cutoff) {
+    while (true) {
+        if (front.empty()) {
+            if (back.empty() || back.front().timestamp > cutoff) return;
+            flip();
+        }
+        if (front.back().timestamp > cutoff) return;
+        front.pop_back();
+    }
+}
+
+void SlidingWindow::flip() {
+    // 최신 샘플부터 거꾸로 쌓아 가장 오래된 샘플이 front.back()에 오게 한다
+    WindowAggregate suffix;
+    for (size_t i = back.size(); i-- > 0;) {
+        suffix.add(back[i].value);
+        front.push_back({back[i].timestamp, suffix});
+    }
+    back.clear();
+    backAggregate = WindowAggregate();
+}
+
+WindowSet::WindowSet(int64_t windowMs) : windowMs(windowMs) {}
+
+uint32_t WindowSet::seriesId(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = ids.find(name);
+    if (it != ids.end()) return it->second;
+    uint32_t id = static_cast<uint32_t>(windows.size());
+    windows.emplace_back(windowMs);
+    names.push_back(name);
+    ids.emplace(name, id);
+    return id;
+}
+
+uint32_t WindowSet::findSeries(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = ids.find(name);
+    return it != ids.end() ? it->second : kInvalidSeries;
+}
+
+void WindowSet::add(uint32_t series, int64_t timestampMs, double value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (series < windows.size()) windows[series].add(timestampMs, value);
+}
+
+void WindowSet::add(const MetricsSnapshot& snapshot) {
+    int64_t ts = std::chrono::duration_cast<std::chrono::milliseconds>(snapshot.timestamp.time_since_epoch()).count();
+
+    // 새 디바이스가 보이면 그 디바이스의 시계열을 만든다 (락 밖에서, seriesId가 잠근다)
+    for (const auto& m : snapshot.devices) {
+        size_t base = static_cast<size_t>(m.deviceIndex) * HM_DEVICE_METRIC_COUNT;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (base < deviceSeries.size() && deviceSeries[base] != kInvalidSeries) continue;
+        }
+        std::vector<uint32_t> created(HM_DEVICE_METRIC_COUNT);
+        for (int metric = 0; metric < HM_DEVICE_METRIC_COUNT; metric++) {
+            created[metric] = seriesId("gpu" + std::to_string(m.deviceIndex) + "/" + historyMetricName(metric));
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (deviceSeries.size() < base + HM_DEVICE_METRIC_COUNT) {
+            deviceSeries.resize(base + HM_DEVICE_METRIC_COUNT, kInvalidSeries);
+        }
+        std::copy(created.begin(), created.end(), deviceSeries.begin() + base);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& m : snapshot.devices) {
+        size_t base = static_cast<size_t>(m.deviceIndex) * HM_DEVICE_METRIC_COUNT;
+        for (int metric = 0; metric < HM_DEVICE_METRIC_COUNT; metric++) {
+            windows[deviceSeries[base + metric]].add(ts, historyMetricValue(m, metric));
+        }
+    }
+}
+
+bool WindowSet::aggregate(uint32_t series, int64_t nowMs, WindowAggregate& result) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (series >= windows.size()) return false;
+    windows[series].advance(nowMs);
+    result = windows[series].aggregate();
+    return true;
+}
+
+bool WindowSet::aggregate(const std::string& name, int64_t nowMs, WindowAggregate& result) {
+    uint32_t series = findSeries(name);
+    return series != kInvalidSeries && aggregate(series, nowMs, result);
+}
+
+std::vector<std::string> WindowSet::seriesNames() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return names;
+}
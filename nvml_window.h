@@ -0,0 +1,121 @@
+#ifndef NVML_WINDOW_H
+#define NVML_WINDOW_H
+
+#include "nvml_checkpoint.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// nvml_types.h에 의존하지 않는다 (자체 GPUMetrics를 쓰는 MIG 코드에서도 포함할 수 있도록)
+struct MetricsSnapshot;
+
+// 창 집계 값 (분산은 제곱합으로 구하므로 값 크기에 비해 아주 작은 분산은 정확하지 않다)
+struct WindowAggregate {
+    uint64_t count = 0;
+    double sum = 0;
+    double sumSquares = 0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+
+    double mean() const { return count ? sum / count : 0; }
+    double variance() const {
+        if (count < 2) return 0;
+        double m = mean();
+        return std::max(0.0, sumSquares / count - m * m);
+    }
+    void add(double value) {
+        count++;
+        sum += value;
+        sumSquares += value * value;
+        if (value < min) min = value;
+        if (value > max) max = value;
+    }
+    void merge(const WindowAggregate& other) {
+        count += other.count;
+        sum += other.sum;
+        sumSquares += other.sumSquares;
+        if (other.min < min) min = other.min;
+        if (other.max > max) max = other.max;
+    }
+};
+
+// 시간 기반 슬라이딩 창 (최근 windowMs, 끝 포함 안 함: (now - windowMs, now])
+// 두 스택 집계: 새 샘플은 뒤 스택에 쌓고 누적 집계 하나만 갱신한다.
+// 앞 스택이 비면 뒤 스택을 뒤집어 옮기며 항목마다 "자신부터 최신까지"의 집계를 다시 계산하므로
+// 추가/만료는 분할 상환 O(1)이고, 합은 뒤집을 때마다 새로 더해져 뺄셈 오차가 쌓이지 않는다
+class SlidingWindow {
+private:
+    struct Sample {
+        int64_t timestamp;
+        double value;
+    };
+    struct FrontEntry {
+        int64_t timestamp;
+        WindowAggregate suffix; // 이 샘플부터 앞 스택의 가장 최신 샘플까지
+    };
+
+    int64_t windowMs;
+    int64_t newest;
+    std::vector<FrontEntry> front;  // back()이 가장 오래된 샘플
+    std::vector<Sample> back;       // 도착 순서
+    WindowAggregate backAggregate;
+
+public:
+    explicit SlidingWindow(int64_t windowMs);
+
+    // 타임스탬프는 단조 증가해야 한다 (과거 시각은 가장 최신 시각으로 본다)
+    void add(int64_t timestampMs, double value);
+    // now 기준으로 창 밖 샘플을 버린다
+    void advance(int64_t nowMs);
+    WindowAggregate aggregate() const;
+
+    size_t size() const { return front.size() + back.size(); }
+    int64_t getWindowMs() const { return windowMs; }
+    void clear();
+
+    // 체크포인트 (두 스택과 누적 집계를 그대로). 실패하면 창을 바꾸지 않고 false
+    void saveCheckpoint(CheckpointWriter& writer) const;
+    bool restoreCheckpoint(CheckpointReader& reader);
+
+private:
+    void evict(int64_t cutoff);
+    void flip();
+};
+
+// 이름 붙은 시계열별 슬라이딩 창 모음 (스레드 안전)
+// 시계열 ID는 한 번 받으면 바뀌지 않으므로 틱마다 이름을 찾지 않고 add(id, ...)로 넣는다
+//   NVMLManager: add(snapshot) -> "gpu<index>/<지표>" (nvml_history.h 지표 이름)
+//   MIG 등 다른 수집기: add(seriesId("<MIG uuid>/gpu_utilization"), ts, value)
+class WindowSet {
+private:
+    int64_t windowMs;
+    mutable std::mutex mutex;
+    std::vector<SlidingWindow> windows;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, uint32_t> ids;
+    std::vector<uint32_t> deviceSeries; // device * HM_DEVICE_METRIC_COUNT + metric -> 시계열 ID
+
+public:
+    static constexpr uint32_t kInvalidSeries = 0xFFFFFFFF;
+
+    explicit WindowSet(int64_t windowMs);
+
+    uint32_t seriesId(const std::string& name); // 없으면 만든다
+    uint32_t findSeries(const std::string& name) const; // 없으면 kInvalidSeries
+
+    void add(uint32_t series, int64_t timestampMs, double value);
+    void add(const MetricsSnapshot& snapshot);
+
+    // now 기준 창 집계 (없는 시계열이면 false)
+    bool aggregate(uint32_t series, int64_t nowMs, WindowAggregate& result);
+    bool aggregate(const std::string& name, int64_t nowMs, WindowAggregate& result);
+
+    std::vector<std::string> seriesNames() const;
+    int64_t getWindowMs() const { return windowMs; }
+};
+
+#endif // NVML_WINDOW_H
@@ -0,0 +1,317 @@
+#include "nvml_wire.h"
+#include <algorithm>
+
+namespace {
+
+// payload 읽기 커서
+class WireReader {
+private:
+    const uint8_t* pos;
+    const uint8_t* end;
+
+public:
+    WireReader(const uint8_t* data, size_t size) : pos(data), end(data + size) {}
+
+    bool varint(uint64_t& value) {
+        value = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7) {
+            if (pos == end) return false;
+            uint8_t byte = *pos++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return true;
+        }
+        return false;
+    }
+
+    bool string(std::string& value) {
+        uint64_t length;
+        if (!varint(length) || length > static_cast<uint64_t>(end - pos)) return false;
+        value.assign(reinterpret_cast<const char*>(pos), length);
+        pos += length;
+        return true;
+    }
+
+    bool byte(uint8_t& value) {
+        if (pos == end) return false;
+        value = *pos++;
+        return true;
+    }
+
+    bool atEnd() const { return pos == end; }
+    size_t remaining() const { return static_cast<size_t>(end - pos); }
+};
+
+uint64_t zigzagEncode(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t zigzagDecode(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+} // namespace
+
+WireEncoder::WireEncoder(std::vector<uint8_t>& buffer) : out(buffer), frameStart(0) {}
+
+void WireEncoder::beginFrame(WireFrameType type) {
+    frameStart = out.size();
+    out.resize(frameStart + WIRE_HEADER_SIZE);
+    out[frameStart + 0] = static_cast<uint8_t>(WIRE_MAGIC & 0xFF);
+    out[frameStart + 1] = static_cast<uint8_t>(WIRE_MAGIC >> 8);
+    out[frameStart + 2] = WIRE_VERSION;
+    out[frameStart + 3] = type;
+}
+
+void WireEncoder::endFrame() {
+    uint32_t length = static_cast<uint32_t>(out.size() - frameStart - WIRE_HEADER_SIZE);
+    for (int i = 0; i < 4; i++) {
+        out[frameStart + 4 + i] = static_cast<uint8_t>(length >> (8 * i));
+    }
+}
+
+void WireEncoder::reserveFor(size_t bytes) {
+    // 정확한 크기로 reserve하면 프레임마다 재할당되므로 용량은 배수로 늘린다
+    size_t needed = out.size() + bytes;
+    if (needed > out.capacity()) {
+        out.reserve(std::max(needed, out.capacity() * 2));
+    }
+}
+
+void WireEncoder::putVarint(uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void WireEncoder::putString(const std::string& value) {
+    putVarint(value.size());
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+void WireEncoder::hello(const std::string& node) {
+    beginFrame(WIRE_FRAME_HELLO);
+    putString(node);
+    endFrame();
+}
+
+void WireEncoder::devices(const std::vector<WireDeviceDecl>& decls) {
+    beginFrame(WIRE_FRAME_DEVICES);
+    putVarint(decls.size());
+    for (const auto& decl : decls) {
+        putVarint(decl.slot);
+        putString(decl.uuid);
+        putString(decl.model);
+    }
+    endFrame();
+}
+
+void WireEncoder::samples(uint64_t timestampMs, const WireSample* samples, size_t count) {
+    beginFrame(WIRE_FRAME_SAMPLES);
+    reserveFor(20 + count * (5 + WIRE_FIELD_COUNT * 10));
+    putVarint(timestampMs);
+    putVarint(count);
+    for (size_t i = 0; i < count; i++) {
+        putVarint(samples[i].slot);
+        for (int f = 0; f < WIRE_FIELD_COUNT; f++) {
+            putVarint(samples[i].values[f]);
+        }
+    }
+    endFrame();
+}
+
+void WireEncoder::batch(const WireTick* ticks, size_t count, WireDeltaState& state, bool keyframe) {
+    if (count == 0) return;
+    beginBatch(ticks[0], count, state, keyframe);
+    uint64_t previousTimestamp = 0;
+    for (size_t t = 0; t < count; t++) {
+        putTick(ticks[t], previousTimestamp, state);
+    }
+    endFrame();
+}
+
+void WireEncoder::batch(const std::deque<WireTick>& ticks, size_t first, size_t count, WireDeltaState& state,
+                        bool keyframe) {
+    if (count == 0) return;
+    beginBatch(ticks[first], count, state, keyframe);
+    uint64_t previousTimestamp = 0;
+    for (size_t t = first; t < first + count; t++) {
+        putTick(ticks[t], previousTimestamp, state);
+    }
+    endFrame();
+}
+
+void WireEncoder::beginBatch(const WireTick& first, size_t count, WireDeltaState& state, bool keyframe) {
+    if (keyframe) {
+        state.reset();
+    }
+
+    beginFrame(WIRE_FRAME_BATCH);
+    reserveFor(20 + count * 10);
+    out.push_back(keyframe ? WIRE_BATCH_KEYFRAME : 0);
+    putVarint(first.sequence);
+    putVarint(count);
+}
+
+void WireEncoder::putTick(const WireTick& tick, uint64_t& previousTimestamp, WireDeltaState& state) {
+    putVarint(zigzagEncode(static_cast<int64_t>(tick.timestampMs - previousTimestamp)));
+    previousTimestamp = tick.timestampMs;
+
+    putVarint(tick.samples.size());
+    for (const auto& sample : tick.samples) {
+        uint64_t* previous = state.values(sample.slot);
+
+        // 바뀐 필드만 비트마스크 + zigzag 델타로 기록
+        uint32_t mask = 0;
+        for (int f = 0; f < WIRE_FIELD_COUNT; f++) {
+            if (sample.values[f] != previous[f]) mask |= 1u << f;
+        }
+
+        putVarint(sample.slot);
+        putVarint(mask);
+        for (int f = 0; f < WIRE_FIELD_COUNT; f++) {
+            if (mask & (1u << f)) {
+                putVarint(zigzagEncode(static_cast<int64_t>(sample.values[f] - previous[f])));
+                previous[f] = sample.values[f];
+            }
+        }
+    }
+}
+
+void WireEncoder::ack(uint64_t sequence) {
+    beginFrame(WIRE_FRAME_ACK);
+    putVarint(sequence);
+    endFrame();
+}
+
+WireParseResult parseWireFrame(const uint8_t* data, size_t size, WireFrameType& type,
+                               const uint8_t*& payload, uint32_t& payloadSize, size_t& frameSize) {
+    if (size < WIRE_HEADER_SIZE) {
+        return WireParseResult::NeedMore;
+    }
+
+    uint16_t magic = static_cast<uint16_t>(data[0] | (data[1] << 8));
+    if (magic != WIRE_MAGIC || data[2] < WIRE_MIN_VERSION || data[2] > WIRE_VERSION) {
+        return WireParseResult::Error;
+    }
+
+    payloadSize = static_cast<uint32_t>(data[4]) | (static_cast<uint32_t>(data[5]) << 8) |
+                  (static_cast<uint32_t>(data[6]) << 16) | (static_cast<uint32_t>(data[7]) << 24);
+    if (payloadSize > WIRE_MAX_PAYLOAD) {
+        return WireParseResult::Error;
+    }
+    if (size < WIRE_HEADER_SIZE + payloadSize) {
+        return WireParseResult::NeedMore;
+    }
+
+    type = static_cast<WireFrameType>(data[3]);
+    payload = data + WIRE_HEADER_SIZE;
+    frameSize = WIRE_HEADER_SIZE + payloadSize;
+    return WireParseResult::Ok;
+}
+
+bool decodeWireHello(const uint8_t* payload, size_t size, std::string& node) {
+    WireReader reader(payload, size);
+    return reader.string(node) && reader.atEnd();
+}
+
+bool decodeWireDevices(const uint8_t* payload, size_t size, std::vector<WireDeviceDecl>& decls) {
+    WireReader reader(payload, size);
+    uint64_t count;
+    // 선언 하나는 최소 3바이트 (slot, uuid 길이, model 길이)
+    if (!reader.varint(count) || count > reader.remaining() / 3) return false;
+
+    decls.resize(count);
+    for (auto& decl : decls) {
+        uint64_t slot;
+        if (!reader.varint(slot) || slot >= WIRE_MAX_SLOTS ||
+            !reader.string(decl.uuid) || !reader.string(decl.model)) {
+            return false;
+        }
+        decl.slot = static_cast<uint32_t>(slot);
+    }
+    return reader.atEnd();
+}
+
+bool decodeWireSamples(const uint8_t* payload, size_t size, uint64_t& timestampMs,
+                       std::vector<WireSample>& samples) {
+    WireReader reader(payload, size);
+    uint64_t count;
+    // 샘플 하나는 최소 (1 + 필드 수)바이트
+    if (!reader.varint(timestampMs) || !reader.varint(count) ||
+        count > reader.remaining() / (1 + WIRE_FIELD_COUNT)) {
+        return false;
+    }
+
+    samples.resize(count);
+    for (auto& sample : samples) {
+        uint64_t slot;
+        if (!reader.varint(slot)) return false;
+        sample.slot = static_cast<uint32_t>(slot);
+        for (int f = 0; f < WIRE_FIELD_COUNT; f++) {
+            if (!reader.varint(sample.values[f])) return false;
+        }
+    }
+    return reader.atEnd();
+}
+
+bool decodeWireBatch(const uint8_t* payload, size_t size, WireDeltaState& state,
+                     std::vector<WireTick>& ticks) {
+    WireReader reader(payload, size);
+    uint8_t flags;
+    uint64_t firstSequence, count;
+    // 틱과 샘플은 각각 최소 2바이트라 남은 길이로 개수 상한을 잡는다.
+    // 적대적인 개수로 큰 벡터를 먼저 할당하지 않게 한다
+    if (!reader.byte(flags) || !reader.varint(firstSequence) || !reader.varint(count) ||
+        count > reader.remaining() / 2) {
+        return false;
+    }
+    if (flags & WIRE_BATCH_KEYFRAME) {
+        state.reset();
+    }
+
+    // 벡터와 내부 samples 용량은 호출 간 재사용된다
+    ticks.resize(count);
+    uint64_t timestamp = 0;
+    for (uint64_t t = 0; t < count; t++) {
+        WireTick& tick = ticks[t];
+        uint64_t delta, sampleCount;
+        if (!reader.varint(delta) || !reader.varint(sampleCount) || sampleCount > reader.remaining() / 2) {
+            return false;
+        }
+
+        timestamp += static_cast<uint64_t>(zigzagDecode(delta));
+        tick.sequence = firstSequence + t;
+        tick.timestampMs = timestamp;
+        tick.samples.resize(sampleCount);
+
+        for (auto& sample : tick.samples) {
+            uint64_t slot, mask;
+            if (!reader.varint(slot) || !reader.varint(mask) || slot >= WIRE_MAX_SLOTS) return false;
+
+            sample.slot = static_cast<uint32_t>(slot);
+            uint64_t* previous = state.values(sample.slot);
+            for (int f = 0; f < WIRE_FIELD_COUNT; f++) {
+                if (mask & (1u << f)) {
+                    uint64_t value;
+                    if (!reader.varint(value)) return false;
+                    previous[f] += static_cast<uint64_t>(zigzagDecode(value));
+                }
+                sample.values[f] = previous[f];
+            }
+        }
+    }
+    return reader.atEnd();
+}
+
+bool decodeWireAck(const uint8_t* payload, size_t size, uint64_t& sequence) {
+    WireReader reader(payload, size);
+    return reader.varint(sequence) && reader.atEnd();
+}
+
+bool peekWireBatchRange(const uint8_t* payload, size_t size, uint64_t& firstSequence, uint64_t& count) {
+    WireReader reader(payload, size);
+    uint8_t flags;
+    return reader.byte(flags) && reader.varint(firstSequence) && reader.varint(count);
+}
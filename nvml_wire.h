@@ -0,0 +1,145 @@
+#ifndef NVML_WIRE_H
+#define NVML_WIRE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+// 에이전트 -> 집계기 바이너리 프로토콜
+// 프레임: [magic u16][version u8][type u8][payload length u32][payload] (리틀 엔디언)
+// payload 정수는 LEB128 varint, 문자열은 varint 길이 + 바이트
+//
+// 버전 2: 여러 틱을 한 프레임에 담는 BATCH 프레임(디바이스별 직전 스냅샷 대비 델타)과
+// 집계기 -> 에이전트 ACK 프레임 추가. 버전 1 SAMPLES 프레임도 계속 디코딩한다.
+
+const uint16_t WIRE_MAGIC = 0x574E; // "NW"
+const uint8_t WIRE_VERSION = 2;
+const uint8_t WIRE_MIN_VERSION = 1;
+const size_t WIRE_HEADER_SIZE = 8;
+const uint32_t WIRE_MAX_PAYLOAD = 16 * 1024 * 1024;
+const uint32_t WIRE_MAX_SLOTS = 4096; // 노드당 디바이스 슬롯 상한
+
+enum WireFrameType : uint8_t {
+    WIRE_FRAME_HELLO = 1,    // 노드 이름
+    WIRE_FRAME_DEVICES = 2,  // 슬롯 -> UUID, 모델
+    WIRE_FRAME_SAMPLES = 3,  // 한 틱의 디바이스 샘플 (v1)
+    WIRE_FRAME_BATCH = 4,    // 여러 틱, 델타 인코딩 (v2)
+    WIRE_FRAME_ACK = 5       // 적용된 마지막 틱 시퀀스 (v2, 집계기 -> 에이전트)
+};
+
+// BATCH 프레임 플래그
+const uint8_t WIRE_BATCH_KEYFRAME = 0x01; // 디코더 델타 상태를 초기화한 뒤 적용
+
+// 샘플 필드 (순서가 곧 wire 순서)
+enum WireField {
+    WIRE_FIELD_GPU_UTIL = 0,
+    WIRE_FIELD_MEM_UTIL,
+    WIRE_FIELD_ENC_UTIL,
+    WIRE_FIELD_DEC_UTIL,
+    WIRE_FIELD_MEM_USED,
+    WIRE_FIELD_MEM_TOTAL,
+    WIRE_FIELD_TEMPERATURE,
+    WIRE_FIELD_FAN_SPEED,
+    WIRE_FIELD_POWER_USAGE,
+    WIRE_FIELD_POWER_LIMIT,
+    WIRE_FIELD_SM_CLOCK,
+    WIRE_FIELD_MEM_CLOCK,
+    WIRE_FIELD_GRAPHICS_CLOCK,
+    WIRE_FIELD_ECC_SINGLE,
+    WIRE_FIELD_ECC_DOUBLE,
+    WIRE_FIELD_COUNT
+};
+
+// 디바이스 선언 (연결당 한 번, 이후 샘플은 슬롯 번호로 참조)
+struct WireDeviceDecl {
+    uint32_t slot;
+    std::string uuid;
+    std::string model;
+};
+
+// 디바이스 샘플
+struct WireSample {
+    uint32_t slot;
+    uint64_t values[WIRE_FIELD_COUNT];
+};
+
+// 한 틱의 스냅샷 (sequence는 에이전트가 틱마다 1씩 증가)
+struct WireTick {
+    uint64_t sequence;
+    uint64_t timestampMs;
+    std::vector<WireSample> samples;
+};
+
+// 슬롯별 직전 값. 인코더와 디코더가 연결마다 각자 유지한다
+class WireDeltaState {
+private:
+    std::vector<WireSample> previous;
+
+public:
+    void reset() { previous.clear(); }
+
+    // 슬롯의 직전 값 (처음 보는 슬롯은 0으로 시작)
+    uint64_t* values(uint32_t slot) {
+        if (slot >= previous.size()) {
+            previous.resize(slot + 1, WireSample());
+        }
+        return previous[slot].values;
+    }
+};
+
+// 프레임 인코더 (버퍼 뒤에 프레임을 덧붙인다)
+class WireEncoder {
+private:
+    std::vector<uint8_t>& out;
+    size_t frameStart;
+
+public:
+    explicit WireEncoder(std::vector<uint8_t>& buffer);
+
+    void hello(const std::string& node);
+    void devices(const std::vector<WireDeviceDecl>& decls);
+    void samples(uint64_t timestampMs, const WireSample* samples, size_t count);
+
+    // 여러 틱을 한 프레임으로 (keyframe이면 state를 초기화하고 전체 값을 보낸다)
+    void batch(const WireTick* ticks, size_t count, WireDeltaState& state, bool keyframe);
+    // ticks[first, first + count)를 한 프레임으로 (송신 큐용)
+    void batch(const std::deque<WireTick>& ticks, size_t first, size_t count, WireDeltaState& state,
+               bool keyframe);
+    void ack(uint64_t sequence);
+
+private:
+    void beginFrame(WireFrameType type);
+    void beginBatch(const WireTick& first, size_t count, WireDeltaState& state, bool keyframe);
+    void putTick(const WireTick& tick, uint64_t& previousTimestamp, WireDeltaState& state);
+    void endFrame();
+    void reserveFor(size_t bytes);
+    void putVarint(uint64_t value);
+    void putString(const std::string& value);
+};
+
+// 프레임 파싱 결과
+enum class WireParseResult {
+    Ok,
+    NeedMore,
+    Error
+};
+
+// 버퍼 앞의 프레임 하나를 파싱한다 (payload는 data 내부를 가리킨다)
+WireParseResult parseWireFrame(const uint8_t* data, size_t size, WireFrameType& type,
+                               const uint8_t*& payload, uint32_t& payloadSize, size_t& frameSize);
+
+// payload 디코더
+bool decodeWireHello(const uint8_t* payload, size_t size, std::string& node);
+bool decodeWireDevices(const uint8_t* payload, size_t size, std::vector<WireDeviceDecl>& decls);
+bool decodeWireSamples(const uint8_t* payload, size_t size, uint64_t& timestampMs,
+                       std::vector<WireSample>& samples);
+bool decodeWireBatch(const uint8_t* payload, size_t size, WireDeltaState& state,
+                     std::vector<WireTick>& ticks);
+bool decodeWireAck(const uint8_t* payload, size_t size, uint64_t& sequence);
+
+// BATCH payload의 틱 시퀀스 범위만 읽는다 (전체 디코딩 없이)
+bool peekWireBatchRange(const uint8_t* payload, size_t size, uint64_t& firstSequence, uint64_t& count);
+
+#endif // NVML_WIRE_H
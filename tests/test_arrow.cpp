@@ -0,0 +1,255 @@
+// Arrow IPC 파일 배치: 앞뒤 매직, 푸터 길이, 푸터 블록이 가리키는 캡슐화 메시지와 행 수
+
+#include "../nvml_arrow.h"
+#include "../nvml_util.h"
+#include "test_util.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+
+namespace {
+
+const int kTicks = 3600;
+const unsigned int kDevices = 4;
+
+// 읽기 전용 flatbuffer 테이블 (검사용 최소 구현)
+struct FlatTable {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    size_t position = 0;
+
+    template <typename T>
+    T read(size_t at) const {
+        T value{};
+        if (at + sizeof(T) <= size) std::memcpy(&value, data + at, sizeof(T));
+        return value;
+    }
+
+    // 필드 위치 (없으면 0)
+    size_t field(int id) const {
+        size_t vtable = position - read<int32_t>(position);
+        uint16_t vtableSize = read<uint16_t>(vtable);
+        size_t slot = 4 + 2 * static_cast<size_t>(id);
+        if (slot + 2 > vtableSize) return 0;
+        uint16_t offset = read<uint16_t>(vtable + slot);
+        return offset ? position + offset : 0;
+    }
+
+    template <typename T>
+    T scalar(int id, T fallback = T()) const {
+        size_t at = field(id);
+        return at ? read<T>(at) : fallback;
+    }
+
+    // 오프셋 필드가 가리키는 위치 (테이블/벡터)
+    size_t indirect(int id) const {
+        size_t at = field(id);
+        return at ? at + read<uint32_t>(at) : 0;
+    }
+
+    FlatTable table(int id) const {
+        FlatTable child = *this;
+        child.position = indirect(id);
+        return child;
+    }
+};
+
+FlatTable rootTable(const uint8_t* data, size_t size) {
+    FlatTable table;
+    table.data = data;
+    table.size = size;
+    table.position = table.read<uint32_t>(0);
+    return table;
+}
+
+struct FooterBlock {
+    int64_t offset;
+    int32_t metadataLength;
+    int64_t bodyLength;
+};
+
+std::vector<FooterBlock> footerBlocks(const FlatTable& footer, int id) {
+    std::vector<FooterBlock> blocks;
+    size_t vector = footer.indirect(id);
+    if (!vector) return blocks;
+    uint32_t count = footer.read<uint32_t>(vector);
+    for (uint32_t i = 0; i < count; i++) {
+        size_t at = vector + 4 + i * 24;
+        blocks.push_back({footer.read<int64_t>(at), footer.read<int32_t>(at + 8), footer.read<int64_t>(at + 16)});
+    }
+    return blocks;
+}
+
+// 블록이 가리키는 메시지를 확인하고 배치 행 수를 돌려준다 (헤더 종류가 다르면 -1)
+int64_t messageRows(const std::string& file, const FooterBlock& block, uint8_t headerType, int64_t footerStart) {
+    CHECK(block.offset >= 8 && block.offset % 8 == 0);
+    CHECK(block.metadataLength % 8 == 0);
+    CHECK(block.bodyLength % 8 == 0);
+    CHECK(block.offset + block.metadataLength + block.bodyLength <= footerStart);
+    if (block.offset < 8 || block.offset + block.metadataLength > footerStart) return -1;
+
+    const uint8_t* at = reinterpret_cast<const uint8_t*>(file.data()) + block.offset;
+    uint32_t continuation;
+    int32_t length;
+    std::memcpy(&continuation, at, 4);
+    std::memcpy(&length, at + 4, 4);
+    CHECK(continuation == 0xFFFFFFFF);
+    CHECK(length + 8 == block.metadataLength);
+
+    FlatTable message = rootTable(at + 8, static_cast<size_t>(length));
+    CHECK(message.scalar<int64_t>(3) == block.bodyLength);
+    if (message.scalar<uint8_t>(1) != headerType) return -1;
+    FlatTable header = message.table(2);
+    // DictionaryBatch는 data(1)에 RecordBatch를 담는다
+    if (headerType == 2) header = header.table(1);
+    return header.scalar<int64_t>(0);
+}
+
+struct ArrowLayout {
+    bool valid = false;
+    std::vector<FooterBlock> dictionaries;
+    std::vector<FooterBlock> batches;
+    int64_t footerStart = 0;
+};
+
+ArrowLayout readLayout(const std::string& file) {
+    ArrowLayout layout;
+    CHECK(file.size() >= 8 + 8 + 4 + 6);
+    if (file.size() < 8 + 8 + 4 + 6) return layout;
+    CHECK(std::memcmp(file.data(), "ARROW1\0\0", 8) == 0);
+    CHECK(std::memcmp(file.data() + file.size() - 6, "ARROW1", 6) == 0);
+
+    int32_t footerLength;
+    std::memcpy(&footerLength, file.data() + file.size() - 10, 4);
+    CHECK(footerLength > 0 && static_cast<size_t>(footerLength) + 10 + 8 <= file.size());
+    if (footerLength <= 0 || static_cast<size_t>(footerLength) + 10 + 8 > file.size()) return layout;
+    layout.footerStart = static_cast<int64_t>(file.size()) - 10 - footerLength;
+
+    // 푸터 바로 앞은 스트림 종료 표시
+    uint32_t endMarker[2];
+    std::memcpy(endMarker, file.data() + layout.footerStart - 8, 8);
+    CHECK(endMarker[0] == 0xFFFFFFFF && endMarker[1] == 0);
+
+    FlatTable footer = rootTable(reinterpret_cast<const uint8_t*>(file.data()) + layout.footerStart,
+                                 static_cast<size_t>(footerLength));
+    CHECK(footer.scalar<int16_t>(0) == 4); // MetadataVersion V5
+    CHECK(footer.field(1) != 0);
+    layout.dictionaries = footerBlocks(footer, 2);
+    layout.batches = footerBlocks(footer, 3);
+
+    // 블록은 파일 순서대로 겹치지 않는다 (사전이 배치보다 먼저)
+    int64_t previousEnd = 8;
+    for (const auto* list : {&layout.dictionaries, &layout.batches}) {
+        for (const auto& block : *list) {
+            CHECK(block.offset >= previousEnd);
+            previousEnd = block.offset + block.metadataLength + block.bodyLength;
+        }
+    }
+    layout.valid = true;
+    return layout;
+}
+
+std::string exportToString(const MetricHistory& history, const ArrowExportRequest& request) {
+    char path[] = "/tmp/nvml_test_arrow.XXXXXX";
+    int fd = mkstemp(path);
+    CHECK(fd >= 0);
+    if (fd < 0) return "";
+    ::close(fd);
+    std::string error;
+    CHECK(exportHistoryArrow(history, request, path, error));
+    std::ifstream in(path, std::ios::binary);
+    std::string file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::remove(path);
+    return file;
+}
+
+void fill(MetricHistory& history, int64_t startMs) {
+    std::vector<GPUInfo> gpus(kDevices);
+    for (unsigned int i = 0; i < kDevices; i++) {
+        gpus[i].index = i;
+        gpus[i].uuid = "GPU-" + std::to_string(i);
+    }
+    history.setDevices(gpus);
+    for (int t = 0; t < kTicks; t++) {
+        MetricsSnapshot snapshot;
+        snapshot.timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(startMs + t * 1000LL));
+        for (unsigned int g = 0; g < kDevices; g++) {
+            GPUMetrics metrics{};
+            metrics.deviceIndex = g;
+            metrics.gpuUtilization = t % 100;
+            metrics.temperature = 40 + g;
+            snapshot.devices.push_back(metrics);
+        }
+        ProcessInfo process{};
+        process.deviceIndex = t % kDevices;
+        process.pid = 100 + t % 3;
+        process.nameId = internString("job" + std::to_string(t % 3));
+        process.usedGpuMemory = t;
+        snapshot.processes.push_back(process);
+        history.append(snapshot);
+    }
+}
+
+void testDeviceTable(const MetricHistory& history) {
+    ArrowExportRequest request;
+    std::string file = exportToString(history, request);
+    ArrowLayout layout = readLayout(file);
+    if (!layout.valid) return;
+
+    CHECK(layout.batches.size() > 1);
+    int64_t rows = 0;
+    for (const auto& block : layout.batches) {
+        int64_t batchRows = messageRows(file, block, 3, layout.footerStart);
+        CHECK(batchRows > 0);
+        rows += batchRows;
+    }
+    CHECK(rows == static_cast<int64_t>(kTicks) * kDevices);
+}
+
+void testProcessTable(const MetricHistory& history) {
+    ArrowExportRequest request;
+    request.table = HistoryTable::Process;
+    request.pids = {101, 102};
+    std::string file = exportToString(history, request);
+    ArrowLayout layout = readLayout(file);
+    if (!layout.valid) return;
+
+    // 프로세스 이름 사전
+    CHECK(layout.dictionaries.size() >= 1);
+    for (const auto& block : layout.dictionaries) {
+        CHECK(messageRows(file, block, 2, layout.footerStart) >= 1);
+    }
+    int64_t rows = 0;
+    for (const auto& block : layout.batches) {
+        rows += messageRows(file, block, 3, layout.footerStart);
+    }
+    CHECK(rows == kTicks / 3 * 2);
+}
+
+void testEmptyRange(const MetricHistory& history, int64_t startMs) {
+    // 행이 없어도 스키마와 푸터는 온전하다
+    ArrowExportRequest request;
+    request.start = startMs - 10 * 1000;
+    request.end = startMs - 5 * 1000;
+    std::string file = exportToString(history, request);
+    ArrowLayout layout = readLayout(file);
+    CHECK(layout.valid);
+    CHECK(layout.batches.empty());
+}
+
+} // namespace
+
+int main() {
+    HistoryConfig config;
+    config.blockRows = 1000;
+    MetricHistory history(config);
+    int64_t startMs = (nowMillis() / 60000 - 90) * 60000;
+    fill(history, startMs);
+
+    testDeviceTable(history);
+    testProcessTable(history);
+    testEmptyRange(history, startMs);
+    return testResult("test_arrow");
+}
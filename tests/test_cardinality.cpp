@@ -0,0 +1,111 @@
+// 카디널리티 상한: 넘친 프로세스는 "other"로 접고, 유휴 시리즈를 비워 새 pid를 받는다
+
+#include "../nvml_cardinality.h"
+#include "test_util.h"
+
+namespace {
+
+SnapshotPtr makeSnapshot(int64_t timestampMs, const std::vector<unsigned int>& pids) {
+    auto snapshot = std::make_shared<MetricsSnapshot>();
+    snapshot->timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(timestampMs));
+    for (unsigned int pid : pids) {
+        ProcessInfo process{};
+        process.deviceIndex = 0;
+        process.pid = pid;
+        process.nameId = internString("job");
+        process.usedGpuMemory = 100;
+        process.type = NVML_PROCESS_TYPE_COMPUTE;
+        snapshot->processes.push_back(process);
+        snapshot->host.processes.push_back(HostProcessCpu{pid, 1000, 50.0});
+    }
+    snapshot->host.valid = true;
+    snapshot->host.intervalMs = 1000;
+    return snapshot;
+}
+
+CardinalityConfig makeConfig() {
+    CardinalityConfig config;
+    config.limits[CARDINALITY_PROCESS_MEMORY].maxSeries = 3;
+    config.limits[CARDINALITY_PROCESS_CPU].maxSeries = 3;
+    config.idleMs = 10000;
+    return config;
+}
+
+void testFold() {
+    CardinalityLimiter limiter(makeConfig());
+
+    // 상한 안이면 스냅샷을 복사하지 않는다
+    SnapshotPtr under = makeSnapshot(1000, {1, 2, 3});
+    CHECK(limiter.apply(under) == under);
+
+    SnapshotPtr over = makeSnapshot(2000, {1, 2, 3, 4, 5});
+    SnapshotPtr folded = limiter.apply(over);
+    CHECK(folded != over);
+    CHECK(over->processes.size() == 5);
+    CHECK(folded->processes.size() == 4);
+    if (folded->processes.size() == 4) {
+        const ProcessInfo& other = folded->processes[3];
+        CHECK(other.pid == 0);
+        CHECK(internedString(other.nameId) == "other");
+        CHECK(other.usedGpuMemory == 200);
+    }
+    CHECK(folded->host.processes.size() == 4);
+    if (folded->host.processes.size() == 4) {
+        CHECK(folded->host.processes[3].cpuTimeMs == 1000);
+        CHECK_NEAR(folded->host.processes[3].cpuPercent, 100.0, 1e-9);
+    }
+
+    CardinalityStats stats = limiter.getStats(CARDINALITY_PROCESS_MEMORY);
+    CHECK(stats.series == 3);
+    CHECK(stats.folded == 2);
+
+    // 살아 있는 시리즈는 먼저 나열된 새 pid에 밀려나지 않는다
+    folded = limiter.apply(makeSnapshot(3000, {9, 1, 2, 3}));
+    CHECK(folded->processes.size() == 4);
+    for (size_t i = 0; i + 1 < folded->processes.size(); i++) {
+        CHECK(folded->processes[i].pid != 9);
+    }
+}
+
+void testEvict() {
+    CardinalityLimiter limiter(makeConfig());
+    limiter.apply(makeSnapshot(1000, {1, 2, 3}));
+
+    // 1, 2가 사라진 틱에 4, 5가 그 자리를 받는다
+    SnapshotPtr next = makeSnapshot(2000, {3, 4, 5});
+    CHECK(limiter.apply(next) == next);
+    CardinalityStats stats = limiter.getStats(CARDINALITY_PROCESS_MEMORY);
+    CHECK(stats.series == 3);
+    CHECK(stats.evicted == 2);
+    CHECK(stats.folded == 0);
+
+    // idleMs 동안 보이지 않으면 모두 만료된다
+    limiter.apply(makeSnapshot(20000, {}));
+    CHECK(limiter.getStats(CARDINALITY_PROCESS_MEMORY).series == 0);
+
+    // 짧은 작업이 계속 바뀌어도 시리즈 수는 상한을 넘지 않는다
+    for (int tick = 0; tick < 10000; tick++) {
+        unsigned int pid = 100 + tick * 2;
+        SnapshotPtr churned = limiter.apply(makeSnapshot(30000 + tick * 1000, {pid, pid + 1}));
+        CHECK(churned->processes.size() <= 4);
+    }
+    CHECK(limiter.getStats(CARDINALITY_PROCESS_MEMORY).series <= 3);
+}
+
+void testDrop() {
+    CardinalityConfig config = makeConfig();
+    config.limits[CARDINALITY_PROCESS_MEMORY].foldOverflow = false;
+    CardinalityLimiter limiter(config);
+    SnapshotPtr dropped = limiter.apply(makeSnapshot(1000, {1, 2, 3, 4}));
+    CHECK(dropped->processes.size() == 3);
+    CHECK(limiter.getStats(CARDINALITY_PROCESS_MEMORY).dropped == 1);
+}
+
+} // namespace
+
+int main() {
+    testFold();
+    testEvict();
+    testDrop();
+    return testResult("test_cardinality");
+}
@@ -0,0 +1,156 @@
+// 이력 질의: PID/디바이스 필터와 디바이스/프로세스 그룹
+
+#include "../nvml_history.h"
+#include "../nvml_util.h"
+#include "test_util.h"
+
+namespace {
+
+const int kTicks = 600;
+const unsigned int kDevices = 4;
+
+// 틱 t: 디바이스 g의 사용률 g * 10 + t % 2, pid 100은 디바이스 0, pid 101/102는 디바이스 1
+void fill(MetricHistory& history, int64_t startMs) {
+    std::vector<GPUInfo> gpus(kDevices);
+    for (unsigned int i = 0; i < kDevices; i++) {
+        gpus[i].index = i;
+        gpus[i].uuid = "GPU-" + std::to_string(i);
+    }
+    history.setDevices(gpus);
+
+    const unsigned int pids[] = {100, 101, 102};
+    const unsigned int pidDevices[] = {0, 1, 1};
+    for (int t = 0; t < kTicks; t++) {
+        MetricsSnapshot snapshot;
+        snapshot.timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(startMs + t * 1000LL));
+        for (unsigned int g = 0; g < kDevices; g++) {
+            GPUMetrics metrics{};
+            metrics.deviceIndex = g;
+            metrics.gpuUtilization = g * 10 + t % 2;
+            snapshot.devices.push_back(metrics);
+        }
+        for (int i = 0; i < 3; i++) {
+            ProcessInfo process{};
+            process.deviceIndex = pidDevices[i];
+            process.pid = pids[i];
+            process.nameId = internString("job" + std::to_string(pids[i]));
+            process.usedGpuMemory = pids[i];
+            snapshot.processes.push_back(process);
+        }
+        history.append(snapshot);
+    }
+}
+
+HistoryQuery processQuery(int64_t startMs) {
+    HistoryQuery query;
+    query.metric = HM_PROCESS_MEMORY;
+    query.start = startMs;
+    query.end = startMs + kTicks * 1000LL;
+    query.aggregate = HistoryAggregate::Sum;
+    query.groupBy = HistoryGroupBy::Process;
+    return query;
+}
+
+void testPidFilter(const MetricHistory& history, int64_t startMs) {
+    HistoryQuery query = processQuery(startMs);
+    query.pids = {101};
+    std::vector<HistorySeries> result;
+    std::string error;
+    CHECK(HistoryQueryEngine(history).run(query, result, error));
+    CHECK(result.size() == 1);
+    if (result.size() == 1) {
+        CHECK(result[0].device == 1);
+        CHECK(result[0].pid == 101);
+        CHECK(history.processName(result[0].nameId) == "job101");
+        CHECK(result[0].values.size() == 1);
+        if (!result[0].values.empty()) CHECK_NEAR(result[0].values[0], 101.0 * kTicks, 1e-6);
+    }
+
+    // 정렬되지 않은 PID 목록, 없는 PID는 무시
+    query.pids = {102, 999, 100};
+    CHECK(HistoryQueryEngine(history).run(query, result, error));
+    CHECK(result.size() == 2);
+    if (result.size() == 2) {
+        CHECK(result[0].pid == 100 && result[0].device == 0);
+        CHECK(result[1].pid == 102 && result[1].device == 1);
+    }
+}
+
+void testDeviceAndPidFilter(const MetricHistory& history, int64_t startMs) {
+    HistoryQuery query = processQuery(startMs);
+    std::vector<HistorySeries> result;
+    std::string error;
+
+    query.deviceMask = historyDeviceBit(1);
+    CHECK(HistoryQueryEngine(history).run(query, result, error));
+    CHECK(result.size() == 2);
+    for (const auto& series : result) {
+        CHECK(series.device == 1);
+    }
+
+    // 두 필터가 겹치지 않으면 비어 있다
+    query.pids = {100};
+    CHECK(HistoryQueryEngine(history).run(query, result, error));
+    CHECK(result.empty());
+}
+
+void testDeviceGroup(const MetricHistory& history, int64_t startMs) {
+    HistoryQuery query;
+    query.metric = HM_GPU_UTILIZATION;
+    query.start = startMs;
+    query.end = startMs + kTicks * 1000LL;
+    query.step = 60 * 1000;
+    query.aggregate = HistoryAggregate::Avg;
+    query.groupBy = HistoryGroupBy::Device;
+    query.deviceMask = historyDeviceBit(1) | historyDeviceBit(3);
+
+    std::vector<HistorySeries> result;
+    std::string error;
+    CHECK(HistoryQueryEngine(history).run(query, result, error));
+    CHECK(result.size() == 2);
+    if (result.size() == 2) {
+        CHECK(result[0].device == 1 && result[1].device == 3);
+        for (const auto& series : result) {
+            CHECK(series.values.size() == kTicks / 60);
+            for (double value : series.values) {
+                CHECK_NEAR(value, series.device * 10 + 0.5, 1e-9);
+            }
+        }
+    }
+}
+
+void testRejectedQueries(const MetricHistory& history, int64_t startMs) {
+    std::vector<HistorySeries> result;
+    std::string error;
+
+    // 디바이스 지표에는 PID가 없다
+    HistoryQuery query;
+    query.metric = HM_GPU_UTILIZATION;
+    query.start = startMs;
+    query.end = startMs + kTicks * 1000LL;
+    query.pids = {100};
+    CHECK(!HistoryQueryEngine(history).run(query, result, error));
+    CHECK(!error.empty());
+
+    query.pids.clear();
+    query.groupBy = HistoryGroupBy::Process;
+    error.clear();
+    CHECK(!HistoryQueryEngine(history).run(query, result, error));
+    CHECK(!error.empty());
+}
+
+} // namespace
+
+int main() {
+    HistoryConfig config;
+    config.blockRows = 256; // 여러 블록에 걸치게
+    MetricHistory history(config);
+    int64_t startMs = (nowMillis() / 60000 - 20) * 60000;
+    fill(history, startMs);
+
+    testPidFilter(history, startMs);
+    testDeviceAndPidFilter(history, startMs);
+    testDeviceGroup(history, startMs);
+    testRejectedQueries(history, startMs);
+    return testResult("test_history");
+}
@@ -0,0 +1,95 @@
+// DDSketch 분위수: 상대 오차 보장, 병합, 인코딩 왕복, 버킷 상한
+
+#include "../nvml_sketch.h"
+#include "test_util.h"
+#include <algorithm>
+#include <random>
+
+namespace {
+
+// 정렬된 표본의 q 분위수와 스케치 추정의 상대 오차 (0은 절대 오차)
+double worstRelativeError(const QuantileSketch& sketch, const std::vector<double>& sorted) {
+    double worst = 0;
+    for (double q : {0.0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999, 1.0}) {
+        double exact = sorted[static_cast<size_t>(q * (sorted.size() - 1))];
+        double estimate = sketch.quantile(q);
+        double error = exact == 0 ? std::fabs(estimate) : std::fabs(estimate - exact) / exact;
+        worst = std::max(worst, error);
+    }
+    return worst;
+}
+
+void testRelativeError() {
+    std::mt19937_64 rng(1);
+    std::lognormal_distribution<double> lognormal(3, 1.5);
+    std::uniform_real_distribution<double> uniform(30, 90);
+
+    for (int distribution = 0; distribution < 3; distribution++) {
+        QuantileSketch sketch;
+        std::vector<double> values;
+        for (int i = 0; i < 100000; i++) {
+            double value = distribution == 0   ? lognormal(rng)
+                           : distribution == 1 ? uniform(rng)
+                                               : (i % 10 == 0 ? 0 : 1e6 * lognormal(rng));
+            values.push_back(value);
+            sketch.add(value);
+        }
+        std::sort(values.begin(), values.end());
+        CHECK(sketch.getCount() == values.size());
+        // 분위수 위치가 버킷 경계에 걸리면 이웃 값까지 번질 수 있어 약간의 여유를 둔다
+        CHECK(worstRelativeError(sketch, values) <= sketch.getRelativeAccuracy() * 1.05);
+    }
+}
+
+void testMergeAndEncode() {
+    std::mt19937_64 rng(2);
+    std::lognormal_distribution<double> lognormal(3, 1.5);
+    QuantileSketch even, odd, all;
+    for (int i = 0; i < 10000; i++) {
+        double value = lognormal(rng);
+        (i % 2 ? odd : even).add(value);
+        all.add(value);
+    }
+    even.merge(odd);
+    CHECK(even.getCount() == all.getCount());
+    for (double q : {0.01, 0.5, 0.99}) {
+        CHECK(even.quantile(q) == all.quantile(q));
+    }
+
+    std::string encoded;
+    all.encode(encoded);
+    CheckpointReader reader(reinterpret_cast<const uint8_t*>(encoded.data()), encoded.size());
+    QuantileSketch decoded;
+    CHECK(decoded.decode(reader));
+    CHECK(decoded.getCount() == all.getCount());
+    CHECK(decoded.quantile(0.99) == all.quantile(0.99));
+
+    // 잘린 인코딩은 거부한다
+    CheckpointReader truncated(reinterpret_cast<const uint8_t*>(encoded.data()), encoded.size() / 2);
+    QuantileSketch rejected;
+    CHECK(!rejected.decode(truncated) || !truncated.good());
+}
+
+void testBucketCap() {
+    // 버킷이 넘치면 낮은 쪽을 합치므로 높은 분위수는 그대로 정확하다
+    QuantileSketch capped(0.01, 64);
+    std::vector<double> values;
+    for (int i = 0; i < 100000; i++) {
+        double value = std::pow(10, (i % 1000) / 100.0);
+        values.push_back(value);
+        capped.add(value);
+    }
+    std::sort(values.begin(), values.end());
+    CHECK(capped.bucketCount() <= 64);
+    double exact = values[static_cast<size_t>(0.99 * (values.size() - 1))];
+    CHECK(std::fabs(capped.quantile(0.99) - exact) / exact <= 0.0105);
+}
+
+} // namespace
+
+int main() {
+    testRelativeError();
+    testMergeAndEncode();
+    testBucketCap();
+    return testResult("test_sketch");
+}
@@ -0,0 +1,153 @@
+// 디스크 스풀 복구: 다시 열 때 CRC가 틀리거나 잘린 꼬리 레코드를 잘라내고, 재생 중 손상은 세그먼트 끝으로 본다
+
+#include "../nvml_spool.h"
+#include "test_util.h"
+#include <cstdlib>
+#include <dirent.h>
+#include <fcntl.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const size_t kRecordHeaderSize = 8;
+const size_t kRecordCount = 10;
+const size_t kPayloadSize = 32;
+
+std::string makeDirectory() {
+    char path[] = "/tmp/nvml_test_spool.XXXXXX";
+    return mkdtemp(path) ? path : "";
+}
+
+void removeDirectory(const std::string& directory) {
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) return;
+    while (struct dirent* entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name != "." && name != "..") unlink((directory + "/" + name).c_str());
+    }
+    closedir(dir);
+    rmdir(directory.c_str());
+}
+
+// 디렉터리의 유일한 세그먼트 파일
+std::string onlySegment(const std::string& directory) {
+    std::string found;
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) return found;
+    while (struct dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') found = directory + "/" + entry->d_name;
+    }
+    closedir(dir);
+    return found;
+}
+
+// 레코드 i의 payload는 모두 i
+void writeRecords(const std::string& directory) {
+    SpoolConfig config;
+    config.directory = directory;
+    DiskSpool spool(config);
+    CHECK(spool.open());
+    for (size_t i = 0; i < kRecordCount; i++) {
+        std::vector<uint8_t> payload(kPayloadSize, static_cast<uint8_t>(i));
+        CHECK(spool.append(payload.data(), payload.size()));
+    }
+    CHECK(spool.sync());
+    spool.close();
+}
+
+void corruptRecord(const std::string& path, size_t record) {
+    int fd = ::open(path.c_str(), O_RDWR);
+    CHECK(fd >= 0);
+    uint8_t flipped = 0xa5;
+    off_t offset = record * (kRecordHeaderSize + kPayloadSize) + kRecordHeaderSize + 3;
+    CHECK(pwrite(fd, &flipped, 1, offset) == 1);
+    ::close(fd);
+}
+
+size_t replayAll(DiskSpool& spool) {
+    size_t count = 0;
+    if (!spool.beginReplay()) return 0;
+    const uint8_t* data;
+    uint32_t size;
+    while (spool.nextRecord(data, size)) {
+        CHECK(size == kPayloadSize);
+        CHECK(data[0] == count);
+        count++;
+    }
+    spool.finishReplay();
+    return count;
+}
+
+uint64_t fileSize(const std::string& path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 ? static_cast<uint64_t>(st.st_size) : 0;
+}
+
+void testRecoverOnOpen() {
+    std::string directory = makeDirectory();
+    CHECK(!directory.empty());
+    writeRecords(directory);
+    std::string segment = onlySegment(directory);
+    CHECK(fileSize(segment) == kRecordCount * (kRecordHeaderSize + kPayloadSize));
+
+    // 여섯 번째 레코드가 깨지면 앞의 다섯 개만 남는다
+    corruptRecord(segment, 5);
+    SpoolConfig config;
+    config.directory = directory;
+    DiskSpool spool(config);
+    CHECK(spool.open());
+    CHECK(fileSize(segment) == 5 * (kRecordHeaderSize + kPayloadSize));
+    CHECK(spool.diskBytes() == 5 * (kRecordHeaderSize + kPayloadSize));
+    CHECK(replayAll(spool) == 5);
+    CHECK(spool.empty());
+    spool.close();
+    removeDirectory(directory);
+}
+
+void testTruncatedTail() {
+    std::string directory = makeDirectory();
+    writeRecords(directory);
+    std::string segment = onlySegment(directory);
+
+    // 마지막 레코드를 쓰다 죽은 경우
+    CHECK(truncate(segment.c_str(), fileSize(segment) - kPayloadSize / 2) == 0);
+    SpoolConfig config;
+    config.directory = directory;
+    DiskSpool spool(config);
+    CHECK(spool.open());
+    CHECK(replayAll(spool) == kRecordCount - 1);
+    spool.close();
+    removeDirectory(directory);
+}
+
+void testCorruptDuringReplay() {
+    std::string directory = makeDirectory();
+    SpoolConfig config;
+    config.directory = directory;
+    DiskSpool spool(config);
+    CHECK(spool.open());
+    for (size_t i = 0; i < kRecordCount; i++) {
+        std::vector<uint8_t> payload(kPayloadSize, static_cast<uint8_t>(i));
+        CHECK(spool.append(payload.data(), payload.size()));
+    }
+    CHECK(spool.sync());
+
+    // 열려 있는 동안 깨진 레코드는 재생이 거기서 멈추고 손상으로 센다
+    corruptRecord(onlySegment(directory), 7);
+    CHECK(replayAll(spool) == 7);
+    CHECK(spool.getStats().corruptSegments == 1);
+    CHECK(spool.empty());
+    spool.close();
+    removeDirectory(directory);
+}
+
+} // namespace
+
+int main() {
+    testRecoverOnOpen();
+    testTruncatedTail();
+    testCorruptDuringReplay();
+    return testResult("test_spool");
+}
@@ -0,0 +1,41 @@
+#ifndef NVML_TEST_UTIL_H
+#define NVML_TEST_UTIL_H
+
+// 단위 테스트 공용: 실패한 검사는 위치와 식을 찍고 세어 두었다가 main이 0이 아닌 값으로 끝낸다
+#include <cmath>
+#include <iostream>
+
+inline int& testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(condition)                                                                              \
+    do {                                                                                              \
+        if (!(condition)) {                                                                           \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl; \
+            testFailures()++;                                                                         \
+        }                                                                                             \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, tolerance)                                                       \
+    do {                                                                                              \
+        double checkActual = (actual);                                                                \
+        double checkExpected = (expected);                                                            \
+        if (!(std::fabs(checkActual - checkExpected) <= (tolerance))) {                               \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": " #actual " = " << checkActual            \
+                      << ", expected " << checkExpected << " +/- " << (tolerance) << std::endl;       \
+            testFailures()++;                                                                         \
+        }                                                                                             \
+    } while (0)
+
+inline int testResult(const char* name) {
+    if (testFailures() > 0) {
+        std::cerr << name << ": " << testFailures() << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << name << ": ok" << std::endl;
+    return 0;
+}
+
+#endif // NVML_TEST_UTIL_H
@@ -0,0 +1,140 @@
+// wire 프레임 디코더: 정상 왕복, 잘린 payload, 개수 필드를 부풀린 악성 payload
+
+#include "../nvml_wire.h"
+#include "test_util.h"
+
+namespace {
+
+std::vector<WireTick> makeTicks(size_t count, size_t devices) {
+    std::vector<WireTick> ticks(count);
+    for (size_t t = 0; t < count; t++) {
+        ticks[t].sequence = 100 + t;
+        ticks[t].timestampMs = 1700000000000ULL + t * 1000;
+        ticks[t].samples.resize(devices);
+        for (size_t d = 0; d < devices; d++) {
+            WireSample& sample = ticks[t].samples[d];
+            sample.slot = static_cast<uint32_t>(d);
+            for (int f = 0; f < WIRE_FIELD_COUNT; f++) {
+                sample.values[f] = t * 7 + d * 3 + f;
+            }
+        }
+    }
+    return ticks;
+}
+
+// 버퍼 앞의 프레임 하나의 payload
+bool firstPayload(const std::vector<uint8_t>& buffer, WireFrameType expected, const uint8_t*& payload,
+                  uint32_t& payloadSize) {
+    WireFrameType type;
+    size_t frameSize;
+    return parseWireFrame(buffer.data(), buffer.size(), type, payload, payloadSize, frameSize) ==
+               WireParseResult::Ok &&
+           type == expected;
+}
+
+void testBatchRoundTrip() {
+    std::vector<uint8_t> buffer;
+    WireEncoder encoder(buffer);
+    WireDeltaState encodeState;
+    std::vector<WireTick> ticks = makeTicks(5, 3);
+    encoder.batch(ticks.data(), ticks.size(), encodeState, true);
+
+    const uint8_t* payload;
+    uint32_t payloadSize;
+    CHECK(firstPayload(buffer, WIRE_FRAME_BATCH, payload, payloadSize));
+
+    WireDeltaState decodeState;
+    std::vector<WireTick> decoded;
+    CHECK(decodeWireBatch(payload, payloadSize, decodeState, decoded));
+    CHECK(decoded.size() == ticks.size());
+    for (size_t t = 0; t < decoded.size() && t < ticks.size(); t++) {
+        CHECK(decoded[t].sequence == ticks[t].sequence);
+        CHECK(decoded[t].timestampMs == ticks[t].timestampMs);
+        CHECK(decoded[t].samples.size() == ticks[t].samples.size());
+        for (size_t d = 0; d < decoded[t].samples.size(); d++) {
+            for (int f = 0; f < WIRE_FIELD_COUNT; f++) {
+                CHECK(decoded[t].samples[d].values[f] == ticks[t].samples[d].values[f]);
+            }
+        }
+    }
+}
+
+void testTruncatedBatch() {
+    std::vector<uint8_t> buffer;
+    WireEncoder encoder(buffer);
+    WireDeltaState encodeState;
+    std::vector<WireTick> ticks = makeTicks(4, 2);
+    encoder.batch(ticks.data(), ticks.size(), encodeState, true);
+
+    const uint8_t* payload;
+    uint32_t payloadSize;
+    CHECK(firstPayload(buffer, WIRE_FRAME_BATCH, payload, payloadSize));
+
+    // 어디서 잘려도 실패해야 하고 읽기는 payload 밖으로 나가지 않는다
+    for (uint32_t size = 0; size < payloadSize; size++) {
+        std::vector<uint8_t> truncated(payload, payload + size);
+        WireDeltaState state;
+        std::vector<WireTick> decoded;
+        if (decodeWireBatch(truncated.data(), truncated.size(), state, decoded)) {
+            std::cerr << "truncated batch of " << size << " bytes decoded" << std::endl;
+            testFailures()++;
+        }
+    }
+
+    // 프레임 헤더만 있고 payload가 덜 왔으면 더 기다린다
+    WireFrameType type;
+    size_t frameSize;
+    CHECK(parseWireFrame(buffer.data(), buffer.size() - 1, type, payload, payloadSize, frameSize) ==
+          WireParseResult::NeedMore);
+}
+
+void testHostileCounts() {
+    // 키프레임 플래그, 틱 수 2^32 - 1: 몇 바이트짜리 payload가 큰 reserve를 일으키면 안 된다
+    const uint8_t hostileBatch[] = {1, 0, 0xff, 0xff, 0xff, 0xff, 0x0f};
+    WireDeltaState state;
+    std::vector<WireTick> ticks;
+    CHECK(!decodeWireBatch(hostileBatch, sizeof(hostileBatch), state, ticks));
+    CHECK(ticks.capacity() < 1024);
+
+    // 디바이스 선언 수 2^32 - 1
+    const uint8_t hostileDevices[] = {0xff, 0xff, 0xff, 0xff, 0x0f};
+    std::vector<WireDeviceDecl> decls;
+    CHECK(!decodeWireDevices(hostileDevices, sizeof(hostileDevices), decls));
+    CHECK(decls.capacity() < 1024);
+
+    // v1 SAMPLES: 시각 다음 샘플 수 2^32 - 1
+    const uint8_t hostileSamples[] = {0x01, 0xff, 0xff, 0xff, 0xff, 0x0f};
+    uint64_t timestamp;
+    std::vector<WireSample> samples;
+    CHECK(!decodeWireSamples(hostileSamples, sizeof(hostileSamples), timestamp, samples));
+    CHECK(samples.capacity() < 1024);
+
+    // 끝나지 않는 varint
+    const uint8_t endless[] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+    uint64_t sequence;
+    CHECK(!decodeWireAck(endless, sizeof(endless), sequence));
+}
+
+void testBadFrameHeader() {
+    std::vector<uint8_t> buffer;
+    WireEncoder encoder(buffer);
+    encoder.ack(42);
+    buffer[0] ^= 0xff; // magic
+
+    WireFrameType type;
+    const uint8_t* payload;
+    uint32_t payloadSize;
+    size_t frameSize;
+    CHECK(parseWireFrame(buffer.data(), buffer.size(), type, payload, payloadSize, frameSize) ==
+          WireParseResult::Error);
+}
+
+} // namespace
+
+int main() {
+    testBatchRoundTrip();
+    testTruncatedBatch();
+    testHostileCounts();
+    testBadFrameHeader();
+    return testResult("test_wire");
+}